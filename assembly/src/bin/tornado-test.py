@@ -56,6 +56,7 @@ __TEST_THE_WORLD__ = [
     TestEntry("uk.ac.manchester.tornado.unittests.tasks.TestMultipleTasksSingleDevice"),
     TestEntry("uk.ac.manchester.tornado.unittests.images.TestImages"),
     TestEntry("uk.ac.manchester.tornado.unittests.images.TestResizeImage"),
+    TestEntry("uk.ac.manchester.tornado.unittests.images.TestDeviceImages"),
     TestEntry("uk.ac.manchester.tornado.unittests.branching.TestConditionals"),
     TestEntry("uk.ac.manchester.tornado.unittests.loops.TestLoops"),
     TestEntry("uk.ac.manchester.tornado.unittests.loops.TestParallelDimensions"),
@@ -67,6 +68,7 @@ __TEST_THE_WORLD__ = [
     TestEntry("uk.ac.manchester.tornado.unittests.reductions.InstanceReduction"),
     TestEntry("uk.ac.manchester.tornado.unittests.instances.TestInstances"),
     TestEntry("uk.ac.manchester.tornado.unittests.matrices.TestMatrixTypes"),
+    TestEntry("uk.ac.manchester.tornado.unittests.matrices.TestSparseMatrices"),
     TestEntry("uk.ac.manchester.tornado.unittests.api.TestAPI"),
     TestEntry("uk.ac.manchester.tornado.unittests.math.TestMath"),
     TestEntry("uk.ac.manchester.tornado.unittests.batches.TestBatches"),
@@ -92,6 +94,12 @@ __TEST_THE_WORLD__ = [
     TestEntry("uk.ac.manchester.tornado.unittests.grid.TestGridScheduler"),
     TestEntry("uk.ac.manchester.tornado.unittests.atomics.TestAtomics"),
     TestEntry("uk.ac.manchester.tornado.unittests.dynamic.TestDynamic"),
+    TestEntry("uk.ac.manchester.tornado.unittests.arrays.TestReadOnlyArrays"),
+    TestEntry("uk.ac.manchester.tornado.unittests.runtime.TestEventTable"),
+    TestEntry("uk.ac.manchester.tornado.unittests.runtime.TestNumaTopology"),
+    TestEntry("uk.ac.manchester.tornado.unittests.runtime.TestTieredCompilation"),
+    TestEntry("uk.ac.manchester.tornado.unittests.runtime.TestWorkGroupSizes"),
+    TestEntry("uk.ac.manchester.tornado.unittests.runtime.TestProfilerSampler"),
     TestEntry(testName="uk.ac.manchester.tornado.unittests.virtual.TestVirtualDeviceKernel",
               testMethods=["testVirtualDeviceKernelGPU"],
               testParameters=[
@@ -115,7 +123,22 @@ __TEST_THE_WORLD__ = [
               testParameters=[
                   "-Dtornado.device.desc=" + os.environ["TORNADO_SDK"] + "/examples/virtual-device-CPU.json",
                   "-Dtornado.virtual.device=True", "-Dtornado.feature.extraction=True",
-                  "-Dtornado.features.dump.dir=" + os.environ["TORNADO_SDK"] + "/virtualFeaturesOut.out"])
+                  "-Dtornado.features.dump.dir=" + os.environ["TORNADO_SDK"] + "/virtualFeaturesOut.out"]),
+    TestEntry(testName="uk.ac.manchester.tornado.unittests.images.TestImages",
+              testParameters=["-Dtornado.images=True"]),
+    TestEntry(testName="uk.ac.manchester.tornado.unittests.images.TestDeviceImages",
+              testParameters=["-Dtornado.images=True"]),
+    TestEntry(testName="uk.ac.manchester.tornado.unittests.arrays.TestReadOnlyArrays",
+              testParameters=["-Dtornado.constant.params=True"]),
+    TestEntry(testName="uk.ac.manchester.tornado.unittests.tasks.TestMultipleTasksSingleDevice",
+              testMethods=["testTasksSharingCallee"],
+              testParameters=["-Dtornado.opencl.schedule.program=True", "-Dgraal.MaximumInliningSize=0"]),
+    TestEntry(testName="uk.ac.manchester.tornado.unittests.tasks.TestSingleTaskSingleDevice",
+              testMethods=["testTieredCompilation"],
+              testParameters=["-Dtornado.tiered=True", "-Dtornado.tiered.threshold=2"]),
+    TestEntry(testName="uk.ac.manchester.tornado.unittests.tasks.TestMultipleTasksSingleDevice",
+              testMethods=["testIndependentTasks"],
+              testParameters=["-Dtornado.dag.scheduler=True"])
 ]
 
 ## List of tests that can be ignored. Format: class#testMethod
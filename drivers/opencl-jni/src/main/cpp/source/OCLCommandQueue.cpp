@@ -191,6 +191,50 @@ JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLCommandQ
     return (jlong) event;
 }
 
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_opencl_OCLCommandQueue
+ * Method:    clEnqueueCopyBufferToImage
+ * Signature: (JJJJJJ[J)J
+ */
+JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLCommandQueue_clEnqueueCopyBufferToImage
+(JNIEnv *env, jclass clazz, jlong queue_id, jlong src_buffer, jlong dst_image, jlong src_offset, jlong width, jlong height, jlongArray array) {
+    jlong *arrayEvents = static_cast<jlong *>((array != NULL) ? env->GetPrimitiveArrayCritical(array, NULL) : NULL);
+    jlong *events = (array != NULL) ? &arrayEvents[1] : NULL;
+    jsize len = (array != NULL) ? arrayEvents[0] : 0;
+
+    const size_t origin[3] = {0, 0, 0};
+    const size_t region[3] = {(size_t) width, (size_t) height, 1};
+    cl_event event;
+    cl_int status = clEnqueueCopyBufferToImage((cl_command_queue) queue_id, (cl_mem) src_buffer, (cl_mem) dst_image, (size_t) src_offset,
+                                               origin, region, (cl_uint) len, (cl_event *) events, &event);
+    LOG_OCL_AND_VALIDATE("clEnqueueCopyBufferToImage", status);
+    if (array != NULL) {
+        env->ReleasePrimitiveArrayCritical(array, arrayEvents, JNI_ABORT);
+    }
+    return (jlong) event;
+}
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_opencl_OCLCommandQueue
+ * Method:    clEnqueueCopyBuffer
+ * Signature: (JJJJJJ[J)J
+ */
+JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLCommandQueue_clEnqueueCopyBuffer
+(JNIEnv *env, jclass clazz, jlong queue_id, jlong src_buffer, jlong dst_buffer, jlong src_offset, jlong dst_offset, jlong num_bytes, jlongArray array) {
+    jlong *arrayEvents = static_cast<jlong *>((array != NULL) ? env->GetPrimitiveArrayCritical(array, NULL) : NULL);
+    jlong *events = (array != NULL) ? &arrayEvents[1] : NULL;
+    jsize len = (array != NULL) ? arrayEvents[0] : 0;
+
+    cl_event event;
+    cl_int status = clEnqueueCopyBuffer((cl_command_queue) queue_id, (cl_mem) src_buffer, (cl_mem) dst_buffer, (size_t) src_offset,
+                                        (size_t) dst_offset, (size_t) num_bytes, (cl_uint) len, (cl_event *) events, &event);
+    LOG_OCL_AND_VALIDATE("clEnqueueCopyBuffer", status);
+    if (array != NULL) {
+        env->ReleasePrimitiveArrayCritical(array, arrayEvents, JNI_ABORT);
+    }
+    return (jlong) event;
+}
+
 jlong transferFromHostToDevice(JNIEnv * env, jclass javaClass,
                                jlong commandQueue,          // Pointer to the OpenCL Command Queue
                                jbyteArray hostArray,        // Host Array
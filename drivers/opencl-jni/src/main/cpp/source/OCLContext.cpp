@@ -33,6 +33,7 @@
 #include <iostream>
 #include <cstring>
 #include "OCLContext.h"
+#include "host_arena.h"
 #include "ocl_log.h"
 
 /*
@@ -77,26 +78,14 @@ JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLContext_
 /*
  * Class:     uk_ac_manchester_tornado_drivers_opencl_OCLContext
  * Method:    allocateOffHeapMemory
- * Signature: (J)JJ
+ * Signature: (JJ)J
  */
 JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLContext_allocateOffHeapMemory
 (JNIEnv *env, jclass clazz, jlong size, jlong alignment) {
-    void *ptr;
-#if _WIN32
-    ptr = _aligned_malloc((size_t) alignment, (size_t) size);
-    if (ptr == 0) {
-        printf("OpenCL off-heap memory allocation (aligned_malloc) failed.\n");
-    }
-#else
-    int rc = posix_memalign(&ptr, (size_t) alignment, (size_t) size);
-    if (rc != 0) {
-        printf("OpenCL off-heap memory allocation (posix_memalign) failed. Error value: %d.\n", rc);
-    }
-#endif()
-    memset(ptr, 0, (size_t) size);
-    size_t i = 0;
-    for (; i < (size_t) size / 4; i++) {
-        ((int *) ptr)[i] = i;
+    // Pages are zero-filled by the OS on first touch
+    void *ptr = host_arena_allocate((size_t) size, (size_t) alignment);
+    if (ptr == NULL) {
+        printf("OpenCL off-heap memory allocation failed (%ld bytes).\n", (long) size);
     }
     return (jlong) ptr;
 }
@@ -104,11 +93,23 @@ JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLContext_
 /*
  * Class:     uk_ac_manchester_tornado_drivers_opencl_OCLContext
  * Method:    freeOffHeapMemory
- * Signature: (J)J
+ * Signature: (J)V
  */
 JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLContext_freeOffHeapMemory
 (JNIEnv *env, jclass clazz, jlong address) {
-    free((void *) address);
+    if (!host_arena_free((void *) address)) {
+        printf("OpenCL off-heap memory region not allocated by TornadoVM: %p\n", (void *) address);
+    }
+}
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_opencl_OCLContext
+ * Method:    releaseOffHeapMemoryPool
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLContext_releaseOffHeapMemoryPool
+(JNIEnv *env, jclass clazz) {
+    host_arena_release_free_regions();
 }
 
 /*
@@ -158,6 +159,29 @@ JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLContext_
     return (jlong) mem;
 }
 
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_opencl_OCLContext
+ * Method:    createImage2D
+ * Signature: (JJIIJJ)J
+ */
+JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLContext_createImage2D
+(JNIEnv *env, jclass clazz, jlong context_id, jlong flags, jint channel_order, jint channel_type, jlong width, jlong height) {
+    cl_image_format format;
+    format.image_channel_order = (cl_channel_order) channel_order;
+    format.image_channel_data_type = (cl_channel_type) channel_type;
+
+    cl_image_desc desc;
+    memset(&desc, 0, sizeof(cl_image_desc));
+    desc.image_type = CL_MEM_OBJECT_IMAGE2D;
+    desc.image_width = (size_t) width;
+    desc.image_height = (size_t) height;
+
+    cl_int status;
+    cl_mem mem = clCreateImage((cl_context) context_id, (cl_mem_flags) flags, &format, &desc, NULL, &status);
+    LOG_OCL_AND_VALIDATE("clCreateImage", status);
+    return (jlong) mem;
+}
+
 /*
  * Class:     uk_ac_manchester_tornado_drivers_opencl_OCLContext
  * Method:    clReleaseMemObject
@@ -69,6 +69,14 @@ JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLContext_
 JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLContext_freeOffHeapMemory
         (JNIEnv *, jclass, jlong);
 
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_opencl_OCLContext
+ * Method:    releaseOffHeapMemoryPool
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLContext_releaseOffHeapMemoryPool
+        (JNIEnv *, jclass);
+
 /*
  * Class:     uk_ac_manchester_tornado_drivers_opencl_OCLContext
  * Method:    asByteBuffer
@@ -93,6 +101,14 @@ JNIEXPORT jobject JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLContex
 JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLContext_createSubBuffer
         (JNIEnv *, jclass, jlong, jlong, jint, jbyteArray);
 
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_opencl_OCLContext
+ * Method:    createImage2D
+ * Signature: (JJIIJJ)J
+ */
+JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLContext_createImage2D
+        (JNIEnv *, jclass, jlong, jlong, jint, jint, jlong, jlong);
+
 /*
  * Class:     uk_ac_manchester_tornado_drivers_opencl_OCLContext
  * Method:    clReleaseMemObject
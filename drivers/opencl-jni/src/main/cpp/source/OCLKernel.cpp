@@ -76,3 +76,20 @@ JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLKernel_cl
     LOG_OCL_AND_VALIDATE("clGetKernelInfo", status);
     env->ReleasePrimitiveArrayCritical(array, value, 0);
 }
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_opencl_OCLKernel
+ * Method:    clGetKernelWorkGroupInfo
+ * Signature: (JJI[B)V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLKernel_clGetKernelWorkGroupInfo
+(JNIEnv *env, jclass clazz, jlong kernel_id, jlong device_id, jint work_group_info, jbyteArray array) {
+    jbyte *value;
+    jsize len;
+    value = static_cast<jbyte *>(env->GetPrimitiveArrayCritical(array, 0));
+    len = env->GetArrayLength(array);
+    size_t return_size = 0;
+    cl_int status = clGetKernelWorkGroupInfo((cl_kernel) kernel_id, (cl_device_id) device_id, (cl_kernel_work_group_info) work_group_info, len, (void *) value, &return_size);
+    LOG_OCL_AND_VALIDATE("clGetKernelWorkGroupInfo", status);
+    env->ReleasePrimitiveArrayCritical(array, value, 0);
+}
@@ -53,6 +53,14 @@ JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLKernel_cl
 JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLKernel_clGetKernelInfo
         (JNIEnv *, jclass, jlong, jint, jbyteArray);
 
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_opencl_OCLKernel
+ * Method:    clGetKernelWorkGroupInfo
+ * Signature: (JJI[B)V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OCLKernel_clGetKernelWorkGroupInfo
+        (JNIEnv *, jclass, jlong, jlong, jint, jbyteArray);
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,6 +33,11 @@
 
 #include <iostream>
 #include <stdio.h>
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 #include "OpenCL.h"
 #include "ocl_log.h"
 
@@ -68,3 +73,45 @@ JNIEXPORT jint JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OpenCL_clGet
     env->ReleasePrimitiveArrayCritical(array, platforms, 0);
     return (jint) num_platforms;
 }
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_opencl_OpenCL
+ * Method:    pinCurrentThread
+ * Signature: ([I)V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OpenCL_pinCurrentThread
+(JNIEnv *env, jclass clazz, jintArray cpus) {
+#ifdef __linux__
+    jsize len = env->GetArrayLength(cpus);
+    jint *native_cpus = env->GetIntArrayElements(cpus, NULL);
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int i = 0; i < len; i++) {
+        if (native_cpus[i] >= 0 && native_cpus[i] < CPU_SETSIZE) {
+            CPU_SET(native_cpus[i], &cpu_set);
+        }
+    }
+    env->ReleaseIntArrayElements(cpus, native_cpus, JNI_ABORT);
+    if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+        std::cout << "[TornadoVM-JNI] sched_setaffinity failed" << std::endl;
+    }
+#endif
+}
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_opencl_OpenCL
+ * Method:    setThreadMemoryNode
+ * Signature: (I)V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OpenCL_setThreadMemoryNode
+(JNIEnv *env, jclass clazz, jint node) {
+#ifdef __linux__
+    // MPOL_DEFAULT (0) restores the policy of the process, MPOL_PREFERRED (1) favours the given node
+    if (node < 0 || node >= (jint) (sizeof(unsigned long) * 8)) {
+        syscall(SYS_set_mempolicy, 0, NULL, 0);
+    } else {
+        unsigned long node_mask = 1UL << node;
+        syscall(SYS_set_mempolicy, 1, &node_mask, sizeof(node_mask) * 8);
+    }
+#endif
+}
@@ -57,6 +57,22 @@ JNIEXPORT jint JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OpenCL_clGet
 JNIEXPORT jint JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OpenCL_clGetPlatformIDs
         (JNIEnv *, jclass, jlongArray);
 
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_opencl_OpenCL
+ * Method:    pinCurrentThread
+ * Signature: ([I)V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OpenCL_pinCurrentThread
+        (JNIEnv *, jclass, jintArray);
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_opencl_OpenCL
+ * Method:    setThreadMemoryNode
+ * Signature: (I)V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_opencl_OpenCL_setThreadMemoryNode
+        (JNIEnv *, jclass, jint);
+
 #ifdef __cplusplus
 }
 #endif
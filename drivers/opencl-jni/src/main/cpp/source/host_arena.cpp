@@ -0,0 +1,182 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#if _WIN32
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "host_arena.h"
+
+#define MIN_SIZE_CLASS (64 * 1024)
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024)
+#define MAX_FREE_REGIONS_PER_CLASS 8
+
+/*
+    mapping         -- start of the mapping, already trimmed to the requested alignment
+    mapping_length  -- length in bytes of the mapping
+    size_class      -- usable length in bytes of the region
+*/
+typedef struct {
+    void *mapping;
+    size_t mapping_length;
+    size_t size_class;
+} ArenaRegion;
+
+static std::mutex arena_lock;
+static std::unordered_map<void *, ArenaRegion> used_regions;
+static std::unordered_map<size_t, std::vector<void *>> free_regions;
+static std::unordered_map<void *, ArenaRegion> free_region_info;
+
+static size_t size_class_of(size_t size) {
+    size_t size_class = MIN_SIZE_CLASS;
+    while (size_class < size) {
+        size_class <<= 1;
+    }
+    return size_class;
+}
+
+#if _WIN32
+
+void *host_arena_allocate(size_t size, size_t alignment) {
+    void *ptr = _aligned_malloc(size, alignment);
+    if (ptr != NULL) {
+        memset(ptr, 0, size);
+    }
+    return ptr;
+}
+
+bool host_arena_free(void *ptr) {
+    _aligned_free(ptr);
+    return true;
+}
+
+void host_arena_release_free_regions() {
+}
+
+#else
+
+static void *map_region(size_t size_class, size_t alignment, ArenaRegion *region) {
+    const size_t page_size = (size_t) sysconf(_SC_PAGESIZE);
+    if (size_class >= HUGE_PAGE_SIZE && alignment < HUGE_PAGE_SIZE) {
+        alignment = HUGE_PAGE_SIZE;
+    }
+    if (alignment < page_size) {
+        alignment = page_size;
+    }
+
+    size_t mapping_length = size_class + alignment - page_size;
+    void *mapping = mmap(NULL, mapping_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) {
+        return NULL;
+    }
+
+    // Trim the unaligned head and the unused tail of the mapping
+    uintptr_t start = (uintptr_t) mapping;
+    uintptr_t aligned = (start + alignment - 1) & ~((uintptr_t) alignment - 1);
+    if (aligned > start) {
+        munmap(mapping, aligned - start);
+    }
+    size_t tail = (start + mapping_length) - (aligned + size_class);
+    if (tail > 0) {
+        munmap((void *) (aligned + size_class), tail);
+    }
+
+#ifdef MADV_HUGEPAGE
+    if (size_class >= HUGE_PAGE_SIZE) {
+        madvise((void *) aligned, size_class, MADV_HUGEPAGE);
+    }
+#endif
+    region->mapping = (void *) aligned;
+    region->mapping_length = size_class;
+    region->size_class = size_class;
+    return (void *) aligned;
+}
+
+void *host_arena_allocate(size_t size, size_t alignment) {
+    const size_t size_class = size_class_of(size);
+    std::lock_guard<std::mutex> guard(arena_lock);
+
+    std::vector<void *> &bucket = free_regions[size_class];
+    for (auto it = bucket.begin(); it != bucket.end(); ++it) {
+        void *ptr = *it;
+        if (alignment == 0 || ((uintptr_t) ptr % alignment) == 0) {
+            bucket.erase(it);
+            used_regions[ptr] = free_region_info[ptr];
+            free_region_info.erase(ptr);
+#ifndef __linux__
+            // Only Linux guarantees zero-filled pages after MADV_DONTNEED
+            memset(ptr, 0, size_class);
+#endif
+            return ptr;
+        }
+    }
+
+    ArenaRegion region;
+    void *ptr = map_region(size_class, alignment, &region);
+    if (ptr != NULL) {
+        used_regions[ptr] = region;
+    }
+    return ptr;
+}
+
+bool host_arena_free(void *ptr) {
+    std::lock_guard<std::mutex> guard(arena_lock);
+    auto it = used_regions.find(ptr);
+    if (it == used_regions.end()) {
+        return false;
+    }
+    ArenaRegion region = it->second;
+    used_regions.erase(it);
+
+    std::vector<void *> &bucket = free_regions[region.size_class];
+    if (bucket.size() >= MAX_FREE_REGIONS_PER_CLASS) {
+        munmap(region.mapping, region.mapping_length);
+        return true;
+    }
+    // Hand the physical pages back; the virtual range is kept for reuse
+    madvise(region.mapping, region.mapping_length, MADV_DONTNEED);
+    bucket.push_back(ptr);
+    free_region_info[ptr] = region;
+    return true;
+}
+
+void host_arena_release_free_regions() {
+    std::lock_guard<std::mutex> guard(arena_lock);
+    for (auto &entry : free_region_info) {
+        munmap(entry.second.mapping, entry.second.mapping_length);
+    }
+    free_region_info.clear();
+    free_regions.clear();
+}
+
+#endif
@@ -0,0 +1,45 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+
+#ifndef host_arena_h
+#define host_arena_h
+
+#include <cstddef>
+
+/*
+    Pooled allocator for off-heap host buffers.
+
+    Regions are rounded up to power-of-two size classes and mapped directly from the OS, so they are zero-filled
+    lazily on first touch. Regions of 2MB or more are aligned to 2MB and advised for transparent huge pages.
+    Freed regions are kept in per-size-class buckets and their pages are handed back to the OS, so a recycled
+    region is again zero-filled on demand.
+*/
+
+void *host_arena_allocate(size_t size, size_t alignment);
+
+bool host_arena_free(void *ptr);
+
+void host_arena_release_free_regions();
+
+#endif
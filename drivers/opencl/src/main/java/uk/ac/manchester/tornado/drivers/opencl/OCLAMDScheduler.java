@@ -57,7 +57,7 @@ public class OCLAMDScheduler extends OCLKernelScheduler {
     }
 
     @Override
-    public void calculateLocalWork(final TaskMetaData meta) {
+    public void calculateLocalWork(final TaskMetaData meta, final OCLKernel kernel) {
         final long[] localWork = meta.getLocalWork();
         switch (meta.getDims()) {
             case 3:
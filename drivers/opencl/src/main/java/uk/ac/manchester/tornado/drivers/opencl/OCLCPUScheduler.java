@@ -48,7 +48,7 @@ public class OCLCPUScheduler extends OCLKernelScheduler {
     }
 
     @Override
-    public void calculateLocalWork(final TaskMetaData meta) {
+    public void calculateLocalWork(final TaskMetaData meta, final OCLKernel kernel) {
         meta.setLocalWorkToNull();
     }
 
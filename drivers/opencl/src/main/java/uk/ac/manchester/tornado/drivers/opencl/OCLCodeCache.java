@@ -44,8 +44,13 @@ import java.io.IOException;
 import java.nio.file.Files;
 import java.nio.file.Path;
 import java.nio.file.Paths;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.HashMap;
+import java.util.HashSet;
+import java.util.List;
 import java.util.StringJoiner;
 import java.util.concurrent.ConcurrentHashMap;
 
@@ -58,6 +63,7 @@ import uk.ac.manchester.tornado.drivers.opencl.graal.OCLInstalledCode;
 import uk.ac.manchester.tornado.runtime.common.RuntimeUtilities;
 import uk.ac.manchester.tornado.runtime.common.Tornado;
 import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
+import uk.ac.manchester.tornado.runtime.domain.DomainTree;
 import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
 
 public class OCLCodeCache {
@@ -89,6 +95,9 @@ public class OCLCodeCache {
 
     private ArrayList<String> linkObjectFiles;
 
+    // TaskSchedule -> Sources waiting to be built as a single program
+    private final ConcurrentHashMap<String, PendingProgram> pendingPrograms;
+
     /**
      * OpenCL Binary Options: -Dtornado.precompiled.binary=<path/to/binary,task>
      *
@@ -107,6 +116,17 @@ public class OCLCodeCache {
     private final ConcurrentHashMap<String, OCLInstalledCode> cache;
     private final OCLDeviceContextInterface deviceContext;
 
+    // Specialisation key -> Kernel shared by the tasks of any task-schedule
+    private final ConcurrentHashMap<String, SharedKernel> sharedKernels;
+
+    /*
+     * Source and build flags -> Program already built for an identical kernel.
+     * The program is handed to every installed code with the same source, and
+     * none of them owns it: invalidating an installed code releases only its
+     * own kernels, never the program. Programs live as long as the context.
+     */
+    private final ConcurrentHashMap<ProgramKey, OCLProgram> sharedPrograms;
+
     private boolean kernelAvailable;
 
     private HashMap<String, String> precompiledBinariesPerDevice;
@@ -121,10 +141,129 @@ public class OCLCodeCache {
         }
     }
 
+    private static class PendingSource {
+        private final TaskMetaData meta;
+        private final String id;
+        private final String entryPoint;
+        private final byte[] source;
+        private final List<OCLSourceDefinition> definitions;
+        private final OCLInstalledCode code;
+
+        PendingSource(TaskMetaData meta, String id, String entryPoint, byte[] source, List<OCLSourceDefinition> definitions, OCLInstalledCode code) {
+            this.meta = meta;
+            this.id = id;
+            this.entryPoint = entryPoint;
+            this.source = source;
+            this.definitions = definitions;
+            this.code = code;
+        }
+    }
+
+    /**
+     * Kernel generated for a method, specialisation and device, together with
+     * the metadata that the compilation records in the task.
+     */
+    private static class SharedKernel {
+        private final String entryPoint;
+        private final byte[] source;
+        private final DomainTree domain;
+        private final int[] constantParameters;
+
+        SharedKernel(String entryPoint, byte[] source, DomainTree domain, int[] constantParameters) {
+            this.entryPoint = entryPoint;
+            this.source = source;
+            this.domain = domain;
+            this.constantParameters = constantParameters;
+        }
+    }
+
+    private static class ProgramKey {
+        private final String compilerFlags;
+        private final byte[] source;
+
+        ProgramKey(String compilerFlags, byte[] source) {
+            this.compilerFlags = compilerFlags;
+            this.source = source;
+        }
+
+        @Override
+        public boolean equals(Object other) {
+            if (!(other instanceof ProgramKey)) {
+                return false;
+            }
+            final ProgramKey key = (ProgramKey) other;
+            return compilerFlags.equals(key.compilerFlags) && Arrays.equals(source, key.source);
+        }
+
+        @Override
+        public int hashCode() {
+            return 31 * compilerFlags.hashCode() + Arrays.hashCode(source);
+        }
+    }
+
+    /**
+     * Sources of the tasks of a task-schedule that are built together as a
+     * single OpenCL program. The program is built the first time one of its
+     * kernels is requested.
+     */
+    public static class PendingProgram {
+        private final OCLCodeCache codeCache;
+        private final String taskScheduleName;
+        private final String compilerFlags;
+        private final ArrayList<PendingSource> sources;
+        private final HashMap<String, String> functions;
+        private boolean linked;
+
+        PendingProgram(OCLCodeCache codeCache, String taskScheduleName, String compilerFlags) {
+            this.codeCache = codeCache;
+            this.taskScheduleName = taskScheduleName;
+            this.compilerFlags = compilerFlags;
+            this.sources = new ArrayList<>();
+            this.functions = new HashMap<>();
+        }
+
+        private synchronized boolean accepts(String flags, List<OCLSourceDefinition> definitions) {
+            if (linked || !compilerFlags.equals(flags)) {
+                return false;
+            }
+            // Kernels and helpers with the same name can only share the program if they are identical
+            for (OCLSourceDefinition definition : definitions) {
+                final String function = (definition.getName() != null) ? functions.get(definition.getName()) : null;
+                if (function != null && !function.equals(definition.getText())) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        private synchronized void add(PendingSource pending) {
+            sources.add(pending);
+            for (OCLSourceDefinition definition : pending.definitions) {
+                if (definition.getName() != null) {
+                    functions.putIfAbsent(definition.getName(), definition.getText());
+                }
+            }
+        }
+
+        public void link() {
+            // Stop accepting sources before locking the program
+            codeCache.pendingPrograms.remove(taskScheduleName, this);
+            synchronized (this) {
+                if (!linked) {
+                    linked = true;
+                    codeCache.buildPendingProgram(this);
+                }
+            }
+        }
+    }
+
     public OCLCodeCache(OCLDeviceContextInterface deviceContext) {
         this.deviceContext = deviceContext;
         cache = new ConcurrentHashMap<>();
         pendingTasks = new ConcurrentHashMap<>();
+        pendingPrograms = new ConcurrentHashMap<>();
+        sharedKernels = new ConcurrentHashMap<>();
+        sharedPrograms = new ConcurrentHashMap<>();
         linkObjectFiles = new ArrayList<>();
 
         if (deviceContext.isPlatformFPGA()) {
@@ -435,6 +574,30 @@ public class OCLCodeCache {
     }
 
     public OCLInstalledCode installSource(TaskMetaData meta, String id, String entryPoint, byte[] source) {
+        final OCLInstalledCode code = buildSource(meta, id, entryPoint, source);
+        if (code.isValid()) {
+            cache.put(id + "-" + entryPoint, code);
+        }
+        return code;
+    }
+
+    /**
+     * Builds the source of a task without registering it in the code cache. This
+     * is used by tiered compilation, where the optimised kernel is swapped into
+     * the code installed by the quick tier.
+     */
+    public OCLInstalledCode buildSource(TaskMetaData meta, String id, String entryPoint, byte[] source) {
+
+        final boolean isAccelerator = deviceContext.getDevice().getDeviceType() == OCLDeviceType.CL_DEVICE_TYPE_ACCELERATOR;
+        final ProgramKey programKey = new ProgramKey(meta.getCompilerFlags(), source);
+        final OCLProgram sharedProgram = isAccelerator ? null : sharedPrograms.get(programKey);
+        if (sharedProgram != null) {
+            final OCLKernel kernel = sharedProgram.getKernel(entryPoint);
+            if (kernel != null) {
+                info("Reusing the program of an identical kernel for %s", entryPoint);
+                return new OCLInstalledCode(entryPoint, source, (OCLDeviceContext) deviceContext, sharedProgram, kernel);
+            }
+        }
 
         info("Installing code for %s into code cache", entryPoint);
         final OCLProgram program = deviceContext.createProgramWithSource(source, new long[] { source.length });
@@ -449,7 +612,7 @@ public class OCLCodeCache {
             }
         }
 
-        if (deviceContext.getDevice().getDeviceType() == OCLDeviceType.CL_DEVICE_TYPE_ACCELERATOR) {
+        if (isAccelerator) {
             appendSourceToFile(entryPoint, source);
         }
 
@@ -500,10 +663,12 @@ public class OCLCodeCache {
 
         if (status == CL_BUILD_SUCCESS) {
             debug("\tOpenCL Kernel id = 0x%x", kernel.getOclKernelID());
+            if (!isAccelerator) {
+                sharedPrograms.putIfAbsent(programKey, program);
+            }
             if (meta.shouldPrintCompileTimes()) {
                 debug("compile: kernel %s opencl %.9f\n", entryPoint, (t1 - t0) * 1e-9f);
             }
-            cache.put(id + "-" + entryPoint, code);
 
             // BUG Apple does not seem to like implementing the OpenCL spec
             // properly, this causes a sigfault.
@@ -519,6 +684,199 @@ public class OCLCodeCache {
         return code;
     }
 
+    /**
+     * Records the kernel generated for a specialisation key, so that tasks of
+     * other task-schedules with the same key skip the compilation.
+     */
+    public void registerSharedKernel(String key, TaskMetaData meta, String entryPoint, byte[] source) {
+        sharedKernels.putIfAbsent(key, new SharedKernel(entryPoint, source, meta.getDomain(), meta.getConstantParameters()));
+    }
+
+    /**
+     * Installs the kernel shared under a specialisation key for a new task, and
+     * restores the metadata that its compilation recorded.
+     *
+     * @return the installed code, or null if no kernel was shared under the key
+     */
+    public OCLInstalledCode installSharedKernel(String key, TaskMetaData meta, String id) {
+        final SharedKernel shared = sharedKernels.get(key);
+        if (shared == null) {
+            return null;
+        }
+        debug("Sharing kernel %s with task %s", shared.entryPoint, id);
+        if (shared.domain != null) {
+            final DomainTree domain = new DomainTree(shared.domain.getDepth());
+            for (int i = 0; i < domain.getDepth(); i++) {
+                domain.set(i, shared.domain.get(i));
+            }
+            meta.setDomain(domain);
+        }
+        meta.setConstantParameters(shared.constantParameters);
+        return installSource(meta, id, shared.entryPoint, shared.source);
+    }
+
+    /**
+     * Registers the source of a task to be built, together with the rest of the
+     * tasks of the same task-schedule, as a single OpenCL program. The returned
+     * code creates its kernel from the shared program on its first launch.
+     */
+    public OCLInstalledCode installScheduleSource(TaskMetaData meta, String id, String entryPoint, byte[] source) {
+        info("Deferring code for %s into the program of its task-schedule", entryPoint);
+        final String taskScheduleName = splitTaskScheduleAndTaskName(id)[0];
+        final String flags = meta.getCompilerFlags();
+        final List<OCLSourceDefinition> definitions = OCLSourceDefinition.split(source);
+        final PendingProgram pendingProgram = pendingPrograms.compute(taskScheduleName,
+                (name, current) -> (current != null && current.accepts(flags, definitions)) ? current : new PendingProgram(this, name, flags));
+
+        final OCLInstalledCode code = new OCLInstalledCode(entryPoint, source, (OCLDeviceContext) deviceContext, pendingProgram);
+        pendingProgram.add(new PendingSource(meta, id, entryPoint, source, definitions, code));
+        cache.put(id + "-" + entryPoint, code);
+        return code;
+    }
+
+    private void buildPendingProgram(PendingProgram pendingProgram) {
+        // Concatenate the sources, emitting the functions and declarations
+        // that several tasks define only once
+        final HashSet<String> entryPoints = new HashSet<>();
+        final HashSet<String> functions = new HashSet<>();
+        final HashSet<String> declarations = new HashSet<>();
+        final StringBuilder programSource = new StringBuilder();
+        for (PendingSource pending : pendingProgram.sources) {
+            entryPoints.add(pending.entryPoint);
+            for (OCLSourceDefinition definition : pending.definitions) {
+                final boolean emit;
+                if (definition.isDirective()) {
+                    emit = true;
+                } else if (definition.getName() != null) {
+                    emit = functions.add(definition.getName());
+                } else {
+                    emit = declarations.add(definition.getText());
+                }
+                if (emit) {
+                    programSource.append(definition.getText()).append('\n');
+                }
+            }
+        }
+        final byte[] source = programSource.toString().getBytes();
+        final String identifier = pendingProgram.taskScheduleName + "-program";
+        final boolean cacheBinaries = (OPENCL_CACHE_ENABLE || OPENCL_DUMP_BINS) && !deviceContext.getPlatformContext().getPlatform().getVendor().equalsIgnoreCase("Apple");
+        final String binaryFile = cacheBinaries ? resolveCacheDirectory().toAbsolutePath().toString() + "/" + identifier + "-" + programDigest(pendingProgram.compilerFlags, source) : null;
+
+        info("Building %d kernels of %s as a single program", entryPoints.size(), pendingProgram.taskScheduleName);
+        OCLProgram program = (OPENCL_CACHE_ENABLE && cacheBinaries) ? loadProgramBinary(binaryFile) : null;
+        if (program != null) {
+            info("Loaded the binary of %s from %s", pendingProgram.taskScheduleName, binaryFile);
+            bindPendingProgram(pendingProgram, program);
+            return;
+        }
+        program = deviceContext.createProgramWithSource(source, new long[] { source.length });
+
+        if (OPENCL_DUMP_SOURCE) {
+            final Path outDir = resolveSourceDirectory();
+            File file = new File(outDir + "/" + identifier + OPENCL_SOURCE_SUFFIX);
+            try (FileOutputStream fos = new FileOutputStream(file)) {
+                fos.write(source);
+            } catch (IOException e) {
+                error("unable to dump source: ", e.getMessage());
+            }
+        }
+
+        RuntimeUtilities.maybePrintSource(source);
+
+        final long t0 = System.nanoTime();
+        program.build(pendingProgram.compilerFlags);
+        final long t1 = System.nanoTime();
+
+        final OCLBuildStatus status = program.getStatus(deviceContext.getDeviceId());
+        debug("\tOpenCL compilation status = %s", status.toString());
+
+        if (status != CL_BUILD_SUCCESS) {
+            // e.g., helper functions defined by more than one task
+            final String log = program.getBuildLog(deviceContext.getDeviceId()).trim();
+            if (!log.isEmpty()) {
+                debug(log);
+            }
+            warn("\tunable to build %s as a single program, building one program per task", pendingProgram.taskScheduleName);
+            for (PendingSource pending : pendingProgram.sources) {
+                final OCLInstalledCode standalone = installSource(pending.meta, pending.id, pending.entryPoint, pending.source);
+                pending.code.bind(standalone.getProgram(), standalone.getKernel());
+                cache.put(pending.id + "-" + pending.entryPoint, pending.code);
+            }
+            return;
+        }
+
+        if (pendingProgram.sources.get(0).meta.shouldPrintCompileTimes()) {
+            debug("compile: program %s opencl %.9f\n", pendingProgram.taskScheduleName, (t1 - t0) * 1e-9f);
+        }
+
+        bindPendingProgram(pendingProgram, program);
+
+        // The binary is keyed by the source and flags of the whole program,
+        // so that the next run with the code cache enabled skips the build
+        if (cacheBinaries) {
+            program.dumpBinaries(binaryFile);
+        }
+    }
+
+    private void bindPendingProgram(PendingProgram pendingProgram, OCLProgram program) {
+        for (PendingSource pending : pendingProgram.sources) {
+            final OCLKernel kernel = program.getKernel(pending.entryPoint);
+            if (kernel != null) {
+                debug("\tOpenCL Kernel id = 0x%x", kernel.getOclKernelID());
+                kernelAvailable = true;
+            } else {
+                warn("\tunable to create kernel %s", pending.entryPoint);
+            }
+            pending.code.bind(program, kernel);
+        }
+    }
+
+    /**
+     * Loads the binary dumped by a previous build of the same program.
+     *
+     * @return the program, or null if there is no binary or it does not build
+     *         for this device
+     */
+    private OCLProgram loadProgramBinary(String binaryFile) {
+        final Path path = Paths.get(binaryFile);
+        if (!Files.exists(path)) {
+            return null;
+        }
+        try {
+            final byte[] binary = Files.readAllBytes(path);
+            final OCLProgram program = deviceContext.createProgramWithBinary(binary, new long[] { binary.length });
+            if (program == null) {
+                return null;
+            }
+            program.build("");
+            if (program.getStatus(deviceContext.getDeviceId()) != CL_BUILD_SUCCESS) {
+                warn("\tunable to build binary %s, building from source", binaryFile);
+                program.cleanup();
+                return null;
+            }
+            return program;
+        } catch (IOException e) {
+            error("unable to read binary: %s", e.getMessage());
+            return null;
+        }
+    }
+
+    private static String programDigest(String compilerFlags, byte[] source) {
+        try {
+            final MessageDigest digest = MessageDigest.getInstance("SHA-256");
+            digest.update(compilerFlags.getBytes());
+            digest.update((byte) 0);
+            digest.update(source);
+            final StringBuilder hex = new StringBuilder();
+            for (byte b : digest.digest()) {
+                hex.append(String.format("%02x", b));
+            }
+            return hex.toString();
+        } catch (NoSuchAlgorithmException e) {
+            throw new TornadoRuntimeException(e);
+        }
+    }
+
     private OCLInstalledCode installBinary(String id, String entryPoint, byte[] binary) throws OCLException {
         info("Installing binary for %s into code cache", entryPoint);
 
@@ -599,6 +957,9 @@ public class OCLCodeCache {
             code.invalidate();
         }
         cache.clear();
+        pendingPrograms.clear();
+        sharedKernels.clear();
+        sharedPrograms.clear();
     }
 
     public OCLInstalledCode installEntryPointForBinaryForFPGAs(String id, Path lookupPath, String entrypoint) {
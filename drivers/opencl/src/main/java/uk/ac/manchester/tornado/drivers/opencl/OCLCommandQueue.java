@@ -119,6 +119,10 @@ public class OCLCommandQueue extends TornadoLogger {
 
     native static long clEnqueueBarrierWithWaitList(long queueId, long[] events) throws OCLException;
 
+    native static long clEnqueueCopyBufferToImage(long queueId, long srcBuffer, long dstImage, long srcOffset, long width, long height, long[] events) throws OCLException;
+
+    native static long clEnqueueCopyBuffer(long queueId, long srcBuffer, long dstBuffer, long srcOffset, long dstOffset, long numBytes, long[] events) throws OCLException;
+
     native static void clFlush(long queueId) throws OCLException;
 
     native static void clFinish(long queueId) throws OCLException;
@@ -379,6 +383,32 @@ public class OCLCommandQueue extends TornadoLogger {
         return -1;
     }
 
+    /**
+     * Copies a region of {@code width * height} pixels starting at
+     * {@code srcOffset} in a buffer into a 2D image.
+     */
+    public long enqueueCopyBufferToImage(long srcBuffer, long srcOffset, long dstImage, long width, long height, long[] waitEvents) {
+        try {
+            return clEnqueueCopyBufferToImage(commandQueue, srcBuffer, dstImage, srcOffset, width, height, waitEvents);
+        } catch (OCLException e) {
+            error(e.getMessage());
+        }
+        return -1;
+    }
+
+    /**
+     * Copies {@code numBytes} between two buffers of the same OpenCL context,
+     * which may belong to different devices.
+     */
+    public long enqueueCopyBuffer(long srcBuffer, long srcOffset, long dstBuffer, long dstOffset, long numBytes, long[] waitEvents) {
+        try {
+            return clEnqueueCopyBuffer(commandQueue, srcBuffer, dstBuffer, srcOffset, dstOffset, numBytes, waitEvents);
+        } catch (OCLException e) {
+            error(e.getMessage());
+        }
+        return -1;
+    }
+
     public long enqueueMarker(long[] waitEvents) {
         if (MARKER_USE_BARRIER) {
             return enqueueBarrier(waitEvents);
@@ -31,6 +31,7 @@ import static uk.ac.manchester.tornado.drivers.opencl.enums.OCLCommandQueuePrope
 import static uk.ac.manchester.tornado.drivers.opencl.enums.OCLCommandQueueProperties.CL_QUEUE_PROFILING_ENABLE;
 import static uk.ac.manchester.tornado.runtime.common.Tornado.ENABLE_OOO_EXECUTION;
 import static uk.ac.manchester.tornado.runtime.common.Tornado.ENABLE_PROFILING;
+import static uk.ac.manchester.tornado.runtime.common.TornadoOptions.DAG_SCHEDULER;
 import static uk.ac.manchester.tornado.runtime.common.TornadoOptions.DUMP_EVENTS;
 
 import java.nio.ByteBuffer;
@@ -38,6 +39,8 @@ import java.util.ArrayList;
 import java.util.List;
 
 import uk.ac.manchester.tornado.api.exceptions.TornadoInternalError;
+import uk.ac.manchester.tornado.drivers.opencl.enums.OCLImageChannelOrder;
+import uk.ac.manchester.tornado.drivers.opencl.enums.OCLImageChannelType;
 import uk.ac.manchester.tornado.drivers.opencl.exceptions.OCLException;
 import uk.ac.manchester.tornado.runtime.common.RuntimeUtilities;
 import uk.ac.manchester.tornado.runtime.common.Tornado;
@@ -98,6 +101,8 @@ public class OCLContext extends TornadoLogger implements OCLExecutionEnvironment
 
     native static void freeOffHeapMemory(long address);
 
+    native static void releaseOffHeapMemoryPool();
+
     native static ByteBuffer asByteBuffer(long address, long size);
 
     // creates an empty buffer on the device
@@ -105,6 +110,8 @@ public class OCLContext extends TornadoLogger implements OCLExecutionEnvironment
 
     native static long createSubBuffer(long buffer, long flags, int createType, byte[] createInfo) throws OCLException;
 
+    native static long createImage2D(long contextId, long flags, int channelOrder, int channelType, long width, long height) throws OCLException;
+
     native static void clReleaseMemObject(long memId) throws OCLException;
 
     native static long clCreateProgramWithSource(long contextId, byte[] data, long lengths[]) throws OCLException;
@@ -146,7 +153,7 @@ public class OCLContext extends TornadoLogger implements OCLExecutionEnvironment
             properties |= CL_QUEUE_PROFILING_ENABLE;
         }
 
-        if (ENABLE_OOO_EXECUTION) {
+        if (ENABLE_OOO_EXECUTION || DAG_SCHEDULER) {
             properties |= CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE;
         }
         createCommandQueue(index, properties);
@@ -161,7 +168,7 @@ public class OCLContext extends TornadoLogger implements OCLExecutionEnvironment
     public void createAllCommandQueues() {
         long properties = 0;
         properties |= CL_QUEUE_PROFILING_ENABLE;
-        if (ENABLE_OOO_EXECUTION) {
+        if (ENABLE_OOO_EXECUTION || DAG_SCHEDULER) {
             properties |= CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE;
         }
         createAllCommandQueues(properties);
@@ -210,6 +217,7 @@ public class OCLContext extends TornadoLogger implements OCLExecutionEnvironment
             for (Long allocatedRegion : allocatedRegions) {
                 clReleaseMemObject(allocatedRegion);
             }
+            releaseOffHeapMemoryPool();
             long t2 = System.nanoTime();
 
             for (OCLCommandQueue queue : queues) {
@@ -249,7 +257,8 @@ public class OCLContext extends TornadoLogger implements OCLExecutionEnvironment
     }
 
     /**
-     * Allocates off-heap memory.
+     * Allocates zero-filled off-heap memory from the native pool. Regions of 2MB
+     * or more are backed by transparent huge pages when the OS supports them.
      *
      * @param bytes
      *            to be allocated.
@@ -266,6 +275,22 @@ public class OCLContext extends TornadoLogger implements OCLExecutionEnvironment
         return address;
     }
 
+    /**
+     * Returns a region obtained with {@link #allocate(long, long)} to the pool.
+     * Any {@link ByteBuffer} created over the region must not be used afterwards.
+     */
+    public void free(long address) {
+        freeOffHeapMemory(address);
+    }
+
+    /**
+     * Allocates off-heap memory from the native pool and exposes it as a direct
+     * {@link ByteBuffer}.
+     */
+    public ByteBuffer allocateByteBuffer(long bytes, long alignment) {
+        return toByteBuffer(allocate(bytes, alignment), bytes);
+    }
+
     public ByteBuffer toByteBuffer(long address, long bytes) {
         final ByteBuffer buffer = asByteBuffer(address, bytes);
         buffer.order(OpenCL.BYTE_ORDER);
@@ -289,6 +314,27 @@ public class OCLContext extends TornadoLogger implements OCLExecutionEnvironment
         return devicePtr;
     }
 
+    public long createImage2D(long flags, OCLImageChannelOrder channelOrder, OCLImageChannelType channelType, long width, long height) {
+        long imageId = 0;
+        try {
+            imageId = createImage2D(contextID, flags, channelOrder.getValue(), channelType.getValue(), width, height);
+            allocatedRegions.add(imageId);
+            info("image allocated %dx%d %s/%s @ 0x%x", width, height, channelOrder, channelType, imageId);
+        } catch (OCLException e) {
+            error(e.getMessage());
+        }
+        return imageId;
+    }
+
+    public void releaseBuffer(long bufferId) {
+        try {
+            clReleaseMemObject(bufferId);
+            allocatedRegions.remove(Long.valueOf(bufferId));
+        } catch (OCLException e) {
+            error(e.getMessage());
+        }
+    }
+
     public int getPlatformIndex() {
         return platform.getIndex();
     }
@@ -30,6 +30,7 @@ package uk.ac.manchester.tornado.drivers.opencl;
 import uk.ac.manchester.tornado.drivers.opencl.enums.OCLDeviceInfo;
 import uk.ac.manchester.tornado.drivers.opencl.enums.OCLDeviceType;
 import uk.ac.manchester.tornado.drivers.opencl.enums.OCLLocalMemType;
+import uk.ac.manchester.tornado.runtime.common.NumaTopology;
 import uk.ac.manchester.tornado.runtime.common.RuntimeUtilities;
 import uk.ac.manchester.tornado.runtime.common.TornadoLogger;
 
@@ -75,6 +76,9 @@ public class OCLDevice extends TornadoLogger implements OCLTargetDevice {
     private int deviceAddressBits;
     private OCLLocalMemType localMemoryType;
     private int deviceVendorID;
+    private int numaNode;
+
+    private static final int AMD_TOPOLOGY_TYPE_PCIE = 1;
 
     public OCLDevice(int index, long id) {
         this.index = index;
@@ -110,6 +114,7 @@ public class OCLDevice extends TornadoLogger implements OCLTargetDevice {
         this.deviceAddressBits = INIT_VALUE;
         this.localMemoryType = null;
         this.deviceVendorID = INIT_VALUE;
+        this.numaNode = Integer.MIN_VALUE;
     }
 
     private void obtainDeviceProperties() {
@@ -176,11 +181,62 @@ public class OCLDevice extends TornadoLogger implements OCLTargetDevice {
         return deviceMemoryBaseAligment;
     }
 
+    /**
+     * Obtains the PCI address of the device through the vendor extensions that
+     * report it, and looks up its NUMA node in sysfs.
+     *
+     * @return the NUMA node closest to the device, or
+     *         {@link NumaTopology#UNKNOWN_NODE}.
+     */
+    @Override
+    public int getNumaNode() {
+        if (numaNode == Integer.MIN_VALUE) {
+            numaNode = NumaTopology.getInstance().getNodeOfPCIDevice(getPCIBusId());
+        }
+        return numaNode;
+    }
+
+    private String getPCIBusId() {
+        final String extensions = getDeviceExtensions();
+        if (extensions.contains("cl_khr_pci_bus_info")) {
+            queryOpenCLAPI(OCLDeviceInfo.CL_DEVICE_PCI_BUS_INFO_KHR.getValue());
+            int domain = buffer.getInt();
+            int bus = buffer.getInt();
+            int device = buffer.getInt();
+            int function = buffer.getInt();
+            return NumaTopology.formatPCIBusId(domain, bus, device, function);
+        } else if (extensions.contains("cl_nv_device_attribute_query")) {
+            queryOpenCLAPI(OCLDeviceInfo.CL_DEVICE_PCI_BUS_ID_NV.getValue());
+            int bus = buffer.getInt();
+            queryOpenCLAPI(OCLDeviceInfo.CL_DEVICE_PCI_SLOT_ID_NV.getValue());
+            int slot = buffer.getInt();
+            // The slot id encodes the device in its upper 5 bits
+            return NumaTopology.formatPCIBusId(0, bus, slot >> 3, slot & 0x7);
+        } else if (extensions.contains("cl_amd_device_attribute_query")) {
+            queryOpenCLAPI(OCLDeviceInfo.CL_DEVICE_TOPOLOGY_AMD.getValue());
+            if (buffer.getInt() != AMD_TOPOLOGY_TYPE_PCIE) {
+                return null;
+            }
+            // cl_device_topology_amd: type, 17 unused bytes, bus, device and function
+            int bus = buffer.get(21) & 0xFF;
+            int device = buffer.get(22) & 0xFF;
+            int function = buffer.get(23) & 0xFF;
+            return NumaTopology.formatPCIBusId(0, bus, device, function);
+        }
+        return null;
+    }
+
     public boolean isDeviceAvailable() {
         queryOpenCLAPI(OCLDeviceInfo.CL_DEVICE_AVAILABLE.getValue());
         return buffer.getInt() == 1;
     }
 
+    @Override
+    public boolean isDeviceImageSupported() {
+        queryOpenCLAPI(OCLDeviceInfo.CL_DEVICE_IMAGE_SUPPORT.getValue());
+        return buffer.getInt() == 1;
+    }
+
     @Override
     public String getDeviceName() {
         if (name == null) {
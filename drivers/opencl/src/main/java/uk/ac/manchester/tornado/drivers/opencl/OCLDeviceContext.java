@@ -29,6 +29,8 @@ package uk.ac.manchester.tornado.drivers.opencl;
 
 import static uk.ac.manchester.tornado.drivers.opencl.OCLCommandQueue.EMPTY_EVENT;
 import static uk.ac.manchester.tornado.drivers.opencl.OCLEvent.DEFAULT_TAG;
+import static uk.ac.manchester.tornado.drivers.opencl.OCLEvent.DESC_COPY_BUFFER_PEER;
+import static uk.ac.manchester.tornado.drivers.opencl.OCLEvent.DESC_COPY_BUFFER_TO_IMAGE;
 import static uk.ac.manchester.tornado.drivers.opencl.OCLEvent.DESC_PARALLEL_KERNEL;
 import static uk.ac.manchester.tornado.drivers.opencl.OCLEvent.DESC_READ_BYTE;
 import static uk.ac.manchester.tornado.drivers.opencl.OCLEvent.DESC_READ_DOUBLE;
@@ -51,6 +53,7 @@ import java.nio.ByteOrder;
 import java.util.Arrays;
 import java.util.Comparator;
 import java.util.List;
+import java.util.concurrent.atomic.AtomicLong;
 
 import uk.ac.manchester.tornado.api.common.Event;
 import uk.ac.manchester.tornado.api.common.SchedulableTask;
@@ -86,6 +89,9 @@ public class OCLDeviceContext extends TornadoLogger implements Initialisable, OC
 
     private final OCLEventsWrapper eventsWrapper;
 
+    // Writes enqueued to device buffers, see OCLConstantRegion
+    private final AtomicLong bufferWrites;
+
     protected OCLDeviceContext(OCLTargetDevice device, OCLCommandQueue queue, OCLContext context) {
         this.device = device;
         this.queue = queue;
@@ -96,6 +102,7 @@ public class OCLDeviceContext extends TornadoLogger implements Initialisable, OC
         setRelativeAddressesFlag();
 
         this.eventsWrapper = new OCLEventsWrapper();
+        this.bufferWrites = new AtomicLong();
 
         needsBump = false;
         for (String bumpDevice : BUMP_DEVICES) {
@@ -184,10 +191,41 @@ public class OCLDeviceContext extends TornadoLogger implements Initialisable, OC
 
     public int enqueueNDRangeKernel(OCLKernel kernel, int dim, long[] globalWorkOffset, long[] globalWorkSize, long[] localWorkSize, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueNDRangeKernel(kernel, dim, globalWorkOffset, globalWorkSize, localWorkSize, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueNDRangeKernel(kernel, dim, globalWorkOffset, globalWorkSize, localWorkSize, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_PARALLEL_KERNEL, kernel.getOclKernelID(), queue);
     }
 
+    public int enqueueCopyBufferToImage(long bufferId, long offset, long imageId, long width, long height, int[] waitEvents) {
+        return eventsWrapper.registerEvent(
+                queue.enqueueCopyBufferToImage(bufferId, offset, imageId, width, height, eventsWrapper.serialiseEvents(waitEvents, queue)),
+                DESC_COPY_BUFFER_TO_IMAGE, offset, queue);
+    }
+
+    public int enqueueCopyBuffer(long srcBufferId, long srcOffset, long dstBufferId, long dstOffset, long numBytes, int[] waitEvents) {
+        return eventsWrapper.registerEvent(
+                queue.enqueueCopyBuffer(srcBufferId, srcOffset, dstBufferId, dstOffset, numBytes, eventsWrapper.serialiseEvents(waitEvents, queue)),
+                DESC_COPY_BUFFER_PEER, dstOffset, queue);
+    }
+
+    /**
+     * @return the number of writes to device buffers so far: host writes,
+     *         copies between buffers and kernel launches that write their
+     *         arguments.
+     */
+    public long getBufferWrites() {
+        return bufferWrites.get();
+    }
+
+    /**
+     * Records a write to device buffers made without the write methods of the
+     * context, e.g., by a kernel.
+     *
+     * @return the number of writes, including this one.
+     */
+    public long markBuffersWritten() {
+        return bufferWrites.incrementAndGet();
+    }
+
     public ByteOrder getByteOrder() {
         return device.isLittleEndian() ? ByteOrder.LITTLE_ENDIAN : ByteOrder.BIG_ENDIAN;
     }
@@ -196,44 +234,51 @@ public class OCLDeviceContext extends TornadoLogger implements Initialisable, OC
      * Asynchronous writes to device
      */
     public int enqueueWriteBuffer(long bufferId, long offset, long bytes, byte[] array, long hostOffset, int[] waitEvents) {
+        bufferWrites.incrementAndGet();
         return eventsWrapper.registerEvent(
-                queue.enqueueWrite(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueWrite(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_WRITE_BYTE, offset, queue);
     }
 
     public int enqueueWriteBuffer(long bufferId, long offset, long bytes, char[] array, long hostOffset, int[] waitEvents) {
+        bufferWrites.incrementAndGet();
         return eventsWrapper.registerEvent(
-                queue.enqueueWrite(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueWrite(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_WRITE_BYTE, offset, queue);
     }
 
     public int enqueueWriteBuffer(long bufferId, long offset, long bytes, int[] array, long hostOffset, int[] waitEvents) {
+        bufferWrites.incrementAndGet();
         return eventsWrapper.registerEvent(
-                queue.enqueueWrite(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueWrite(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_WRITE_INT, offset, queue);
     }
 
     public int enqueueWriteBuffer(long bufferId, long offset, long bytes, long[] array, long hostOffset, int[] waitEvents) {
+        bufferWrites.incrementAndGet();
         return eventsWrapper.registerEvent(
-                queue.enqueueWrite(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueWrite(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_WRITE_LONG, offset, queue);
     }
 
     public int enqueueWriteBuffer(long bufferId, long offset, long bytes, short[] array, long hostOffset, int[] waitEvents) {
+        bufferWrites.incrementAndGet();
         return eventsWrapper.registerEvent(
-                queue.enqueueWrite(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueWrite(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_WRITE_SHORT, offset, queue);
     }
 
     public int enqueueWriteBuffer(long bufferId, long offset, long bytes, float[] array, long hostOffset, int[] waitEvents) {
+        bufferWrites.incrementAndGet();
         return eventsWrapper.registerEvent(
-                queue.enqueueWrite(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueWrite(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_WRITE_FLOAT, offset, queue);
     }
 
     public int enqueueWriteBuffer(long bufferId, long offset, long bytes, double[] array, long hostOffset, int[] waitEvents) {
+        bufferWrites.incrementAndGet();
         return eventsWrapper.registerEvent(
-                queue.enqueueWrite(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueWrite(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_WRITE_DOUBLE, offset, queue);
     }
 
@@ -243,43 +288,43 @@ public class OCLDeviceContext extends TornadoLogger implements Initialisable, OC
      */
     public int enqueueReadBuffer(long bufferId, long offset, long bytes, byte[] array, long hostOffset, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueRead(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueRead(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_READ_BYTE, offset, queue);
     }
 
     public int enqueueReadBuffer(long bufferId, long offset, long bytes, char[] array, long hostOffset, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueRead(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueRead(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_READ_BYTE, offset, queue);
     }
 
     public int enqueueReadBuffer(long bufferId, long offset, long bytes, int[] array, long hostOffset, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueRead(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueRead(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_READ_INT, offset, queue);
     }
 
     public int enqueueReadBuffer(long bufferId, long offset, long bytes, long[] array, long hostOffset, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueRead(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueRead(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_READ_LONG, offset, queue);
     }
 
     public int enqueueReadBuffer(long bufferId, long offset, long bytes, float[] array, long hostOffset, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueRead(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueRead(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_READ_FLOAT, offset, queue);
     }
 
     public int enqueueReadBuffer(long bufferId, long offset, long bytes, double[] array, long hostOffset, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueRead(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueRead(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_READ_DOUBLE, offset, queue);
     }
 
     public int enqueueReadBuffer(long bufferId, long offset, long bytes, short[] array, long hostOffset, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueRead(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueRead(bufferId, OpenCLBlocking.FALSE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_READ_SHORT, offset, queue);
     }
 
@@ -287,44 +332,51 @@ public class OCLDeviceContext extends TornadoLogger implements Initialisable, OC
      * Synchronous writes to device
      */
     public void writeBuffer(long bufferId, long offset, long bytes, byte[] array, long hostOffset, int[] waitEvents) {
+        bufferWrites.incrementAndGet();
         eventsWrapper.registerEvent(
-                queue.enqueueWrite(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueWrite(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_WRITE_BYTE, offset, queue);
     }
 
     public void writeBuffer(long bufferId, long offset, long bytes, char[] array, long hostOffset, int[] waitEvents) {
+        bufferWrites.incrementAndGet();
         eventsWrapper.registerEvent(
-                queue.enqueueWrite(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueWrite(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_WRITE_BYTE, offset, queue);
     }
 
     public void writeBuffer(long bufferId, long offset, long bytes, int[] array, long hostOffset, int[] waitEvents) {
+        bufferWrites.incrementAndGet();
         eventsWrapper.registerEvent(
-                queue.enqueueWrite(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueWrite(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_WRITE_INT, offset, queue);
     }
 
     public void writeBuffer(long bufferId, long offset, long bytes, long[] array, long hostOffset, int[] waitEvents) {
+        bufferWrites.incrementAndGet();
         eventsWrapper.registerEvent(
-                queue.enqueueWrite(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueWrite(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_WRITE_LONG, offset, queue);
     }
 
     public void writeBuffer(long bufferId, long offset, long bytes, short[] array, long hostOffset, int[] waitEvents) {
+        bufferWrites.incrementAndGet();
         eventsWrapper.registerEvent(
-                queue.enqueueWrite(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueWrite(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_WRITE_SHORT, offset, queue);
     }
 
     public void writeBuffer(long bufferId, long offset, long bytes, float[] array, long hostOffset, int[] waitEvents) {
+        bufferWrites.incrementAndGet();
         eventsWrapper.registerEvent(
-                queue.enqueueWrite(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueWrite(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_WRITE_FLOAT, offset, queue);
     }
 
     public void writeBuffer(long bufferId, long offset, long bytes, double[] array, long hostOffset, int[] waitEvents) {
+        bufferWrites.incrementAndGet();
         eventsWrapper.registerEvent(
-                queue.enqueueWrite(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueWrite(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_WRITE_DOUBLE, offset, queue);
     }
 
@@ -333,54 +385,54 @@ public class OCLDeviceContext extends TornadoLogger implements Initialisable, OC
      */
     public int readBuffer(long bufferId, long offset, long bytes, byte[] array, long hostOffset, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueRead(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueRead(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_READ_BYTE, offset, queue);
     }
 
     public int readBuffer(long bufferId, long offset, long bytes, char[] array, long hostOffset, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueRead(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueRead(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_READ_BYTE, offset, queue);
     }
 
     public int readBuffer(long bufferId, long offset, long bytes, int[] array, long hostOffset, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueRead(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueRead(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_READ_INT, offset, queue);
     }
 
     public int readBuffer(long bufferId, long offset, long bytes, long[] array, long hostOffset, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueRead(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueRead(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_READ_LONG, offset, queue);
     }
 
     public int readBuffer(long bufferId, long offset, long bytes, float[] array, long hostOffset, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueRead(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueRead(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_READ_FLOAT, offset, queue);
     }
 
     public int readBuffer(long bufferId, long offset, long bytes, double[] array, long hostOffset, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueRead(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueRead(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_READ_DOUBLE, offset, queue);
 
     }
 
     public int readBuffer(long bufferId, long offset, long bytes, short[] array, long hostOffset, int[] waitEvents) {
         return eventsWrapper.registerEvent(
-                queue.enqueueRead(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue) ? eventsWrapper.waitEventsBuffer : null),
+                queue.enqueueRead(bufferId, OpenCLBlocking.TRUE, offset, bytes, array, hostOffset, eventsWrapper.serialiseEvents(waitEvents, queue)),
                 DESC_READ_SHORT, offset, queue);
     }
 
     public int enqueueBarrier(int[] events) {
-        long oclEvent = queue.enqueueBarrier(eventsWrapper.serialiseEvents(events, queue) ? eventsWrapper.waitEventsBuffer : null);
+        long oclEvent = queue.enqueueBarrier(eventsWrapper.serialiseEvents(events, queue));
         return queue.getOpenclVersion() < 120 ? -1 : eventsWrapper.registerEvent(oclEvent, DESC_SYNC_BARRIER, DEFAULT_TAG, queue);
     }
 
     public int enqueueMarker(int[] events) {
-        long oclEvent = queue.enqueueMarker(eventsWrapper.serialiseEvents(events, queue) ? eventsWrapper.waitEventsBuffer : null);
+        long oclEvent = queue.enqueueMarker(eventsWrapper.serialiseEvents(events, queue));
         return queue.getOpenclVersion() < 120 ? -1 : eventsWrapper.registerEvent(oclEvent, DESC_SYNC_MARKER, DEFAULT_TAG, queue);
     }
 
@@ -501,6 +553,10 @@ public class OCLDeviceContext extends TornadoLogger implements Initialisable, OC
         return codeCache.installSource(meta, id, entryPoint, code);
     }
 
+    public OCLInstalledCode installScheduleCode(TaskMetaData meta, String id, String entryPoint, byte[] code) {
+        return codeCache.installScheduleSource(meta, id, entryPoint, code);
+    }
+
     public OCLInstalledCode installCode(String id, String entryPoint, byte[] code, boolean shouldCompile) {
         return codeCache.installFPGASource(id, entryPoint, code, shouldCompile);
     }
@@ -46,6 +46,8 @@ public interface OCLDeviceContextInterface extends TornadoDeviceContext {
 
     OCLInstalledCode installCode(TaskMetaData meta, String id, String entryPoint, byte[] code);
 
+    OCLInstalledCode installScheduleCode(TaskMetaData meta, String id, String entryPoint, byte[] code);
+
     boolean isKernelAvailable();
 
     void reset();
@@ -68,6 +68,8 @@ public class OCLEvent extends TornadoLogger implements Event {
             "readFromDevice - double[]",
             "sync - marker",
             "sync - barrier",
+            "copyBufferToImage",
+            "copyBuffer - peer",
             "none"
     };
     // @formatter:on
@@ -88,13 +90,16 @@ public class OCLEvent extends TornadoLogger implements Event {
     protected static final int DESC_READ_DOUBLE = 13;
     protected static final int DESC_SYNC_MARKER = 14;
     protected static final int DESC_SYNC_BARRIER = 15;
-    protected static final int EVENT_NONE = 16;
+    protected static final int DESC_COPY_BUFFER_TO_IMAGE = 16;
+    protected static final int DESC_COPY_BUFFER_PEER = 17;
+    protected static final int EVENT_NONE = 18;
 
     private static final long[] internalBuffer = new long[2];
 
     private OCLEventsWrapper eventsWrapper;
     private OCLCommandQueue queue;
     private int localId;
+    private int generation;
     private long oclEventID;
     private static final ByteBuffer buffer = ByteBuffer.allocate(8);
     private String name;
@@ -111,6 +116,7 @@ public class OCLEvent extends TornadoLogger implements Event {
         this.eventsWrapper = eventsWrapper;
         this.queue = queue;
         this.localId = event;
+        this.generation = eventsWrapper.getGeneration(event);
         this.oclEventID = oclEventID;
         this.name = String.format("%s: 0x%x", EVENT_DESCRIPTIONS[eventsWrapper.getDescriptor(localId)], eventsWrapper.getTag(localId));
         this.status = -1;
@@ -129,8 +135,31 @@ public class OCLEvent extends TornadoLogger implements Event {
 
     native static void clReleaseEvent(long eventId) throws OCLException;
 
+    /**
+     * Queries the execution status of an OpenCL event without waiting.
+     *
+     * @return true if the event has completed or failed (negative status).
+     */
+    static boolean isComplete(long oclEventId) {
+        final byte[] value = new byte[4];
+        try {
+            clGetEventInfo(oclEventId, CL_EVENT_COMMAND_EXECUTION_STATUS.getValue(), value);
+        } catch (OCLException e) {
+            return false;
+        }
+        return ByteBuffer.wrap(value).order(OpenCL.BYTE_ORDER).getInt() <= 0;
+    }
+
+    /**
+     * The events wrapper only recycles the slot of an event once it has completed,
+     * after which the OpenCL event is released and must not be queried.
+     */
+    private boolean isReclaimed() {
+        return eventsWrapper != null && !eventsWrapper.isCurrent(localId, generation);
+    }
+
     private long readEventTime(OCLProfilingInfo eventType) {
-        if (!ENABLE_PROFILING) {
+        if (!ENABLE_PROFILING || isReclaimed()) {
             return -1;
         }
         long time = 0;
@@ -146,6 +175,9 @@ public class OCLEvent extends TornadoLogger implements Event {
 
     @Override
     public void waitForEvents() {
+        if (isReclaimed()) {
+            return;
+        }
         try {
             clWaitForEvents(new long[] { oclEventID });
         } catch (OCLException e) {
@@ -170,7 +202,7 @@ public class OCLEvent extends TornadoLogger implements Event {
     }
 
     private OCLCommandExecutionStatus getCLStatus() {
-        if (status == 0) {
+        if (status == 0 || isReclaimed()) {
             return CL_COMPLETE;
         }
 
@@ -23,58 +23,69 @@
 
 package uk.ac.manchester.tornado.drivers.opencl;
 
-import static uk.ac.manchester.tornado.api.exceptions.TornadoInternalError.guarantee;
 import static uk.ac.manchester.tornado.drivers.opencl.OCLEvent.EVENT_DESCRIPTIONS;
 import static uk.ac.manchester.tornado.drivers.opencl.enums.OCLCommandQueueProperties.CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE;
 import static uk.ac.manchester.tornado.runtime.common.Tornado.EVENT_WINDOW;
-import static uk.ac.manchester.tornado.runtime.common.Tornado.MAX_WAIT_EVENTS;
 import static uk.ac.manchester.tornado.runtime.common.Tornado.debug;
 import static uk.ac.manchester.tornado.runtime.common.Tornado.fatal;
-import static uk.ac.manchester.tornado.runtime.common.TornadoOptions.CIRCULAR_EVENTS;
 
 import java.util.ArrayList;
-import java.util.Arrays;
-import java.util.BitSet;
 import java.util.List;
 
+import uk.ac.manchester.tornado.runtime.common.EventTable;
+
 /**
  * Class which holds mapping between OpenCL events and TornadoVM local events
  * and handles event registration and serialization. Also contains extra
  * information such as events description and tag.
  * 
- * Only one instance of this class is created per device.
+ * Events are kept in a growable {@link EventTable}: a slot is recycled once
+ * {@code EVENT_WINDOW} newer events have been registered and the OpenCL driver
+ * reports the event as complete.
+ * 
+ * Only one instance of this class is created per device. Commands are
+ * enqueued from several threads (kernels leased from the same pool, tiered
+ * recompilation, multi-threaded task-schedules), so the table is accessed
+ * under the lock of this object, and each command gets its own list of events
+ * to wait on.
  */
 class OCLEventsWrapper {
 
-    private final long[] events;
-    private final int[] descriptors;
-    private final long[] tags;
-    private final BitSet retain;
-    private final OCLCommandQueue[] eventQueues;
-    private int eventIndex;
+    private static class OCLEventEntry {
+        private final long oclEventId;
+        private final int descriptor;
+        private final long tag;
+        private final OCLCommandQueue queue;
+
+        OCLEventEntry(long oclEventId, int descriptor, long tag, OCLCommandQueue queue) {
+            this.oclEventId = oclEventId;
+            this.descriptor = descriptor;
+            this.tag = tag;
+            this.queue = queue;
+        }
+    }
+
+    private final EventTable<OCLEventEntry> events;
 
     private final OCLEvent internalEvent;
-    protected final long[] waitEventsBuffer;
 
     protected OCLEventsWrapper() {
-        this.retain = new BitSet(EVENT_WINDOW);
-        this.retain.clear();
-        this.events = new long[EVENT_WINDOW];
-        this.descriptors = new int[EVENT_WINDOW];
-        this.tags = new long[EVENT_WINDOW];
-        this.eventQueues = new OCLCommandQueue[EVENT_WINDOW];
-        this.eventIndex = 0;
-        this.waitEventsBuffer = new long[MAX_WAIT_EVENTS];
         this.internalEvent = new OCLEvent();
-    }
+        this.events = new EventTable<>(EVENT_WINDOW, EVENT_WINDOW, new EventTable.Reclaimer<OCLEventEntry>() {
+            @Override
+            public boolean isComplete(OCLEventEntry entry) {
+                return OCLEvent.isComplete(entry.oclEventId);
+            }
 
-    protected int registerEvent(long oclEventId, int descriptorId, long tag, OCLCommandQueue queue) {
-        if (retain.get(eventIndex)) {
-            findNextEventSlot();
-        }
-        final int currentEvent = eventIndex;
-        guarantee(!retain.get(currentEvent), "overwriting retained event");
+            @Override
+            public void release(OCLEventEntry entry) {
+                internalEvent.setEventId(-1, entry.oclEventId);
+                internalEvent.release();
+            }
+        });
+    }
 
+    protected synchronized int registerEvent(long oclEventId, int descriptorId, long tag, OCLCommandQueue queue) {
         /*
          * OpenCL can produce an out of resources error which results in an invalid
          * event (-1). If this happens, then we log a fatal exception and gracefully
@@ -86,85 +97,84 @@ class OCLEventsWrapper {
             System.exit(-1);
         }
 
-        if (events[currentEvent] > 0 && !retain.get(currentEvent)) {
-            internalEvent.setEventId(currentEvent, events[currentEvent]);
-            releaseEvent(currentEvent);
-            internalEvent.release();
-        }
-        events[currentEvent] = oclEventId;
-        descriptors[currentEvent] = descriptorId;
-        tags[currentEvent] = tag;
-        eventQueues[currentEvent] = queue;
-
-        findNextEventSlot();
-        return currentEvent;
-    }
-
-    private void findNextEventSlot() {
-        eventIndex = retain.nextClearBit(eventIndex + 1);
-
-        if (CIRCULAR_EVENTS && (eventIndex >= events.length)) {
-            eventIndex = 0;
-        }
-
-        guarantee(eventIndex != -1, "event window is full (retained=%d, capacity=%d)", retain.cardinality(), EVENT_WINDOW);
+        return events.register(new OCLEventEntry(oclEventId, descriptorId, tag, queue));
     }
 
-    protected boolean serialiseEvents(int[] dependencies, OCLCommandQueue queue) {
+    /**
+     * Builds the list of OpenCL events that a command waits on. The first element
+     * holds the number of events.
+     *
+     * @return the list, or null if the command does not wait on any event.
+     */
+    protected synchronized long[] serialiseEvents(int[] dependencies, OCLCommandQueue queue) {
         boolean outOfOrderQueue = (queue.getProperties() & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) == 1;
         if (dependencies == null || dependencies.length == 0 || !outOfOrderQueue) {
-            return false;
+            return null;
         }
 
-        Arrays.fill(waitEventsBuffer, 0);
-
+        final long[] waitEvents = new long[dependencies.length + 1];
         int index = 0;
         for (final int value : dependencies) {
             if (value != -1) {
                 index++;
-                waitEventsBuffer[index] = events[value];
-                debug("[%d] 0x%x - %s 0x%x\n", index, events[value], EVENT_DESCRIPTIONS[descriptors[value]], tags[value]);
+                waitEvents[index] = getOCLEvent(value);
+                debug("[%d] 0x%x - %s 0x%x\n", index, getOCLEvent(value), EVENT_DESCRIPTIONS[getDescriptor(value)], getTag(value));
 
             }
         }
-        waitEventsBuffer[0] = index;
-        return (index > 0);
+        waitEvents[0] = index;
+        return (index > 0) ? waitEvents : null;
     }
 
-    public List<OCLEvent> getEvents() {
+    public synchronized List<OCLEvent> getEvents() {
         List<OCLEvent> result = new ArrayList<>();
-        for (int i = 0; i < eventIndex; i++) {
-            final long eventId = events[i];
-            if (eventId <= 0) {
+        for (int i = 0; i < events.size(); i++) {
+            final OCLEventEntry entry = events.get(i);
+            if (entry == null || entry.oclEventId <= 0) {
                 continue;
             }
-            result.add(new OCLEvent(this, eventQueues[i], i, eventId));
+            result.add(new OCLEvent(this, entry.queue, i, entry.oclEventId));
         }
         return result;
     }
 
-    protected void reset() {
-        Arrays.fill(events, 0);
-        eventIndex = 0;
+    protected synchronized void reset() {
+        events.clear();
+    }
+
+    protected synchronized void retainEvent(int localEventID) {
+        events.retain(localEventID);
+    }
+
+    protected synchronized void releaseEvent(int localEventID) {
+        events.release(localEventID);
     }
 
-    protected void retainEvent(int localEventID) {
-        retain.set(localEventID);
+    protected synchronized long getOCLEvent(int localEventID) {
+        final OCLEventEntry entry = events.get(localEventID);
+        return (entry == null) ? 0 : entry.oclEventId;
     }
 
-    protected void releaseEvent(int localEventID) {
-        retain.clear(localEventID);
+    protected synchronized int getDescriptor(int localEventID) {
+        final OCLEventEntry entry = events.get(localEventID);
+        return (entry == null) ? OCLEvent.EVENT_NONE : entry.descriptor;
     }
 
-    protected long getOCLEvent(int localEventID) {
-        return events[localEventID];
+    protected synchronized long getTag(int localEventID) {
+        final OCLEventEntry entry = events.get(localEventID);
+        return (entry == null) ? 0 : entry.tag;
     }
 
-    protected int getDescriptor(int localEventID) {
-        return descriptors[localEventID];
+    protected synchronized int getGeneration(int localEventID) {
+        return events.getGeneration(localEventID);
     }
 
-    protected long getTag(int localEventID) {
-        return tags[localEventID];
+    /**
+     * @return true if the slot still holds the OpenCL event it held at the given
+     *         generation. A recycled slot means that the event completed and was
+     *         released.
+     */
+    protected synchronized boolean isCurrent(int localEventID, int generation) {
+        return events.isCurrent(localEventID, generation);
     }
 }
@@ -25,6 +25,7 @@
  */
 package uk.ac.manchester.tornado.drivers.opencl;
 
+import uk.ac.manchester.tornado.runtime.common.WorkGroupSizes;
 import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
 
 public class OCLGPUScheduler extends OCLKernelScheduler {
@@ -60,62 +61,26 @@ public class OCLGPUScheduler extends OCLKernelScheduler {
     }
 
     @Override
-    public void calculateLocalWork(final TaskMetaData meta) {
+    public void calculateLocalWork(final TaskMetaData meta, final OCLKernel kernel) {
         final long[] localWork = meta.getLocalWork();
+        final long preferredMultiple = kernel.getPreferredWorkGroupSizeMultiple();
+        final long[] maxItems = WorkGroupSizes.maxWorkItemSizes(meta.getDims(), maxWorkItemSizes, kernel.getWorkGroupSize(), preferredMultiple);
 
         switch (meta.getDims()) {
             case 3:
                 localWork[2] = 1;
-                localWork[1] = calculateGroupSize(calculateEffectiveMaxWorkItemSizes(meta)[1], meta.getGlobalWork()[1]);
-                localWork[0] = calculateGroupSize(calculateEffectiveMaxWorkItemSizes(meta)[0], meta.getGlobalWork()[0]);
+                localWork[1] = WorkGroupSizes.groupSize(maxItems[1], meta.getGlobalWork()[1], 1);
+                localWork[0] = WorkGroupSizes.groupSize(maxItems[0], meta.getGlobalWork()[0], preferredMultiple);
                 break;
             case 2:
-                localWork[1] = calculateGroupSize(calculateEffectiveMaxWorkItemSizes(meta)[1], meta.getGlobalWork()[1]);
-                localWork[0] = calculateGroupSize(calculateEffectiveMaxWorkItemSizes(meta)[0], meta.getGlobalWork()[0]);
+                localWork[1] = WorkGroupSizes.groupSize(maxItems[1], meta.getGlobalWork()[1], 1);
+                localWork[0] = WorkGroupSizes.groupSize(maxItems[0], meta.getGlobalWork()[0], preferredMultiple);
                 break;
             case 1:
-                localWork[0] = calculateGroupSize(calculateEffectiveMaxWorkItemSizes(meta)[0], meta.getGlobalWork()[0]);
+                localWork[0] = WorkGroupSizes.groupSize(maxItems[0], meta.getGlobalWork()[0], preferredMultiple);
                 break;
             default:
                 break;
         }
     }
-
-    private int calculateGroupSize(long maxBlockSize, long globalWorkSize) {
-        if (maxBlockSize == globalWorkSize) {
-            maxBlockSize /= 4;
-        }
-
-        int value = (int) Math.min(maxBlockSize, globalWorkSize);
-        if (value == 0) {
-            return 1;
-        }
-        while (globalWorkSize % value != 0) {
-            value--;
-        }
-        return value;
-    }
-
-    private long[] calculateEffectiveMaxWorkItemSizes(TaskMetaData metaData) {
-        long[] intermediates = new long[] { 1, 1, 1 };
-
-        switch (metaData.getDims()) {
-            case 3:
-                intermediates[2] = (long) Math.sqrt(maxWorkItemSizes[2]);
-                intermediates[1] = (long) Math.sqrt(maxWorkItemSizes[1]);
-                intermediates[0] = (long) Math.sqrt(maxWorkItemSizes[0]);
-                break;
-            case 2:
-                intermediates[1] = (long) Math.sqrt(maxWorkItemSizes[1]);
-                intermediates[0] = (long) Math.sqrt(maxWorkItemSizes[0]);
-                break;
-            case 1:
-                intermediates[0] = maxWorkItemSizes[0];
-                break;
-            default:
-                break;
-
-        }
-        return intermediates;
-    }
 }
@@ -32,6 +32,7 @@ import java.nio.ByteBuffer;
 import java.util.Arrays;
 
 import uk.ac.manchester.tornado.drivers.opencl.enums.OCLKernelInfo;
+import uk.ac.manchester.tornado.drivers.opencl.enums.OCLKernelWorkGroupInfo;
 import uk.ac.manchester.tornado.drivers.opencl.exceptions.OCLException;
 import uk.ac.manchester.tornado.runtime.common.TornadoLogger;
 
@@ -42,6 +43,9 @@ public class OCLKernel extends TornadoLogger {
     private final ByteBuffer buffer;
     private String kernelName;
 
+    private long workGroupSize = -1;
+    private long preferredWorkGroupSizeMultiple = -1;
+
     public OCLKernel(long id, OCLDeviceContext deviceContext) {
         this.oclKernelID = id;
         this.deviceContext = deviceContext;
@@ -61,6 +65,8 @@ public class OCLKernel extends TornadoLogger {
 
     native static void clGetKernelInfo(long kernelId, int info, byte[] buffer) throws OCLException;
 
+    native static void clGetKernelWorkGroupInfo(long kernelId, long deviceId, int info, byte[] buffer) throws OCLException;
+
     public void setArg(int index, ByteBuffer buffer) {
         try {
             clSetKernelArg(oclKernelID, index, buffer.position(), buffer.array());
@@ -125,6 +131,39 @@ public class OCLKernel extends TornadoLogger {
         }
     }
 
+    private long queryWorkGroupInfo(OCLKernelWorkGroupInfo info) {
+        Arrays.fill(buffer.array(), (byte) 0);
+        buffer.clear();
+        try {
+            clGetKernelWorkGroupInfo(oclKernelID, deviceContext.getDevice().getId(), info.getValue(), buffer.array());
+        } catch (OCLException e) {
+            error(e.getMessage());
+        }
+        return buffer.getLong();
+    }
+
+    /**
+     * Maximum work-group size this kernel can be launched with on the device. It
+     * can be lower than the device maximum, e.g., for register-heavy kernels.
+     */
+    public long getWorkGroupSize() {
+        if (workGroupSize == -1) {
+            workGroupSize = queryWorkGroupInfo(OCLKernelWorkGroupInfo.CL_KERNEL_WORK_GROUP_SIZE);
+        }
+        return workGroupSize;
+    }
+
+    /**
+     * Work-group size multiple that the device executes efficiently, e.g., the
+     * warp or wavefront size.
+     */
+    public long getPreferredWorkGroupSizeMultiple() {
+        if (preferredWorkGroupSizeMultiple == -1) {
+            preferredWorkGroupSizeMultiple = queryWorkGroupInfo(OCLKernelWorkGroupInfo.CL_KERNEL_PREFERRED_WORK_GROUP_SIZE_MULTIPLE);
+        }
+        return preferredWorkGroupSizeMultiple;
+    }
+
     public long getOclKernelID() {
         return oclKernelID;
     }
@@ -0,0 +1,103 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.drivers.opencl;
+
+import java.util.ArrayDeque;
+
+/**
+ * The cl_kernel objects of an installed kernel. Setting the arguments of a
+ * cl_kernel and enqueueing it is not atomic, so each launching thread leases
+ * its own object: the installed kernel when it is free, or otherwise one
+ * created again from the same program. Extra kernels are kept for later
+ * leases.
+ *
+ * The arguments of the installed kernel stay set between launches, and are
+ * only set again for a different call stack. Other kernels always get their
+ * arguments set before a launch.
+ */
+public class OCLKernelPool {
+
+    private final OCLProgram program;
+    private final OCLKernel kernel;
+    private final ArrayDeque<OCLKernel> extraKernels;
+    private boolean kernelLeased;
+    private Object boundStack;
+    private boolean retired;
+
+    public OCLKernelPool(OCLProgram program, OCLKernel kernel) {
+        this.program = program;
+        this.kernel = kernel;
+        this.extraKernels = new ArrayDeque<>();
+    }
+
+    public synchronized OCLKernel lease() {
+        if (!kernelLeased) {
+            kernelLeased = true;
+            return kernel;
+        }
+        final OCLKernel extraKernel = extraKernels.poll();
+        return (extraKernel != null) ? extraKernel : program.getKernel(kernel.getName());
+    }
+
+    /**
+     * Returns a leased kernel. Kernels of a retired pool are released.
+     */
+    public synchronized void release(OCLKernel leased) {
+        if (retired) {
+            leased.cleanup();
+        } else if (leased == kernel) {
+            kernelLeased = false;
+        } else {
+            extraKernels.push(leased);
+        }
+    }
+
+    /**
+     * Checks whether the arguments of a leased kernel have to be set for the
+     * given call stack, and records them as set.
+     */
+    public boolean bindArguments(OCLKernel leased, Object stack) {
+        if (leased != kernel) {
+            return true;
+        }
+        final boolean bind = boundStack != stack;
+        boundStack = stack;
+        return bind;
+    }
+
+    /**
+     * Releases all the kernels of the pool. Kernels leased at this point are
+     * released when they are returned.
+     */
+    public synchronized void retire() {
+        retired = true;
+        for (OCLKernel extraKernel : extraKernels) {
+            extraKernel.cleanup();
+        }
+        extraKernels.clear();
+        if (!kernelLeased) {
+            kernel.cleanup();
+        }
+    }
+}
@@ -27,7 +27,7 @@ package uk.ac.manchester.tornado.drivers.opencl;
 import uk.ac.manchester.tornado.api.WorkerGrid;
 import uk.ac.manchester.tornado.api.common.Event;
 import uk.ac.manchester.tornado.api.profiler.ProfilerType;
-import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
+import uk.ac.manchester.tornado.runtime.profiler.ProfilerSampler;
 import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
 
 public abstract class OCLKernelScheduler {
@@ -45,14 +45,14 @@ public abstract class OCLKernelScheduler {
 
     public abstract void calculateGlobalWork(final TaskMetaData meta, long batchThreads);
 
-    public abstract void calculateLocalWork(final TaskMetaData meta);
+    public abstract void calculateLocalWork(final TaskMetaData meta, final OCLKernel kernel);
 
     public int submit(final OCLKernel kernel, final TaskMetaData meta, long batchThreads) {
         return submit(kernel, meta, null, batchThreads);
     }
 
     private void updateProfiler(final int taskEvent, final TaskMetaData meta) {
-        if (TornadoOptions.isProfilerEnabled()) {
+        if (ProfilerSampler.isTimed()) {
             Event tornadoKernelEvent = deviceContext.resolveEvent(taskEvent);
             tornadoKernelEvent.waitForEvents();
             long timer = meta.getProfiler().getTimer(ProfilerType.TOTAL_KERNEL_TIME);
@@ -77,20 +77,23 @@ public abstract class OCLKernelScheduler {
     }
 
     /**
-     * Checks if the selected local work group fits on the target device. If it does
-     * not fit, it sets the local work group to null, so the OpenCL driver chooses a
-     * default value. In this case, the threads configured in the local work sizes
-     * depends on each OpenCL driver.
+     * Checks if the selected local work group fits on the target device and within
+     * the work-group size limit of the kernel. If it does not fit, it sets the
+     * local work group to null, so the OpenCL driver chooses a default value. In
+     * this case, the threads configured in the local work sizes depends on each
+     * OpenCL driver.
      * 
+     * @param kernel
+     *            OCLKernel.
      * @param meta
      *            TaskMetaData.
      */
-    private void checkLocalWorkGroupFitsOnDevice(final TaskMetaData meta) {
+    private void checkLocalWorkGroupFitsOnDevice(final OCLKernel kernel, final TaskMetaData meta) {
         WorkerGrid grid = meta.getWorkerGrid(meta.getId());
         long[] local = grid.getLocalWork();
         if (local != null) {
             OCLGridInfo gridInfo = new OCLGridInfo(deviceContext.getDevice(), local);
-            boolean checkedDimensions = gridInfo.checkGridDimensions();
+            boolean checkedDimensions = gridInfo.checkGridDimensions() && fitsKernelWorkGroupSize(kernel, local);
             if (!checkedDimensions) {
                 System.out.println(WARNING_THREAD_LOCAL);
                 grid.setLocalWorkToNull();
@@ -99,16 +102,24 @@ public abstract class OCLKernelScheduler {
         }
     }
 
+    private static boolean fitsKernelWorkGroupSize(final OCLKernel kernel, final long[] local) {
+        long threads = 1;
+        for (long value : local) {
+            threads *= value;
+        }
+        return threads <= kernel.getWorkGroupSize();
+    }
+
     public int submit(final OCLKernel kernel, final TaskMetaData meta, final int[] waitEvents, long batchThreads) {
         if (!meta.isWorkerGridAvailable()) {
             if (!meta.isGlobalWorkDefined()) {
                 calculateGlobalWork(meta, batchThreads);
             }
             if (!meta.isLocalWorkDefined()) {
-                calculateLocalWork(meta);
+                calculateLocalWork(meta, kernel);
             }
         } else {
-            checkLocalWorkGroupFitsOnDevice(meta);
+            checkLocalWorkGroupFitsOnDevice(kernel, meta);
         }
 
         if (meta.isDebug()) {
@@ -0,0 +1,195 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.drivers.opencl;
+
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * Top-level element of a generated OpenCL source: a preprocessor line, a
+ * function definition or any other declaration. Sources of several tasks are
+ * split into definitions to build them as a single program, emitting the
+ * functions that more than one task defines (non-inlined callees, helpers)
+ * only once.
+ */
+class OCLSourceDefinition {
+
+    private final String name;
+    private final String text;
+    private final boolean directive;
+
+    private OCLSourceDefinition(String name, String text, boolean directive) {
+        this.name = name;
+        this.text = text;
+        this.directive = directive;
+    }
+
+    /**
+     * @return the name of the function, or null if the definition is not a
+     *         function
+     */
+    String getName() {
+        return name;
+    }
+
+    String getText() {
+        return text;
+    }
+
+    /**
+     * Preprocessor lines are kept in every source, as guards and pragmas can
+     * be repeated.
+     */
+    boolean isDirective() {
+        return directive;
+    }
+
+    static List<OCLSourceDefinition> split(byte[] source) {
+        final String code = new String(source);
+        final List<OCLSourceDefinition> definitions = new ArrayList<>();
+        // Comments between definitions are dropped
+        int index = skipBlanks(code, 0);
+        while (index < code.length()) {
+            if (code.charAt(index) == '#') {
+                final int end = endOfDirective(code, index);
+                definitions.add(new OCLSourceDefinition(null, code.substring(index, end).trim(), true));
+                index = end;
+            } else {
+                final int end = endOfDefinition(code, index);
+                final String text = code.substring(index, end).trim();
+                definitions.add(new OCLSourceDefinition(functionName(text), text, false));
+                index = end;
+            }
+            index = skipBlanks(code, index);
+        }
+        return definitions;
+    }
+
+    private static int skipBlanks(String code, int index) {
+        while (index < code.length()) {
+            if (Character.isWhitespace(code.charAt(index))) {
+                index++;
+            } else if (code.startsWith("//", index) || code.startsWith("/*", index)) {
+                index = skipComment(code, index);
+            } else {
+                break;
+            }
+        }
+        return index;
+    }
+
+    private static int skipComment(String code, int index) {
+        if (code.startsWith("//", index)) {
+            final int end = code.indexOf('\n', index);
+            return (end < 0) ? code.length() : end + 1;
+        }
+        final int end = code.indexOf("*/", index + 2);
+        return (end < 0) ? code.length() : end + 2;
+    }
+
+    private static int skipLiteral(String code, int index) {
+        final char quote = code.charAt(index);
+        index++;
+        while (index < code.length() && code.charAt(index) != quote) {
+            index += (code.charAt(index) == '\\') ? 2 : 1;
+        }
+        return Math.min(index + 1, code.length());
+    }
+
+    private static int endOfDirective(String code, int index) {
+        while (index < code.length() && code.charAt(index) != '\n') {
+            index += (code.charAt(index) == '\\') ? 2 : 1;
+        }
+        return Math.min(index + 1, code.length());
+    }
+
+    /**
+     * A definition ends with the closing brace of a function body, or with the
+     * first semicolon outside braces for any other declaration.
+     */
+    private static int endOfDefinition(String code, int index) {
+        int depth = 0;
+        boolean function = false;
+        while (index < code.length()) {
+            final char c = code.charAt(index);
+            if (c == '"' || c == '\'') {
+                index = skipLiteral(code, index);
+                continue;
+            } else if (code.startsWith("//", index) || code.startsWith("/*", index)) {
+                index = skipComment(code, index);
+                continue;
+            } else if (c == '(' && depth == 0) {
+                function = true;
+            } else if (c == '{') {
+                depth++;
+            } else if (c == '}') {
+                depth--;
+                if (depth == 0 && function) {
+                    return index + 1;
+                }
+            } else if (c == ';' && depth == 0) {
+                return index + 1;
+            }
+            index++;
+        }
+        return index;
+    }
+
+    /**
+     * The name of a function is the identifier before its parameter list, the
+     * last parenthesis at the top level of its header. This skips attributes
+     * such as {@code __attribute__((reqd_work_group_size(...)))}.
+     */
+    private static String functionName(String text) {
+        final int body = text.indexOf('{');
+        if (body < 0 || !text.endsWith("}")) {
+            return null;
+        }
+        int parameters = -1;
+        int depth = 0;
+        for (int i = 0; i < body; i++) {
+            final char c = text.charAt(i);
+            if (c == '(') {
+                if (depth == 0) {
+                    parameters = i;
+                }
+                depth++;
+            } else if (c == ')') {
+                depth--;
+            }
+        }
+        if (parameters < 0) {
+            return null;
+        }
+        int end = parameters;
+        while (end > 0 && Character.isWhitespace(text.charAt(end - 1))) {
+            end--;
+        }
+        int begin = end;
+        while (begin > 0 && Character.isJavaIdentifierPart(text.charAt(begin - 1))) {
+            begin--;
+        }
+        return (begin < end) ? text.substring(begin, end) : null;
+    }
+}
@@ -40,6 +40,7 @@ public class OCLTargetDescription extends TargetDescription {
     private final boolean supportsFP64;
     private final String extensions;
     private final boolean supportsInt64Atomics;
+    private final boolean supportsInt64ExtendedAtomics;
 
     public OCLTargetDescription(Architecture arch, boolean supportsFP64, String extensions) {
         this(arch, false, STACK_ALIGNMENT, 4096, INLINE_OBJECTS, supportsFP64, extensions);
@@ -50,6 +51,7 @@ public class OCLTargetDescription extends TargetDescription {
         this.supportsFP64 = supportsFP64;
         this.extensions = extensions;
         supportsInt64Atomics = extensions.contains("cl_khr_int64_base_atomics");
+        supportsInt64ExtendedAtomics = extensions.contains("cl_khr_int64_extended_atomics");
     }
 
     //@formatter:off
@@ -80,6 +82,10 @@ public class OCLTargetDescription extends TargetDescription {
         return supportsInt64Atomics;
     }
 
+    public boolean supportsInt64ExtendedAtomics() {
+        return supportsInt64ExtendedAtomics;
+    }
+
     public String getExtensions() {
         return extensions;
     }
@@ -50,7 +50,14 @@ public interface OCLTargetDevice extends TornadoTargetDevice {
 
     boolean isDeviceAvailable();
 
+    boolean isDeviceImageSupported();
+
     String getDeviceOpenCLCVersion();
 
     boolean isLittleEndian();
+
+    /**
+     * @return the NUMA node closest to the device, or -1 if it is unknown.
+     */
+    int getNumaNode();
 }
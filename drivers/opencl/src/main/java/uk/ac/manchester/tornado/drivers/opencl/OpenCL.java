@@ -94,6 +94,17 @@ public class OpenCL {
 
     native static int clGetPlatformIDs(long[] platformIds);
 
+    /**
+     * Sets the affinity of the calling thread to the given cores.
+     */
+    public native static void pinCurrentThread(int[] cpus);
+
+    /**
+     * Makes the memory allocated by the calling thread prefer the given NUMA node.
+     * A negative node restores the default policy.
+     */
+    public native static void setThreadMemoryNode(int node);
+
     public static void cleanup() {
         if (initialised) {
             for (final TornadoPlatform platform : platforms) {
@@ -106,7 +106,14 @@ public enum OCLDeviceInfo {
     CL_DEVICE_PREFERRED_INTEROP_USER_SYNC(0x1048), 
     CL_DEVICE_PRINTF_BUFFER_SIZE(0x1049), 
     CL_DEVICE_IMAGE_PITCH_ALIGNMENT(0x104A), 
-    CL_DEVICE_IMAGE_BASE_ADDRESS_ALIGNMENT(0x104B);
+    CL_DEVICE_IMAGE_BASE_ADDRESS_ALIGNMENT(0x104B),
+
+    // Vendor extensions: cl_khr_pci_bus_info, cl_nv_device_attribute_query and cl_amd_device_attribute_query
+    CL_DEVICE_PCI_BUS_ID_NV(0x4008),
+    CL_DEVICE_PCI_SLOT_ID_NV(0x4009),
+    CL_DEVICE_PCI_DOMAIN_ID_NV(0x400A),
+    CL_DEVICE_TOPOLOGY_AMD(0x4037),
+    CL_DEVICE_PCI_BUS_INFO_KHR(0x410F);
     // @formatter:on
 
     private final int value;
@@ -347,6 +354,21 @@ public enum OCLDeviceInfo {
             case 0x104B:
                 result = OCLDeviceInfo.CL_DEVICE_IMAGE_BASE_ADDRESS_ALIGNMENT;
                 break;
+            case 0x4008:
+                result = OCLDeviceInfo.CL_DEVICE_PCI_BUS_ID_NV;
+                break;
+            case 0x4009:
+                result = OCLDeviceInfo.CL_DEVICE_PCI_SLOT_ID_NV;
+                break;
+            case 0x400A:
+                result = OCLDeviceInfo.CL_DEVICE_PCI_DOMAIN_ID_NV;
+                break;
+            case 0x4037:
+                result = OCLDeviceInfo.CL_DEVICE_TOPOLOGY_AMD;
+                break;
+            case 0x410F:
+                result = OCLDeviceInfo.CL_DEVICE_PCI_BUS_INFO_KHR;
+                break;
         }
         return result;
     }
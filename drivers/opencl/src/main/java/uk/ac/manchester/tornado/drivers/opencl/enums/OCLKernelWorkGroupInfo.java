@@ -0,0 +1,45 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework: 
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.drivers.opencl.enums;
+
+public enum OCLKernelWorkGroupInfo {
+
+    // @formatter:off
+    CL_KERNEL_WORK_GROUP_SIZE(0x11B0),
+    CL_KERNEL_COMPILE_WORK_GROUP_SIZE(0x11B1),
+    CL_KERNEL_LOCAL_MEM_SIZE(0x11B2),
+    CL_KERNEL_PREFERRED_WORK_GROUP_SIZE_MULTIPLE(0x11B3),
+    CL_KERNEL_PRIVATE_MEM_SIZE(0x11B4);
+    // @formatter:on
+
+    private final int value;
+
+    OCLKernelWorkGroupInfo(final int v) {
+        value = v;
+    }
+
+    public int getValue() {
+        return value;
+    }
+}
@@ -29,26 +29,33 @@ import static uk.ac.manchester.tornado.runtime.common.Tornado.debug;
 import static uk.ac.manchester.tornado.runtime.common.Tornado.info;
 
 import java.nio.ByteBuffer;
+import java.util.Arrays;
 
 import jdk.vm.ci.code.InstalledCode;
 import jdk.vm.ci.code.InvalidInstalledCodeException;
+import uk.ac.manchester.tornado.api.common.Access;
 import uk.ac.manchester.tornado.api.common.Event;
 import uk.ac.manchester.tornado.api.exceptions.TornadoRuntimeException;
 import uk.ac.manchester.tornado.api.mm.ObjectBuffer;
 import uk.ac.manchester.tornado.api.profiler.ProfilerType;
+import uk.ac.manchester.tornado.drivers.opencl.OCLCodeCache;
 import uk.ac.manchester.tornado.drivers.opencl.OCLDeviceContext;
 import uk.ac.manchester.tornado.drivers.opencl.OCLGPUScheduler;
 import uk.ac.manchester.tornado.drivers.opencl.OCLKernel;
+import uk.ac.manchester.tornado.drivers.opencl.OCLKernelPool;
 import uk.ac.manchester.tornado.drivers.opencl.OCLKernelScheduler;
 import uk.ac.manchester.tornado.drivers.opencl.OCLProgram;
 import uk.ac.manchester.tornado.drivers.opencl.OCLScheduler;
 import uk.ac.manchester.tornado.drivers.opencl.mm.OCLByteBuffer;
 import uk.ac.manchester.tornado.drivers.opencl.mm.OCLCallStack;
+import uk.ac.manchester.tornado.drivers.opencl.mm.OCLConstantRegion;
+import uk.ac.manchester.tornado.drivers.opencl.mm.OCLImageWrapper;
 import uk.ac.manchester.tornado.drivers.opencl.runtime.OCLTornadoDevice;
 import uk.ac.manchester.tornado.runtime.common.CallStack;
 import uk.ac.manchester.tornado.runtime.common.RuntimeUtilities;
+import uk.ac.manchester.tornado.runtime.common.TieredCompilation;
 import uk.ac.manchester.tornado.runtime.common.TornadoInstalledCode;
-import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
+import uk.ac.manchester.tornado.runtime.profiler.ProfilerSampler;
 import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
 
 public class OCLInstalledCode extends InstalledCode implements TornadoInstalledCode {
@@ -57,15 +64,17 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
 
     private static final int CL_MEM_SIZE = 8;
 
-    private final ByteBuffer buffer = ByteBuffer.allocate(CL_MEM_SIZE);
-    private final byte[] code;
-    private final OCLProgram program;
+    private byte[] code;
+    private OCLProgram program;
     private final OCLDeviceContext deviceContext;
-    private final OCLKernel kernel;
+    private OCLKernel kernel;
     private boolean valid;
+    private OCLCodeCache.PendingProgram pendingProgram;
+    private final OCLConstantRegion constantRegion;
+    private volatile OCLKernelPool kernels;
+    private volatile TieredCompilation<OCLInstalledCode> tieredCompilation;
 
     private final OCLKernelScheduler scheduler;
-    private final int[] internalEvents = new int[1];
 
     private final long[] singleThreadGlobalWorkSize = new long[] { 1 };
     private final long[] singleThreadLocalWorkSize = new long[] { 1 };
@@ -78,19 +87,91 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
         this.DEFAULT_SCHEDULER = new OCLGPUScheduler(deviceContext);
         this.kernel = kernel;
         this.program = program;
+        this.constantRegion = new OCLConstantRegion(deviceContext);
+        this.kernels = (kernel != null) ? new OCLKernelPool(program, kernel) : null;
         valid = kernel != null;
-        buffer.order(deviceContext.getByteOrder());
     }
 
+    /**
+     * Creates the code of a task whose kernel is built later on, together with
+     * the rest of the tasks of its task-schedule, in a single OpenCL program.
+     */
+    public OCLInstalledCode(final String entryPoint, final byte[] code, final OCLDeviceContext deviceContext, final OCLCodeCache.PendingProgram pendingProgram) {
+        this(entryPoint, code, deviceContext, null, null);
+        this.pendingProgram = pendingProgram;
+        valid = true;
+    }
+
+    /**
+     * Binds the kernel created from the shared program of the task-schedule.
+     */
+    public void bind(final OCLProgram program, final OCLKernel kernel) {
+        this.program = program;
+        this.kernel = kernel;
+        this.kernels = (kernel != null) ? new OCLKernelPool(program, kernel) : null;
+        this.pendingProgram = null;
+        valid = kernel != null;
+    }
+
+    /**
+     * Attaches the recompilation of a kernel built by the quick tier.
+     */
+    public void setTieredCompilation(TieredCompilation<OCLInstalledCode> tieredCompilation) {
+        this.tieredCompilation = tieredCompilation;
+    }
+
+    /**
+     * Swaps in the optimised kernel once its background recompilation has
+     * finished. The kernel arguments are set again before the next launch.
+     */
+    private void tierUp() {
+        if (tieredCompilation == null) {
+            return;
+        }
+        synchronized (this) {
+            if (tieredCompilation == null) {
+                return;
+            }
+            final OCLInstalledCode optimised = tieredCompilation.onLaunch();
+            if (optimised != null) {
+                if (optimised.isValid()) {
+                    kernels.retire();
+                    program = optimised.program;
+                    kernel = optimised.kernel;
+                    kernels = optimised.kernels;
+                    code = optimised.code;
+                }
+                tieredCompilation = null;
+            }
+        }
+    }
+
+    private void linkPendingProgram() {
+        final OCLCodeCache.PendingProgram pending = pendingProgram;
+        if (pending != null) {
+            pending.link();
+        }
+    }
+
+    /**
+     * Releases the kernels of this code. The program is not released: it can be
+     * shared with other installed codes, through the shared programs of the code
+     * cache or the program of a task-schedule.
+     */
     @Override
     public void invalidate() {
         if (valid) {
-            kernel.cleanup();
+            if (kernels != null) {
+                kernels.retire();
+            }
+            constantRegion.release();
+            pendingProgram = null;
             valid = false;
         }
     }
 
     public OCLProgram getProgram() {
+        linkPendingProgram();
         return program;
     }
 
@@ -100,6 +181,7 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
     }
 
     public OCLKernel getKernel() {
+        linkPendingProgram();
         return kernel;
     }
 
@@ -113,14 +195,15 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
      * @return int with the event ID.
      */
     public int executeTask(final OCLByteBuffer stack, final ObjectBuffer atomicSpace, final TaskMetaData meta) {
+        linkPendingProgram();
         debug("kernel submitted: id=0x%x, method = %s, device =%s", kernel.getOclKernelID(), kernel.getName(), deviceContext.getDevice().getDeviceName());
         debug("\tstack    : buffer id=0x%x, address=0x%x relative=0x%x", stack.toBuffer(), stack.toAbsoluteAddress(), stack.toRelativeAddress());
 
-        setKernelArgs(stack, atomicSpace, meta);
+        setKernelArgs(kernel, stack, atomicSpace, meta);
 
         int task;
         if (meta == null) {
-            task = deviceContext.enqueueNDRangeKernel(kernel, 1, null, singleThreadGlobalWorkSize, singleThreadLocalWorkSize, internalEvents);
+            task = deviceContext.enqueueNDRangeKernel(kernel, 1, null, singleThreadGlobalWorkSize, singleThreadLocalWorkSize, null);
             deviceContext.flush();
             deviceContext.finish();
         } else {
@@ -175,12 +258,16 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
     /**
      * Set arguments into the OpenCL device Kernel.
      *
+     * @param kernel
+     *            leased OpenCL kernel {@link OCLKernel}
      * @param stack
      *            OpenCL stack parameters {@link OCLByteBuffer}
      * @param meta
      *            task metadata {@link TaskMetaData}
      */
-    private void setKernelArgs(final OCLByteBuffer stack, final ObjectBuffer atomicSpace, TaskMetaData meta) {
+    private void setKernelArgs(final OCLKernel kernel, final OCLByteBuffer stack, final ObjectBuffer atomicSpace, TaskMetaData meta) {
+        final ByteBuffer buffer = ByteBuffer.allocate(CL_MEM_SIZE);
+        buffer.order(deviceContext.getByteOrder());
         int index = 0;
 
         if (deviceContext.needsBump()) {
@@ -203,7 +290,11 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
         index++;
 
         // constant memory
-        if (meta != null && meta.getConstantSize() > 0) {
+        if (!constantRegion.isEmpty()) {
+            buffer.clear();
+            buffer.putLong(constantRegion.toBuffer());
+            kernel.setArg(index, buffer);
+        } else if (meta != null && meta.getConstantSize() > 0) {
             kernel.setArg(index, ByteBuffer.wrap(meta.getConstantData()));
         } else {
             buffer.clear();
@@ -231,11 +322,34 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
         }
         index++;
 
+        // Read-only images
+        if (stack instanceof OCLCallStack) {
+            for (OCLImageWrapper image : ((OCLCallStack) stack).getImages()) {
+                buffer.clear();
+                buffer.putLong(image.getImageId());
+                kernel.setArg(index, buffer);
+                index++;
+            }
+        }
+
     }
 
     public int submitWithEvents(final OCLCallStack stack, final ObjectBuffer atomicSpace, final TaskMetaData meta, final int[] events, long batchThreads) {
+        linkPendingProgram();
+        tierUp();
         guarantee(kernel != null, "kernel is null");
 
+        final OCLKernelPool pool = kernels;
+        final OCLKernel leased = pool.lease();
+        try {
+            return submitWithEvents(leased, pool.bindArguments(leased, stack), stack, atomicSpace, meta, events, batchThreads);
+        } finally {
+            pool.release(leased);
+        }
+    }
+
+    private int submitWithEvents(final OCLKernel kernel, final boolean bindArguments, final OCLCallStack stack, final ObjectBuffer atomicSpace, final TaskMetaData meta, final int[] events,
+            long batchThreads) {
         if (DEBUG) {
             info("kernel submitted: id=0x%x, method = %s, device =%s", kernel.getOclKernelID(), kernel.getName(), deviceContext.getDevice().getDeviceName());
             info("\tstack    : buffer id=0x%x, device=0x%x (0x%x)", stack.toBuffer(), stack.toAbsoluteAddress(), stack.toRelativeAddress());
@@ -244,14 +358,27 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
         /*
          * Only set the kernel arguments if they are either: - not set or - have changed
          */
-        final int[] waitEvents;
+        final int[] internalEvents = new int[1];
+        int[] waitEvents;
         if (!stack.isOnDevice()) {
-            setKernelArgs(stack, atomicSpace, meta);
+            bindConstantRegion(stack, meta);
+            setKernelArgs(kernel, stack, atomicSpace, meta);
             internalEvents[0] = stack.enqueueWrite(events);
             waitEvents = internalEvents;
         } else {
+            if (bindArguments) {
+                setKernelArgs(kernel, stack, atomicSpace, meta);
+            }
             waitEvents = events;
         }
+        if (!constantRegion.isEmpty()) {
+            final int refreshEvent = constantRegion.enqueueRefresh(waitEvents);
+            if (refreshEvent != -1) {
+                internalEvents[0] = refreshEvent;
+                waitEvents = internalEvents;
+            }
+        }
+        waitEvents = refreshImages(stack, waitEvents);
 
         int task;
         if (meta == null) {
@@ -288,11 +415,75 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
                 task = stack.enqueueRead(internalEvents);
             }
         }
+        markWrittenImages(stack, meta);
+        markWrittenBuffers(meta);
 
         return task;
     }
 
-    private void executeSingleThread() {
+    /**
+     * Lays out the parameters that the compiler placed in constant memory. This
+     * rewrites their frame slots, so it runs before the stack is written.
+     */
+    private void bindConstantRegion(final OCLCallStack stack, final TaskMetaData meta) {
+        if (meta != null && meta.hasConstantParameters()) {
+            constantRegion.bind(stack, meta.getConstantParameters());
+        } else {
+            constantRegion.bind(stack, new int[0]);
+        }
+    }
+
+    /**
+     * Images are read-only copies of heap data. Only the images whose heap copy
+     * changed since they were last refreshed are copied again.
+     *
+     * @return the events the kernel launch has to wait for.
+     */
+    private int[] refreshImages(final OCLCallStack stack, int[] waitEvents) {
+        int[] events = waitEvents;
+        for (OCLImageWrapper image : stack.getImages()) {
+            final int event = image.enqueueRefresh(events);
+            if (event != -1) {
+                events = new int[] { event };
+            }
+        }
+        return events;
+    }
+
+    /**
+     * Kernels write images through the heap copy, so every image passed to an
+     * argument the kernel may write is refreshed before it is read again.
+     */
+    private void markWrittenImages(final OCLCallStack stack, final TaskMetaData meta) {
+        if (stack.getImages().isEmpty()) {
+            return;
+        }
+        if (meta == null) {
+            stack.getImages().forEach(OCLImageWrapper::markStale);
+            return;
+        }
+        final Access[] accesses = meta.getArgumentsAccess();
+        for (int i = 0; i < accesses.length; i++) {
+            final ObjectBuffer argument = stack.getArgumentBuffer(i);
+            if (argument instanceof OCLImageWrapper && accesses[i] != Access.READ) {
+                ((OCLImageWrapper) argument).markStale();
+            }
+        }
+    }
+
+    /**
+     * Counts the launch as a write to device buffers unless the kernel only
+     * reads its arguments, so that the constant regions of other kernels are
+     * refreshed before they read the data again.
+     */
+    private void markWrittenBuffers(final TaskMetaData meta) {
+        if (meta != null && meta.getArgumentsAccess() != null && Arrays.stream(meta.getArgumentsAccess()).allMatch(access -> access == Access.READ)) {
+            return;
+        }
+        constantRegion.keepFresh(deviceContext.markBuffersWritten());
+    }
+
+    private void executeSingleThread(final OCLKernel kernel) {
         deviceContext.enqueueNDRangeKernel(kernel, 1, null, singleThreadGlobalWorkSize, singleThreadLocalWorkSize, null);
     }
 
@@ -302,7 +493,7 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
         }
     }
 
-    private int submitSequential(final TaskMetaData meta) {
+    private int submitSequential(final OCLKernel kernel, final TaskMetaData meta) {
         final int task;
         debugInfo(meta);
         if ((meta.getGlobalWork() == null) || (meta.getGlobalWork().length == 0)) {
@@ -312,7 +503,7 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
             // Ahead Of Time kernel execution
             task = deviceContext.enqueueNDRangeKernel(kernel, 1, null, meta.getGlobalWork(), meta.getLocalWork(), null);
         }
-        if (TornadoOptions.isProfilerEnabled()) {
+        if (ProfilerSampler.isTimed()) {
             Event tornadoKernelEvent = deviceContext.resolveEvent(task);
             tornadoKernelEvent.waitForEvents();
             long timer = meta.getProfiler().getTimer(ProfilerType.TOTAL_KERNEL_TIME);
@@ -324,7 +515,7 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
         return task;
     }
 
-    private int submitParallel(final TaskMetaData meta, long batchThreads) {
+    private int submitParallel(final OCLKernel kernel, final TaskMetaData meta, long batchThreads) {
         final int task;
         if (meta.enableThreadCoarsener()) {
             task = DEFAULT_SCHEDULER.submit(kernel, meta, batchThreads);
@@ -334,12 +525,12 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
         return task;
     }
 
-    private void launchKernel(final OCLCallStack stack, final TaskMetaData meta, long batchThreads) {
+    private void launchKernel(final OCLKernel kernel, final OCLCallStack stack, final TaskMetaData meta, long batchThreads) {
         final int task;
         if (meta.isParallel() || meta.isWorkerGridAvailable()) {
-            task = submitParallel(meta, batchThreads);
+            task = submitParallel(kernel, meta, batchThreads);
         } else {
-            task = submitSequential(meta);
+            task = submitSequential(kernel, meta);
         }
 
         if (meta.shouldDumpProfiles()) {
@@ -354,6 +545,7 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
     }
 
     private void checkKernelNotNull() {
+        linkPendingProgram();
         if (kernel == null) {
             throw new TornadoRuntimeException("[ERROR] Generated Kernel is NULL. \nPlease report this issue to https://github.com/beehive-lab/TornadoVM");
         }
@@ -362,7 +554,18 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
     private void submitWithoutEvents(final OCLCallStack stack, final ObjectBuffer atomicSpace, final TaskMetaData meta, long batchThreads) {
 
         checkKernelNotNull();
+        tierUp();
+
+        final OCLKernelPool pool = kernels;
+        final OCLKernel leased = pool.lease();
+        try {
+            submitWithoutEvents(leased, pool.bindArguments(leased, stack), stack, atomicSpace, meta, batchThreads);
+        } finally {
+            pool.release(leased);
+        }
+    }
 
+    private void submitWithoutEvents(final OCLKernel kernel, final boolean bindArguments, final OCLCallStack stack, final ObjectBuffer atomicSpace, final TaskMetaData meta, long batchThreads) {
         if (DEBUG) {
             info("kernel submitted: id=0x%x, method = %s, device =%s", kernel.getOclKernelID(), kernel.getName(), deviceContext.getDevice().getDeviceName());
             info("\tstack    : buffer id=0x%x, device=0x%x (0x%x)", stack.toBuffer(), stack.toAbsoluteAddress(), stack.toRelativeAddress());
@@ -372,16 +575,23 @@ public class OCLInstalledCode extends InstalledCode implements TornadoInstalledC
          * Only set the kernel arguments if they are either: - not set or - have changed
          */
         if (!stack.isOnDevice()) {
-            setKernelArgs(stack, atomicSpace, meta);
+            bindConstantRegion(stack, meta);
+            setKernelArgs(kernel, stack, atomicSpace, meta);
             stack.enqueueWrite();
+        } else if (bindArguments) {
+            setKernelArgs(kernel, stack, atomicSpace, meta);
         }
+        constantRegion.enqueueRefresh(null);
+        refreshImages(stack, null);
 
         guarantee(kernel != null, "kernel is null");
         if (meta == null) {
-            executeSingleThread();
+            executeSingleThread(kernel);
         } else {
-            launchKernel(stack, meta, batchThreads);
+            launchKernel(kernel, stack, meta, batchThreads);
         }
+        markWrittenImages(stack, meta);
+        markWrittenBuffers(meta);
     }
 
     @Override
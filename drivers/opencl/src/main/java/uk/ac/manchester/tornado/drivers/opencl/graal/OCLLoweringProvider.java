@@ -93,17 +93,19 @@ import jdk.vm.ci.meta.PrimitiveConstant;
 import jdk.vm.ci.meta.ResolvedJavaField;
 import jdk.vm.ci.meta.ResolvedJavaType;
 import uk.ac.manchester.tornado.api.exceptions.Debug;
+import uk.ac.manchester.tornado.api.exceptions.TornadoBailoutRuntimeException;
 import uk.ac.manchester.tornado.drivers.opencl.OCLTargetDescription;
 import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLKind;
+import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLAtomicIndexedWriteNode;
 import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLWriteAtomicNode;
 import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLWriteAtomicNode.ATOMIC_OPERATION;
 import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLWriteNode;
-import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.AtomicAddNode;
 import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.CastNode;
 import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.FixedArrayNode;
 import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.GlobalThreadIdNode;
 import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.GlobalThreadSizeNode;
 import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.LocalArrayNode;
+import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.ReadImageNode;
 import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.calc.DivNode;
 import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.vector.VectorLoadNode;
 import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.vector.VectorStoreNode;
@@ -111,6 +113,9 @@ import uk.ac.manchester.tornado.drivers.opencl.graal.phases.TornadoFloatingReadR
 import uk.ac.manchester.tornado.drivers.opencl.graal.snippets.ReduceCPUSnippets;
 import uk.ac.manchester.tornado.drivers.opencl.graal.snippets.ReduceGPUSnippets;
 import uk.ac.manchester.tornado.runtime.TornadoVMConfig;
+import uk.ac.manchester.tornado.runtime.graal.nodes.AtomicIndexedNode;
+import uk.ac.manchester.tornado.runtime.graal.nodes.AtomicIndexedNode.AtomicOperation;
+import uk.ac.manchester.tornado.runtime.graal.nodes.ImageReadNode;
 import uk.ac.manchester.tornado.runtime.graal.nodes.NewArrayNonVirtualizableNode;
 import uk.ac.manchester.tornado.runtime.graal.nodes.StoreAtomicIndexedNode;
 import uk.ac.manchester.tornado.runtime.graal.nodes.TornadoDirectCallTargetNode;
@@ -168,8 +173,8 @@ public class OCLLoweringProvider extends DefaultJavaLoweringProvider {
             lowerFloatConvertNode((FloatConvertNode) node);
         } else if (node instanceof NewArrayNonVirtualizableNode) {
             lowerNewArrayNode((NewArrayNonVirtualizableNode) node);
-        } else if (node instanceof AtomicAddNode) {
-            lowerAtomicAddNode((AtomicAddNode) node, tool);
+        } else if (node instanceof AtomicIndexedNode) {
+            lowerAtomicIndexedNode((AtomicIndexedNode) node);
         } else if (node instanceof LoadIndexedNode) {
             lowerLoadIndexedNode((LoadIndexedNode) node, tool);
         } else if (node instanceof StoreIndexedNode) {
@@ -184,6 +189,8 @@ public class OCLLoweringProvider extends DefaultJavaLoweringProvider {
             lowerArrayLengthNode((ArrayLengthNode) node, tool);
         } else if (node instanceof IntegerDivRemNode) {
             lowerIntegerDivRemNode((IntegerDivRemNode) node);
+        } else if (node instanceof ImageReadNode) {
+            lowerImageReadNode((ImageReadNode) node);
         } else if (node instanceof InstanceOfNode) {
             // ignore InstanceOfNode nodes
         } else {
@@ -371,8 +378,37 @@ public class OCLLoweringProvider extends DefaultJavaLoweringProvider {
         graph.replaceFixedWithFixed(storeField, memoryWrite);
     }
 
-    private void lowerAtomicAddNode(AtomicAddNode atomicAdd, LoweringTool tool) {
-        shouldNotReachHere("need to use builtin nodes");
+    /**
+     * 64-bit atomics come from OpenCL extensions: atom_add needs
+     * cl_khr_int64_base_atomics and atom_min/atom_max need
+     * cl_khr_int64_extended_atomics. Without them the driver rejects the kernel,
+     * so the task bails out to sequential Java instead.
+     */
+    private void checkLongAtomicsSupport(AtomicIndexedNode atomicIndexed) {
+        OCLTargetDescription oclTarget = (OCLTargetDescription) target;
+        boolean supported = atomicIndexed.getOperation() == AtomicOperation.ADD ? oclTarget.supportsInt64Atomics() : oclTarget.supportsInt64ExtendedAtomics();
+        if (!supported) {
+            throw new TornadoBailoutRuntimeException("[Bailout] 64-bit atomic " + atomicIndexed.getOperation() + " is not supported by the OpenCL device");
+        }
+    }
+
+    private void lowerAtomicIndexedNode(AtomicIndexedNode atomicIndexed) {
+        StructuredGraph graph = atomicIndexed.graph();
+        JavaKind elementKind = atomicIndexed.elementKind();
+        if (elementKind == JavaKind.Long) {
+            checkLongAtomicsSupport(atomicIndexed);
+        }
+        AddressNode address = createArrayAddress(graph, atomicIndexed.array(), elementKind, atomicIndexed.index());
+        OCLAtomicIndexedWriteNode atomicWrite = graph.add(new OCLAtomicIndexedWriteNode(address, NamedLocationIdentity.getArrayLocation(elementKind), atomicIndexed.value(),
+                OnHeapMemoryAccess.BarrierType.NONE, elementKind, atomicIndexed.getOperation()));
+        atomicWrite.setStateAfter(atomicIndexed.stateAfter());
+        graph.replaceFixedWithFixed(atomicIndexed, atomicWrite);
+    }
+
+    private void lowerImageReadNode(ImageReadNode imageRead) {
+        StructuredGraph graph = imageRead.graph();
+        ReadImageNode readImage = graph.addOrUnique(new ReadImageNode(imageRead));
+        graph.replaceFixedWithFloating(imageRead, readImage);
     }
 
     private void lowerInvoke(Invoke invoke, LoweringTool tool, StructuredGraph graph) {
@@ -25,6 +25,10 @@
  */
 package uk.ac.manchester.tornado.drivers.opencl.graal;
 
+import static org.graalvm.compiler.core.common.GraalOptions.ConditionalElimination;
+import static org.graalvm.compiler.core.common.GraalOptions.FullUnroll;
+import static org.graalvm.compiler.core.common.GraalOptions.ReassociateInvariants;
+
 import org.graalvm.compiler.java.GraphBuilderPhase;
 import org.graalvm.compiler.nodes.graphbuilderconf.GraphBuilderConfiguration;
 import org.graalvm.compiler.nodes.graphbuilderconf.GraphBuilderConfiguration.Plugins;
@@ -39,6 +43,7 @@ import jdk.vm.ci.meta.ResolvedJavaMethod;
 import uk.ac.manchester.tornado.api.TornadoDeviceContext;
 import uk.ac.manchester.tornado.drivers.opencl.graal.compiler.OCLCanonicalizer;
 import uk.ac.manchester.tornado.drivers.opencl.graal.compiler.OCLCompilerConfiguration;
+import uk.ac.manchester.tornado.runtime.common.TieredCompilation;
 import uk.ac.manchester.tornado.runtime.graal.TornadoLIRSuites;
 import uk.ac.manchester.tornado.runtime.graal.TornadoSuites;
 import uk.ac.manchester.tornado.runtime.graal.compiler.TornadoSketchTier;
@@ -49,6 +54,7 @@ public class OCLSuitesProvider implements TornadoSuitesProvider {
 
     private final PhaseSuite<HighTierContext> graphBuilderSuite;
     private final TornadoSuites suites;
+    private final TornadoSuites quickSuites;
     private final TornadoLIRSuites lirSuites;
     private final OCLCanonicalizer canonicalizer;
 
@@ -57,6 +63,7 @@ public class OCLSuitesProvider implements TornadoSuitesProvider {
         graphBuilderSuite = createGraphBuilderSuite(plugins);
         canonicalizer = new OCLCanonicalizer();
         suites = new TornadoSuites(options, deviceContext, compilerConfig, metaAccessProvider, canonicalizer, addressLowering);
+        quickSuites = TieredCompilation.isEnabled() ? new TornadoSuites(createQuickTierOptions(options), deviceContext, compilerConfig, metaAccessProvider, canonicalizer, addressLowering) : suites;
         lirSuites = createLIRSuites();
     }
 
@@ -64,6 +71,14 @@ public class OCLSuitesProvider implements TornadoSuitesProvider {
         canonicalizer.setContext(metaAccess, method, args, meta);
     }
 
+    /**
+     * The quick tier leaves out the Graal optimisations that do not change the
+     * shape of the generated kernel. The Tornado phases run in both tiers.
+     */
+    private static OptionValues createQuickTierOptions(OptionValues options) {
+        return new OptionValues(options, ConditionalElimination, false, FullUnroll, false, ReassociateInvariants, false);
+    }
+
     private PhaseSuite<HighTierContext> createGraphBuilderSuite(Plugins plugins) {
         PhaseSuite<HighTierContext> suite = new PhaseSuite<>();
 
@@ -84,6 +99,13 @@ public class OCLSuitesProvider implements TornadoSuitesProvider {
         return suites;
     }
 
+    /**
+     * Suites of the first tier of tiered compilation.
+     */
+    public TornadoSuites createQuickSuites() {
+        return quickSuites;
+    }
+
     @Override
     public PhaseSuite<HighTierContext> getGraphBuilderSuite() {
         return graphBuilderSuite;
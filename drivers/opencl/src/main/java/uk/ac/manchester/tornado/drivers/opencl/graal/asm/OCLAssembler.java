@@ -246,6 +246,13 @@ public final class OCLAssembler extends Assembler {
         public static final OCLUnaryIntrinsic SIN = new OCLUnaryIntrinsic("sin");
         public static final OCLUnaryIntrinsic COS = new OCLUnaryIntrinsic("cos");
 
+        public static final OCLUnaryIntrinsic NATIVE_EXP = new OCLUnaryIntrinsic("native_exp");
+        public static final OCLUnaryIntrinsic NATIVE_SQRT = new OCLUnaryIntrinsic("native_sqrt");
+        public static final OCLUnaryIntrinsic NATIVE_RSQRT = new OCLUnaryIntrinsic("native_rsqrt");
+        public static final OCLUnaryIntrinsic NATIVE_LOG = new OCLUnaryIntrinsic("native_log");
+        public static final OCLUnaryIntrinsic NATIVE_SIN = new OCLUnaryIntrinsic("native_sin");
+        public static final OCLUnaryIntrinsic NATIVE_COS = new OCLUnaryIntrinsic("native_cos");
+
         public static final OCLUnaryIntrinsic LOCAL_MEMORY = new OCLUnaryIntrinsic("__local");
 
         public static final OCLUnaryIntrinsic POPCOUNT = new OCLUnaryIntrinsic("popcount");
@@ -405,6 +412,9 @@ public final class OCLAssembler extends Assembler {
 
         public static final OCLBinaryIntrinsic DOT = new OCLBinaryIntrinsic("dot");
         public static final OCLBinaryIntrinsic CROSS = new OCLBinaryIntrinsic("cross");
+
+        public static final OCLBinaryIntrinsic READ_IMAGEF = new OCLBinaryIntrinsic("read_imagef");
+        public static final OCLBinaryIntrinsic READ_IMAGEI = new OCLBinaryIntrinsic("read_imagei");
         // @formatter:on
 
         protected OCLBinaryIntrinsic(String opcode) {
@@ -812,6 +822,47 @@ public final class OCLAssembler extends Assembler {
         //@formatter:on
     }
 
+    /**
+     * Emits the compare-and-swap loops used for atomic operations over floats,
+     * which have no builtin in OpenCL 1.x. The helpers are guarded, so that a
+     * kernel and its non-inlined callees can all request them.
+     */
+    public void emitAtomicFloatIntrinsics() {
+        //@formatter:off
+        emitLine("#ifndef TORNADO_ATOMIC_FLOAT_INTRINSICS");
+        emitLine("#define TORNADO_ATOMIC_FLOAT_INTRINSICS");
+        for (String[] operation : new String[][] { { "Add", "prevVal.floatVal + operand" }, { "Min", "fmin(prevVal.floatVal, operand)" }, { "Max", "fmax(prevVal.floatVal, operand)" } }) {
+            emitLine("inline void atomic" + operation[0] + "_Tornado_Floats(volatile __global float *source, const float operand) {\n" +
+                    "   union {\n" +
+                    "       unsigned int intVal;\n" +
+                    "       float floatVal;\n" +
+                    "   } newVal;\n" +
+                    "   union {\n" +
+                    "       unsigned int intVal;\n" +
+                    "       float floatVal;\n" +
+                    "   } prevVal;\n" +
+                    "   do {\n" +
+                    "       prevVal.floatVal = *source;\n" +
+                    "       newVal.floatVal = " + operation[1] + ";\n" +
+                    "   } while (atomic_cmpxchg((volatile __global unsigned int *)source, prevVal.intVal,\n" +
+                    "   newVal.intVal) != prevVal.intVal);\n" +
+                    "}");
+        }
+        emitLine("#endif");
+        //@formatter:on
+    }
+
+    /**
+     * Emits the sampler shared by all image reads. Images are addressed with
+     * unnormalised integer coordinates, so the sampler never filters.
+     */
+    public void emitImageSampler() {
+        emitLine("#ifndef TORNADO_IMAGE_SAMPLER");
+        emitLine("#define TORNADO_IMAGE_SAMPLER");
+        emitLine("__constant sampler_t %s = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_CLAMP_TO_EDGE | CLK_FILTER_NEAREST;", OCLAssemblerConstants.IMAGE_SAMPLER_NAME);
+        emitLine("#endif");
+    }
+
     public OCLAssembler(TargetDescription target) {
         super(target);
         indent = 0;
@@ -828,6 +879,10 @@ public final class OCLAssembler extends Assembler {
             emitLine("#pragma OPENCL EXTENSION cl_khr_int64_base_atomics : enable  ");
         }
 
+        if (((OCLTargetDescription) target).supportsInt64ExtendedAtomics()) {
+            emitLine("#pragma OPENCL EXTENSION cl_khr_int64_extended_atomics : enable  ");
+        }
+
         if (EMIT_INTRINSICS) {
             emitAtomicIntrinsics();
         }
@@ -47,6 +47,10 @@ public class OCLAssemblerConstants {
     public static final String FRAME_BASE_NAME = "_frame_base";
     public static final String FRAME_REF_NAME = "_frame";
 
+    public static final String READ_ONLY_IMAGE_2D = "__read_only image2d_t";
+    public static final String IMAGE_ARG_PREFIX = "_image";
+    public static final String IMAGE_SAMPLER_NAME = "_image_sampler";
+
     public static final String STMT_DELIMITER = ";";
     public static final String EXPR_DELIMITER = ",";
     public static final String COLON = ":";
@@ -114,9 +114,11 @@ import uk.ac.manchester.tornado.drivers.opencl.graal.compiler.OCLNodeLIRBuilder;
 import uk.ac.manchester.tornado.drivers.opencl.graal.compiler.OCLNodeMatchRules;
 import uk.ac.manchester.tornado.drivers.opencl.graal.compiler.OCLReferenceMapBuilder;
 import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLKind;
+import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLLIRStmt;
 import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.ThreadConfigurationNode;
 import uk.ac.manchester.tornado.drivers.opencl.mm.OCLByteBuffer;
 import uk.ac.manchester.tornado.runtime.TornadoCoreRuntime;
+import uk.ac.manchester.tornado.runtime.common.ImageFormat;
 import uk.ac.manchester.tornado.runtime.common.RuntimeUtilities;
 import uk.ac.manchester.tornado.runtime.common.Tornado;
 import uk.ac.manchester.tornado.runtime.common.TornadoAcceleratorDevice;
@@ -410,12 +412,29 @@ public class OCLBackend extends TornadoBackend<OCLProviders> implements FrameMap
 
     public void emitCode(OCLCompilationResultBuilder crb, LIR lir, ResolvedJavaMethod method) {
         final OCLAssembler asm = (OCLAssembler) crb.asm;
+        if (usesFloatAtomics(lir)) {
+            asm.emitAtomicFloatIntrinsics();
+        }
+        if (crb.isKernel() && !ImageFormat.getImageParameterIndexes(method).isEmpty()) {
+            asm.emitImageSampler();
+        }
         emitPrologue(crb, asm, method, lir);
         crb.emit(lir);
         emitEpilogue(asm);
 
     }
 
+    private boolean usesFloatAtomics(LIR lir) {
+        for (AbstractBlockBase<?> b : lir.linearScanOrder()) {
+            for (LIRInstruction insn : lir.getLIRforBlock(b)) {
+                if (insn instanceof OCLLIRStmt.AtomicIndexedStmt && ((OCLLIRStmt.AtomicIndexedStmt) insn).isFloatAtomic()) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
     private void emitEpilogue(OCLAssembler asm) {
         asm.endScope(" kernel");
     }
@@ -510,7 +529,12 @@ public class OCLBackend extends TornadoBackend<OCLProviders> implements FrameMap
 
             final String bumpBuffer = (deviceContext.needsBump()) ? String.format("%s void *dummy, ", OCLAssemblerConstants.GLOBAL_MEM_MODIFIER) : "";
 
-            asm.emitLine("%s void %s(%s%s)", OCLAssemblerConstants.KERNEL_MODIFIER, methodName, bumpBuffer, architecture.getABI());
+            final StringBuilder imageArgs = new StringBuilder();
+            for (int index : ImageFormat.getImageParameterIndexes(method)) {
+                imageArgs.append(String.format(", %s %s%d", OCLAssemblerConstants.READ_ONLY_IMAGE_2D, OCLAssemblerConstants.IMAGE_ARG_PREFIX, index));
+            }
+
+            asm.emitLine("%s void %s(%s%s%s)", OCLAssemblerConstants.KERNEL_MODIFIER, methodName, bumpBuffer, architecture.getABI(), imageArgs);
             asm.beginScope();
             emitVariableDefs(crb, asm, lir);
             asm.eol();
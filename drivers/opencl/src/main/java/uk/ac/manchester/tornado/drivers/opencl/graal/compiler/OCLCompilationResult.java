@@ -25,6 +25,7 @@ package uk.ac.manchester.tornado.drivers.opencl.graal.compiler;
 
 import java.nio.ByteBuffer;
 import java.util.Arrays;
+import java.util.HashSet;
 import java.util.Set;
 
 import org.graalvm.compiler.code.CompilationResult;
@@ -36,6 +37,7 @@ import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
 public class OCLCompilationResult extends CompilationResult {
 
     protected Set<ResolvedJavaMethod> nonInlinedMethods;
+    protected final Set<ResolvedJavaMethod> calleeMethods = new HashSet<>();
     protected TaskMetaData meta;
     protected OCLBackend backend;
     protected String id;
@@ -69,6 +71,24 @@ public class OCLCompilationResult extends CompilationResult {
         setTargetCode(newCode, size);
     }
 
+    public void addCompiledMethods(ResolvedJavaMethod[] methods) {
+        if (methods != null) {
+            calleeMethods.addAll(Arrays.asList(methods));
+        }
+    }
+
+    /**
+     * Returns every method whose bytecode contributed to the generated source:
+     * the kernel, the methods inlined into it and the compiled callees.
+     */
+    public Set<ResolvedJavaMethod> getCompiledMethods() {
+        final Set<ResolvedJavaMethod> compiledMethods = new HashSet<>(calleeMethods);
+        if (getMethods() != null) {
+            compiledMethods.addAll(Arrays.asList(getMethods()));
+        }
+        return compiledMethods;
+    }
+
     public TaskMetaData getMeta() {
         return meta;
     }
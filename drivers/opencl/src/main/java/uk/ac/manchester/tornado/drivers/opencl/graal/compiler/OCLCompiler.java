@@ -88,6 +88,7 @@ import uk.ac.manchester.tornado.drivers.opencl.graal.OCLProviders;
 import uk.ac.manchester.tornado.drivers.opencl.graal.OCLSuitesProvider;
 import uk.ac.manchester.tornado.drivers.opencl.graal.backend.OCLBackend;
 import uk.ac.manchester.tornado.drivers.opencl.graal.compiler.OCLLIRGenerationPhase.LIRGenerationContext;
+import uk.ac.manchester.tornado.drivers.opencl.graal.phases.OCLConstantParameterPlacement;
 import uk.ac.manchester.tornado.runtime.TornadoCoreRuntime;
 import uk.ac.manchester.tornado.runtime.common.Tornado;
 import uk.ac.manchester.tornado.runtime.graal.TornadoLIRSuites;
@@ -241,6 +242,14 @@ public class OCLCompiler {
             final LowTierContext lowTierContext = new LowTierContext(providers, backend);
             suites.getLowTier().apply(graph, lowTierContext);
 
+            /*
+             * The placement needs the task metadata, which the low tier context does not
+             * carry, so it runs on the final graph with the mid tier context.
+             */
+            if (isKernel) {
+                new OCLConstantParameterPlacement().apply(graph, midTierContext);
+            }
+
             getDebugContext().dump(DebugContext.BASIC_LEVEL, graph.getLastSchedule(), "Final HIR schedule");
         } catch (Throwable e) {
             throw getDebugContext().handle(e);
@@ -409,12 +418,21 @@ public class OCLCompiler {
             workList.addAll(compResult.getNonInlinedMethods());
 
             kernelCompResult.addCompiledMethodCode(compResult.getTargetCode());
+            kernelCompResult.addCompiledMethods(compResult.getMethods());
         }
 
         return kernelCompResult;
     }
 
     public static OCLCompilationResult compileSketchForDevice(Sketch sketch, CompilableTask task, OCLProviders providers, OCLBackend backend) {
+        return compileSketchForDevice(sketch, task, providers, backend, false);
+    }
+
+    /**
+     * Compiles a task from its sketch. The quick tier of tiered compilation
+     * leaves out the Graal optimisations to install a first kernel sooner.
+     */
+    public static OCLCompilationResult compileSketchForDevice(Sketch sketch, CompilableTask task, OCLProviders providers, OCLBackend backend, boolean quickTier) {
 
         final StructuredGraph kernelGraph = (StructuredGraph) sketch.getGraph().getReadonlyCopy().copy(getDebugContext());
         ResolvedJavaMethod resolvedMethod = kernelGraph.method();
@@ -435,8 +453,9 @@ public class OCLCompiler {
         Set<ResolvedJavaMethod> methods = new HashSet<>();
 
         final OCLSuitesProvider suitesProvider = providers.getSuitesProvider();
+        final TornadoSuites suites = quickTier ? suitesProvider.createQuickSuites() : suitesProvider.createSuites();
         Request<OCLCompilationResult> kernelCompilationRequest = new Request<>(kernelGraph, resolvedMethod, args, taskMeta, providers, backend, suitesProvider.getGraphBuilderSuite(), optimisticOpts,
-                profilingInfo, suitesProvider.createSuites(), suitesProvider.getLIRSuites(), kernelCompResult, factory, true, false, batchThreads);
+                profilingInfo, suites, suitesProvider.getLIRSuites(), kernelCompResult, factory, true, false, batchThreads);
 
         kernelCompilationRequest.execute();
 
@@ -456,7 +475,7 @@ public class OCLCompiler {
 
             Request<OCLCompilationResult> methodCompilationRequest = new Request<>(graph, currentMethod, //
                     null, null, providers, backend, suitesProvider.getGraphBuilderSuite(), //
-                    optimisticOpts, profilingInfo, suitesProvider.createSuites(), suitesProvider.getLIRSuites(), //
+                    optimisticOpts, profilingInfo, suites, suitesProvider.getLIRSuites(), //
                     compResult, factory, false, false, 0);
 
             methodCompilationRequest.execute();
@@ -468,6 +487,7 @@ public class OCLCompiler {
             }
 
             kernelCompResult.addCompiledMethodCode(compResult.getTargetCode());
+            kernelCompResult.addCompiledMethods(compResult.getMethods());
         }
 
         if (DUMP_COMPILED_METHODS) {
@@ -26,6 +26,7 @@
 package uk.ac.manchester.tornado.drivers.opencl.graal.compiler;
 
 import static org.graalvm.compiler.core.common.GraalOptions.ConditionalElimination;
+import static org.graalvm.compiler.core.common.GraalOptions.FullUnroll;
 import static org.graalvm.compiler.core.common.GraalOptions.ImmutableCode;
 import static org.graalvm.compiler.core.common.GraalOptions.OptConvertDeoptsToGuards;
 import static org.graalvm.compiler.core.common.GraalOptions.PartialEscapeAnalysis;
@@ -49,6 +50,7 @@ import org.graalvm.compiler.virtual.phases.ea.PartialEscapePhase;
 
 import jdk.vm.ci.meta.MetaAccessProvider;
 import uk.ac.manchester.tornado.api.TornadoDeviceContext;
+import uk.ac.manchester.tornado.drivers.opencl.graal.phases.OCLFastMathPhase;
 import uk.ac.manchester.tornado.drivers.opencl.graal.phases.TornadoNewArrayDevirtualizationReplacement;
 import uk.ac.manchester.tornado.drivers.opencl.graal.phases.TornadoOpenCLIntrinsicsReplacements;
 import uk.ac.manchester.tornado.drivers.opencl.graal.phases.TornadoParallelScheduler;
@@ -58,7 +60,9 @@ import uk.ac.manchester.tornado.drivers.opencl.graal.phases.TornadoThreadSchedul
 import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
 import uk.ac.manchester.tornado.runtime.graal.compiler.TornadoHighTier;
 import uk.ac.manchester.tornado.runtime.graal.phases.ExceptionSuppression;
+import uk.ac.manchester.tornado.runtime.graal.phases.TornadoCoalescingAnalysis;
 import uk.ac.manchester.tornado.runtime.graal.phases.TornadoFullInliningPolicy;
+import uk.ac.manchester.tornado.runtime.graal.phases.TornadoImageReadSelection;
 import uk.ac.manchester.tornado.runtime.graal.phases.TornadoInliningPolicy;
 import uk.ac.manchester.tornado.runtime.graal.phases.TornadoLocalMemoryAllocation;
 import uk.ac.manchester.tornado.runtime.graal.phases.TornadoPartialInliningPolicy;
@@ -94,9 +98,13 @@ public class OCLHighTier extends TornadoHighTier {
         }
 
         appendPhase(new TornadoTaskSpecialisation(canonicalizer));
+        appendPhase(new OCLFastMathPhase());
         appendPhase(canonicalizer);
         appendPhase(new DeadCodeEliminationPhase(Optional));
 
+        // Needs the inlined graph to see every write to an image
+        appendPhase(new TornadoImageReadSelection());
+
         appendPhase(canonicalizer);
 
         appendPhase(new TornadoNewArrayDevirtualizationReplacement());
@@ -110,6 +118,7 @@ public class OCLHighTier extends TornadoHighTier {
             appendPhase(new ConvertDeoptimizeToGuardPhase());
         }
 
+        appendPhase(new TornadoCoalescingAnalysis());
         appendPhase(new TornadoShapeAnalysis());
         appendPhase(canonicalizer);
         appendPhase(new TornadoParallelScheduler());
@@ -117,7 +126,7 @@ public class OCLHighTier extends TornadoHighTier {
         if (deviceContext.isPlatformFPGA()) {
             appendPhase(new TornadoPragmaUnroll());
             appendPhase(new TornadoThreadScheduler());
-        } else {
+        } else if (FullUnroll.getValue(options)) {
             LoopPolicies loopPolicies = new DefaultLoopPolicies();
             appendPhase(new LoopFullUnrollPhase(canonicalizer, loopPolicies));
         }
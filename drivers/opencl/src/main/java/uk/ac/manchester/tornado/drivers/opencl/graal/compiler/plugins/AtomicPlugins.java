@@ -31,25 +31,46 @@ import org.graalvm.compiler.nodes.graphbuilderconf.InvocationPlugins.Registratio
 
 import jdk.vm.ci.meta.JavaKind;
 import jdk.vm.ci.meta.ResolvedJavaMethod;
+import uk.ac.manchester.tornado.api.atomics.TornadoAtomics;
 import uk.ac.manchester.tornado.api.collections.types.FloatOps;
-import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.AtomicAddNode;
+import uk.ac.manchester.tornado.runtime.graal.nodes.AtomicIndexedNode;
+import uk.ac.manchester.tornado.runtime.graal.nodes.AtomicIndexedNode.AtomicOperation;
 
 public class AtomicPlugins {
 
     public static void registerPlugins(InvocationPlugins plugins) {
         registerAtomicPlugins(plugins);
+        registerTornadoAtomicsPlugins(plugins);
     }
 
     private static void registerAtomicPlugins(InvocationPlugins plugins) {
         Registration r = new Registration(plugins, FloatOps.class);
+        registerAtomicIndexed(r, "atomicAdd", float[].class, float.class, JavaKind.Float, AtomicOperation.ADD);
+    }
+
+    private static void registerTornadoAtomicsPlugins(InvocationPlugins plugins) {
+        Registration r = new Registration(plugins, TornadoAtomics.class);
 
-        r.register3("atomicAdd", float[].class, int.class, float.class, new InvocationPlugin() {
+        registerAtomicIndexed(r, "atomicAdd", int[].class, int.class, JavaKind.Int, AtomicOperation.ADD);
+        registerAtomicIndexed(r, "atomicAdd", long[].class, long.class, JavaKind.Long, AtomicOperation.ADD);
+        registerAtomicIndexed(r, "atomicAdd", float[].class, float.class, JavaKind.Float, AtomicOperation.ADD);
+
+        registerAtomicIndexed(r, "atomicMin", int[].class, int.class, JavaKind.Int, AtomicOperation.MIN);
+        registerAtomicIndexed(r, "atomicMin", long[].class, long.class, JavaKind.Long, AtomicOperation.MIN);
+        registerAtomicIndexed(r, "atomicMin", float[].class, float.class, JavaKind.Float, AtomicOperation.MIN);
+
+        registerAtomicIndexed(r, "atomicMax", int[].class, int.class, JavaKind.Int, AtomicOperation.MAX);
+        registerAtomicIndexed(r, "atomicMax", long[].class, long.class, JavaKind.Long, AtomicOperation.MAX);
+        registerAtomicIndexed(r, "atomicMax", float[].class, float.class, JavaKind.Float, AtomicOperation.MAX);
+    }
+
+    private static void registerAtomicIndexed(Registration r, String methodName, Class<?> arrayType, Class<?> valueType, JavaKind elementKind, AtomicOperation operation) {
+        r.register3(methodName, arrayType, int.class, valueType, new InvocationPlugin() {
 
             @Override
             public boolean apply(GraphBuilderContext b, ResolvedJavaMethod targetMethod, Receiver receiver, ValueNode array, ValueNode index, ValueNode value) {
-
-                final AtomicAddNode atomicAddNode = new AtomicAddNode(array, index, JavaKind.Float, value);
-                b.append(atomicAddNode);
+                final AtomicIndexedNode atomicNode = new AtomicIndexedNode(array, index, elementKind, value, operation);
+                b.append(atomicNode);
                 return true;
             }
 
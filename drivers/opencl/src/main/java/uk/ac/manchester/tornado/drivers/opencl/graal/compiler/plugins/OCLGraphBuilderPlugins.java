@@ -82,9 +82,11 @@ public class OCLGraphBuilderPlugins {
 
         // Register Atomics
         registerTornadoVMAtomicsPlugins(plugins);
+        AtomicPlugins.registerPlugins(plugins);
 
         OCLMathPlugins.registerTornadoMathPlugins(plugins);
         VectorPlugins.registerPlugins(ps, plugins);
+        OCLImagePlugins.registerPlugins(plugins);
 
         // Register TornadoAtomicInteger
         registerTornadoAtomicInteger(ps, plugins);
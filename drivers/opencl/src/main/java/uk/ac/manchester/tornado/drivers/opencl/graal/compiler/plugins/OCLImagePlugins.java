@@ -0,0 +1,100 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.drivers.opencl.graal.compiler.plugins;
+
+import static uk.ac.manchester.tornado.runtime.common.Tornado.ENABLE_VECTORS;
+
+import org.graalvm.compiler.nodes.ParameterNode;
+import org.graalvm.compiler.nodes.ValueNode;
+import org.graalvm.compiler.nodes.graphbuilderconf.GraphBuilderContext;
+import org.graalvm.compiler.nodes.graphbuilderconf.InvocationPlugin;
+import org.graalvm.compiler.nodes.graphbuilderconf.InvocationPlugin.Receiver;
+import org.graalvm.compiler.nodes.graphbuilderconf.InvocationPlugins;
+import org.graalvm.compiler.nodes.graphbuilderconf.InvocationPlugins.Registration;
+
+import jdk.vm.ci.meta.JavaKind;
+import jdk.vm.ci.meta.ResolvedJavaMethod;
+import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLKind;
+import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.vector.VectorValueNode;
+import uk.ac.manchester.tornado.runtime.common.ImageFormat;
+import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
+import uk.ac.manchester.tornado.runtime.graal.nodes.ImageReadNode;
+
+/**
+ * When images are enabled, {@code get(x, y)} on an image kernel parameter is
+ * compiled into sampled reads of the image bound to that parameter, one per
+ * channel. Any other access falls back to the regular array-based
+ * implementation.
+ */
+public class OCLImagePlugins {
+
+    public static void registerPlugins(InvocationPlugins plugins) {
+        if (!TornadoOptions.USE_IMAGES) {
+            return;
+        }
+
+        registerScalarImagePlugin(plugins, ImageFormat.FLOAT);
+        if (ENABLE_VECTORS) {
+            registerVectorImagePlugin(plugins, ImageFormat.FLOAT3, OCLKind.FLOAT3);
+            registerVectorImagePlugin(plugins, ImageFormat.FLOAT4, OCLKind.FLOAT4);
+            registerVectorImagePlugin(plugins, ImageFormat.BYTE3, OCLKind.CHAR3);
+            registerVectorImagePlugin(plugins, ImageFormat.BYTE4, OCLKind.CHAR4);
+        }
+    }
+
+    private static void registerScalarImagePlugin(InvocationPlugins plugins, ImageFormat format) {
+        Registration r = new Registration(plugins, format.getJavaClass());
+        r.register3("get", Receiver.class, int.class, int.class, new InvocationPlugin() {
+            @Override
+            public boolean apply(GraphBuilderContext b, ResolvedJavaMethod targetMethod, Receiver receiver, ValueNode x, ValueNode y) {
+                // Kernel parameters are never null, so no null check is needed
+                ValueNode image = receiver.get(false);
+                if (!(image instanceof ParameterNode)) {
+                    return false;
+                }
+                b.addPush(format.getElementKind(), new ImageReadNode(image, format, 0, x, y));
+                return true;
+            }
+        });
+    }
+
+    private static void registerVectorImagePlugin(InvocationPlugins plugins, ImageFormat format, OCLKind vectorKind) {
+        Registration r = new Registration(plugins, format.getJavaClass());
+        r.register3("get", Receiver.class, int.class, int.class, new InvocationPlugin() {
+            @Override
+            public boolean apply(GraphBuilderContext b, ResolvedJavaMethod targetMethod, Receiver receiver, ValueNode x, ValueNode y) {
+                ValueNode image = receiver.get(false);
+                if (!(image instanceof ParameterNode)) {
+                    return false;
+                }
+                final VectorValueNode vector = b.append(new VectorValueNode(vectorKind));
+                for (int channel = 0; channel < format.getPixelChannels(); channel++) {
+                    vector.setElement(channel, b.add(new ImageReadNode(image, format, channel, x, y)));
+                }
+                b.push(JavaKind.Object, vector);
+                return true;
+            }
+        });
+    }
+}
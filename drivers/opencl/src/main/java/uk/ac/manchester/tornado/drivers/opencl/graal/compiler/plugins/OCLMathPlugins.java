@@ -32,6 +32,12 @@ import static uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLFPUnaryIntr
 import static uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLFPUnaryIntrinsicNode.Operation.FABS;
 import static uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLFPUnaryIntrinsicNode.Operation.FLOOR;
 import static uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLFPUnaryIntrinsicNode.Operation.LOG;
+import static uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLFPUnaryIntrinsicNode.Operation.NATIVE_COS;
+import static uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLFPUnaryIntrinsicNode.Operation.NATIVE_EXP;
+import static uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLFPUnaryIntrinsicNode.Operation.NATIVE_LOG;
+import static uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLFPUnaryIntrinsicNode.Operation.NATIVE_RSQRT;
+import static uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLFPUnaryIntrinsicNode.Operation.NATIVE_SIN;
+import static uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLFPUnaryIntrinsicNode.Operation.NATIVE_SQRT;
 import static uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLFPUnaryIntrinsicNode.Operation.SIN;
 import static uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLFPUnaryIntrinsicNode.Operation.SQRT;
 import static uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLIntBinaryIntrinsicNode.Operation.MAX;
@@ -62,6 +68,7 @@ public class OCLMathPlugins {
 
         registerFloatMath1Plugins(registration, float.class, JavaKind.Float);
         registerTrigonometric1Plugins(registration, float.class, JavaKind.Float);
+        registerFastMath1Plugins(registration, float.class, JavaKind.Float);
         registerFloatMath2Plugins(registration, float.class, JavaKind.Float);
         registerFloatMath3Plugins(registration, float.class, JavaKind.Float);
 
@@ -154,6 +161,61 @@ public class OCLMathPlugins {
         });
     }
 
+    /**
+     * The fast variants always lower to the native_* builtins, independently of
+     * the fast-math mode of the compilation. OpenCL only defines them for single
+     * precision.
+     */
+    private static void registerFastMath1Plugins(Registration r, Class<?> type, JavaKind kind) {
+        r.register1("fastExp", type, new InvocationPlugin() {
+            @Override
+            public boolean apply(GraphBuilderContext b, ResolvedJavaMethod targetMethod, Receiver receiver, ValueNode value) {
+                b.push(kind, b.append(OCLFPUnaryIntrinsicNode.create(value, NATIVE_EXP, kind)));
+                return true;
+            }
+        });
+
+        r.register1("fastLog", type, new InvocationPlugin() {
+            @Override
+            public boolean apply(GraphBuilderContext b, ResolvedJavaMethod targetMethod, Receiver receiver, ValueNode value) {
+                b.push(kind, b.append(OCLFPUnaryIntrinsicNode.create(value, NATIVE_LOG, kind)));
+                return true;
+            }
+        });
+
+        r.register1("fastSin", type, new InvocationPlugin() {
+            @Override
+            public boolean apply(GraphBuilderContext b, ResolvedJavaMethod targetMethod, Receiver receiver, ValueNode value) {
+                b.push(kind, b.append(OCLFPUnaryIntrinsicNode.create(value, NATIVE_SIN, kind)));
+                return true;
+            }
+        });
+
+        r.register1("fastCos", type, new InvocationPlugin() {
+            @Override
+            public boolean apply(GraphBuilderContext b, ResolvedJavaMethod targetMethod, Receiver receiver, ValueNode value) {
+                b.push(kind, b.append(OCLFPUnaryIntrinsicNode.create(value, NATIVE_COS, kind)));
+                return true;
+            }
+        });
+
+        r.register1("fastSqrt", type, new InvocationPlugin() {
+            @Override
+            public boolean apply(GraphBuilderContext b, ResolvedJavaMethod targetMethod, Receiver receiver, ValueNode value) {
+                b.push(kind, b.append(OCLFPUnaryIntrinsicNode.create(value, NATIVE_SQRT, kind)));
+                return true;
+            }
+        });
+
+        r.register1("fastRsqrt", type, new InvocationPlugin() {
+            @Override
+            public boolean apply(GraphBuilderContext b, ResolvedJavaMethod targetMethod, Receiver receiver, ValueNode value) {
+                b.push(kind, b.append(OCLFPUnaryIntrinsicNode.create(value, NATIVE_RSQRT, kind)));
+                return true;
+            }
+        });
+    }
+
     private static void registerFloatMath2Plugins(Registration r, Class<?> type, JavaKind kind) {
 
         r.register2("min", type, type, new InvocationPlugin() {
@@ -93,6 +93,14 @@ public class OCLAddressNode extends AddressNode implements LIRLowerable {
         return index;
     }
 
+    public OCLMemoryBase getMemoryRegister() {
+        return memoryRegister;
+    }
+
+    public void setMemoryRegister(OCLMemoryBase memoryRegister) {
+        this.memoryRegister = memoryRegister;
+    }
+
     @Override
     public long getMaxConstantDisplacement() {
         return 0;
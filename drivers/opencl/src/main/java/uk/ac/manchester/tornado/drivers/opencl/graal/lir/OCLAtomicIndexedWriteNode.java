@@ -0,0 +1,103 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Authors: James Clarkson
+ *
+ */
+
+package uk.ac.manchester.tornado.drivers.opencl.graal.lir;
+
+import static uk.ac.manchester.tornado.api.exceptions.TornadoInternalError.guarantee;
+
+import org.graalvm.compiler.core.common.LIRKind;
+import org.graalvm.compiler.core.common.type.Stamp;
+import org.graalvm.compiler.graph.NodeClass;
+import org.graalvm.compiler.nodeinfo.NodeInfo;
+import org.graalvm.compiler.nodes.NodeView;
+import org.graalvm.compiler.nodes.ValueNode;
+import org.graalvm.compiler.nodes.memory.AbstractWriteNode;
+import org.graalvm.compiler.nodes.memory.LIRLowerableAccess;
+import org.graalvm.compiler.nodes.memory.address.AddressNode;
+import org.graalvm.compiler.nodes.spi.NodeLIRBuilderTool;
+import org.graalvm.word.LocationIdentity;
+
+import jdk.vm.ci.meta.JavaKind;
+import jdk.vm.ci.meta.Value;
+import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLUnary.MemoryAccess;
+import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLUnary.OCLAddressCast;
+import uk.ac.manchester.tornado.runtime.graal.nodes.AtomicIndexedNode.AtomicOperation;
+
+/**
+ * Atomically combines a {@linkplain #value() value} with the array element at
+ * the given {@linkplain AddressNode address}.
+ */
+@NodeInfo(nameTemplate = "OCLAtomicIndexedWrite#{p#location/s}")
+public class OCLAtomicIndexedWriteNode extends AbstractWriteNode implements LIRLowerableAccess {
+
+    public static final NodeClass<OCLAtomicIndexedWriteNode> TYPE = NodeClass.create(OCLAtomicIndexedWriteNode.class);
+
+    private final JavaKind elementKind;
+    private final AtomicOperation operation;
+
+    public OCLAtomicIndexedWriteNode(AddressNode address, LocationIdentity location, ValueNode value, BarrierType barrierType, JavaKind elementKind, AtomicOperation operation) {
+        super(TYPE, address, location, value, barrierType);
+        this.elementKind = elementKind;
+        this.operation = operation;
+    }
+
+    @Override
+    public Stamp getAccessStamp(NodeView view) {
+        return value().stamp(view);
+    }
+
+    private OCLKind resolveKind() {
+        switch (elementKind) {
+            case Int:
+                return OCLKind.INT;
+            case Long:
+                return OCLKind.LONG;
+            case Float:
+                return OCLKind.FLOAT;
+            default:
+                throw new RuntimeException("Data type for atomics not supported yet: " + elementKind);
+        }
+    }
+
+    @Override
+    public void generate(NodeLIRBuilderTool gen) {
+        Value address = gen.operand(getAddress());
+        guarantee(address instanceof MemoryAccess, "atomic operations require a memory access: %s", address);
+        MemoryAccess memAccess = (MemoryAccess) address;
+        OCLAddressCast cast = new OCLAddressCast(memAccess.getBase(), LIRKind.value(resolveKind()));
+        gen.getLIRGeneratorTool().append(new OCLLIRStmt.AtomicIndexedStmt(cast, memAccess, gen.operand(value()), operation, resolveKind()));
+    }
+
+    @Override
+    public boolean canNullCheck() {
+        return false;
+    }
+
+    @Override
+    public LocationIdentity getKilledLocationIdentity() {
+        return getLocationIdentity();
+    }
+}
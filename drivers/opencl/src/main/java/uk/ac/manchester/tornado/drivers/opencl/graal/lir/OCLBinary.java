@@ -29,11 +29,14 @@ import org.graalvm.compiler.core.common.LIRKind;
 import org.graalvm.compiler.lir.LIRInstruction.Use;
 import org.graalvm.compiler.lir.Opcode;
 
+import jdk.vm.ci.meta.JavaKind;
 import jdk.vm.ci.meta.Value;
 import uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler;
+import uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssemblerConstants;
 import uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCLBinaryIntrinsic;
 import uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCLBinaryOp;
 import uk.ac.manchester.tornado.drivers.opencl.graal.compiler.OCLCompilationResultBuilder;
+import uk.ac.manchester.tornado.runtime.common.ImageFormat;
 
 public class OCLBinary {
 
@@ -153,4 +156,46 @@ public class OCLBinary {
         }
 
     }
+
+    /**
+     * Reads one channel of a pixel of a 2D image bound to a kernel argument.
+     * The channels of a 3-channel pixel are consecutive texels of a
+     * single-channel image.
+     */
+    public static class ReadImage extends BinaryConsumer {
+
+        private static final String[] CHANNELS = { "x", "y", "z", "w" };
+
+        private final int imageIndex;
+        private final ImageFormat format;
+        private final int channel;
+
+        public ReadImage(LIRKind lirKind, int imageIndex, ImageFormat format, int channel, Value x, Value y) {
+            super(format.getElementKind() == JavaKind.Float ? OCLBinaryIntrinsic.READ_IMAGEF : OCLBinaryIntrinsic.READ_IMAGEI, lirKind, x, y);
+            this.imageIndex = imageIndex;
+            this.format = format;
+            this.channel = channel;
+        }
+
+        @Override
+        public void emit(OCLCompilationResultBuilder crb, OCLAssembler asm) {
+            if (opcode == OCLBinaryIntrinsic.READ_IMAGEI) {
+                asm.emit("(char) ");
+            }
+            asm.emit(opcode.toString());
+            asm.emit("(%s%d, %s, (int2)(", OCLAssemblerConstants.IMAGE_ARG_PREFIX, imageIndex, OCLAssemblerConstants.IMAGE_SAMPLER_NAME);
+            asm.emitValueOrOp(crb, x);
+            if (format.isSplitPixel()) {
+                asm.emit(" * %d + %d", format.getPixelChannels(), channel);
+            }
+            asm.emit(", ");
+            asm.emitValueOrOp(crb, y);
+            asm.emit(")).%s", CHANNELS[format.isSplitPixel() ? 0 : channel]);
+        }
+
+        @Override
+        public String toString() {
+            return String.format("%s(%s%d, %s, %s).%d", opcode.toString(), OCLAssemblerConstants.IMAGE_ARG_PREFIX, imageIndex, x, y, channel);
+        }
+    }
 }
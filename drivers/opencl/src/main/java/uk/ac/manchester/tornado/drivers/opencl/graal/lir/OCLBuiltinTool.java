@@ -41,6 +41,12 @@ import static uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCL
 import static uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCLUnaryIntrinsic.FLOAT_FLOOR;
 import static uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCLUnaryIntrinsic.FLOAT_TRUNC;
 import static uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCLUnaryIntrinsic.LOG;
+import static uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCLUnaryIntrinsic.NATIVE_COS;
+import static uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCLUnaryIntrinsic.NATIVE_EXP;
+import static uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCLUnaryIntrinsic.NATIVE_LOG;
+import static uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCLUnaryIntrinsic.NATIVE_RSQRT;
+import static uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCLUnaryIntrinsic.NATIVE_SIN;
+import static uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCLUnaryIntrinsic.NATIVE_SQRT;
 import static uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCLUnaryIntrinsic.POPCOUNT;
 import static uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCLUnaryIntrinsic.SIN;
 import static uk.ac.manchester.tornado.drivers.opencl.graal.asm.OCLAssembler.OCLUnaryIntrinsic.SQRT;
@@ -253,6 +259,36 @@ public class OCLBuiltinTool {
         return new OCLUnary.Intrinsic(FLOAT_TRUNC, LIRKind.value(input.getPlatformKind()), input);
     }
 
+    public Value genFloatNativeCos(Value input) {
+        trace("genNativeCos: native_cos(%s)", input);
+        return new OCLUnary.Intrinsic(NATIVE_COS, LIRKind.value(input.getPlatformKind()), input);
+    }
+
+    public Value genFloatNativeExp(Value input) {
+        trace("genNativeExp: native_exp(%s)", input);
+        return new OCLUnary.Intrinsic(NATIVE_EXP, LIRKind.value(input.getPlatformKind()), input);
+    }
+
+    public Value genFloatNativeLog(Value input) {
+        trace("genNativeLog: native_log(%s)", input);
+        return new OCLUnary.Intrinsic(NATIVE_LOG, LIRKind.value(input.getPlatformKind()), input);
+    }
+
+    public Value genFloatNativeRSqrt(Value input) {
+        trace("genNativeRSqrt: native_rsqrt(%s)", input);
+        return new OCLUnary.Intrinsic(NATIVE_RSQRT, LIRKind.value(input.getPlatformKind()), input);
+    }
+
+    public Value genFloatNativeSin(Value input) {
+        trace("genNativeSin: native_sin(%s)", input);
+        return new OCLUnary.Intrinsic(NATIVE_SIN, LIRKind.value(input.getPlatformKind()), input);
+    }
+
+    public Value genFloatNativeSqrt(Value input) {
+        trace("genNativeSqrt: native_sqrt(%s)", input);
+        return new OCLUnary.Intrinsic(NATIVE_SQRT, LIRKind.value(input.getPlatformKind()), input);
+    }
+
     public Value genFloatATan2(Value x, Value y) {
         unimplemented();
         return null;
@@ -37,6 +37,7 @@ import uk.ac.manchester.tornado.drivers.opencl.graal.compiler.OCLCompilationResu
 import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLUnary.MemoryAccess;
 import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLUnary.OCLAddressCast;
 import uk.ac.manchester.tornado.drivers.opencl.graal.meta.OCLMemorySpace;
+import uk.ac.manchester.tornado.runtime.graal.nodes.AtomicIndexedNode.AtomicOperation;
 
 public class OCLLIRStmt {
 
@@ -798,6 +799,102 @@ public class OCLLIRStmt {
         }
     }
 
+    @Opcode("ATOMIC_INDEXED")
+    public static class AtomicIndexedStmt extends AbstractInstruction {
+
+        public static final LIRInstructionClass<AtomicIndexedStmt> TYPE = LIRInstructionClass.create(AtomicIndexedStmt.class);
+
+        @Use
+        protected Value rhs;
+        @Use
+        protected OCLAddressCast cast;
+        @Use
+        protected MemoryAccess address;
+
+        private final AtomicOperation operation;
+        private final OCLKind kind;
+
+        public AtomicIndexedStmt(OCLAddressCast cast, MemoryAccess address, Value rhs, AtomicOperation operation, OCLKind kind) {
+            super(TYPE);
+            this.rhs = rhs;
+            this.cast = cast;
+            this.address = address;
+            this.operation = operation;
+            this.kind = kind;
+        }
+
+        /**
+         * Integer atomics are OpenCL builtins (the 64-bit versions come from the
+         * cl_khr_int64_*_atomics extensions). Floats have no builtin in OpenCL 1.x,
+         * so they call the compare-and-swap helpers that the backend emits ahead of
+         * the kernel (see {@link OCLAssembler#emitAtomicFloatIntrinsics()}).
+         */
+        private String resolveFunctionName() {
+            String operationName;
+            switch (operation) {
+                case ADD:
+                    operationName = "add";
+                    break;
+                case MIN:
+                    operationName = "min";
+                    break;
+                case MAX:
+                    operationName = "max";
+                    break;
+                default:
+                    throw new RuntimeException("Atomic operation not supported yet: " + operation);
+            }
+            switch (kind) {
+                case INT:
+                    return "atomic_" + operationName;
+                case LONG:
+                    return "atom_" + operationName;
+                case FLOAT:
+                    return "atomic" + Character.toUpperCase(operationName.charAt(0)) + operationName.substring(1) + "_Tornado_Floats";
+                default:
+                    throw new RuntimeException("Data type for atomics not supported yet: " + kind);
+            }
+        }
+
+        @Override
+        public void emitCode(OCLCompilationResultBuilder crb, OCLAssembler asm) {
+            String functionName = resolveFunctionName();
+            asm.indent();
+            asm.emit(functionName);
+            asm.emit("( &(");
+            asm.emit("*(");
+            cast.emit(crb, asm);
+            asm.space();
+            address.emit(crb, asm);
+            asm.emit(")), ");
+            asm.space();
+            asm.emitValue(crb, rhs);
+            asm.emit(")");
+            asm.delimiter();
+            asm.eol();
+        }
+
+        public Value getRhs() {
+            return rhs;
+        }
+
+        public OCLAddressCast getCast() {
+            return cast;
+        }
+
+        public MemoryAccess getAddress() {
+            return address;
+        }
+
+        public AtomicOperation getOperation() {
+            return operation;
+        }
+
+        public boolean isFloatAtomic() {
+            return kind == OCLKind.FLOAT;
+        }
+    }
+
     @Opcode("VSTORE")
     public static class VectorStoreStmt extends AbstractInstruction {
 
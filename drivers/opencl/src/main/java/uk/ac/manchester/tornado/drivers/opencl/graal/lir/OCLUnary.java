@@ -255,8 +255,12 @@ public class OCLUnary {
             this.needsBase = needsBase;
         }
 
+        /**
+         * Accesses to the constant region are always relative to it, since only
+         * the heap can be reached through absolute addresses.
+         */
         private boolean shouldEmitRelativeAddress(OCLCompilationResultBuilder crb) {
-            return needsBase || (!keepIntegerIndexing() && crb.getDeviceContext().useRelativeAddresses());
+            return needsBase || base.memorySpace == OCLMemorySpace.CONSTANT || (!keepIntegerIndexing() && crb.getDeviceContext().useRelativeAddresses());
         }
 
         private boolean keepIntegerIndexing() {
@@ -95,6 +95,12 @@ public class OCLFPUnaryIntrinsicNode extends UnaryNode implements ArithmeticLIRL
         LOG1P, 
         LOGB,
         NAN,
+        NATIVE_COS,
+        NATIVE_EXP,
+        NATIVE_LOG,
+        NATIVE_RSQRT,
+        NATIVE_SIN,
+        NATIVE_SQRT,
         REMQUO, 
         RINT,
         ROUND, 
@@ -174,6 +180,24 @@ public class OCLFPUnaryIntrinsicNode extends UnaryNode implements ArithmeticLIRL
             case LOG:
                 result = gen.genFloatLog(input);
                 break;
+            case NATIVE_COS:
+                result = gen.genFloatNativeCos(input);
+                break;
+            case NATIVE_EXP:
+                result = gen.genFloatNativeExp(input);
+                break;
+            case NATIVE_LOG:
+                result = gen.genFloatNativeLog(input);
+                break;
+            case NATIVE_RSQRT:
+                result = gen.genFloatNativeRSqrt(input);
+                break;
+            case NATIVE_SIN:
+                result = gen.genFloatNativeSin(input);
+                break;
+            case NATIVE_SQRT:
+                result = gen.genFloatNativeSqrt(input);
+                break;
             default:
                 throw shouldNotReachHere();
         }
@@ -188,13 +212,22 @@ public class OCLFPUnaryIntrinsicNode extends UnaryNode implements ArithmeticLIRL
             case FABS:
                 return Math.abs(value);
             case EXP:
+            case NATIVE_EXP:
                 return Math.exp(value);
             case SQRT:
+            case NATIVE_SQRT:
                 return Math.sqrt(value);
+            case NATIVE_RSQRT:
+                return 1.0 / Math.sqrt(value);
             case FLOOR:
                 return Math.floor(value);
             case LOG:
+            case NATIVE_LOG:
                 return Math.log(value);
+            case NATIVE_SIN:
+                return Math.sin(value);
+            case NATIVE_COS:
+                return Math.cos(value);
             default:
                 throw new TornadoInternalError("unable to compute op %s", op);
         }
@@ -205,13 +238,22 @@ public class OCLFPUnaryIntrinsicNode extends UnaryNode implements ArithmeticLIRL
             case FABS:
                 return Math.abs(value);
             case EXP:
+            case NATIVE_EXP:
                 return (float) Math.exp(value);
             case SQRT:
+            case NATIVE_SQRT:
                 return (float) Math.sqrt(value);
+            case NATIVE_RSQRT:
+                return (float) (1.0 / Math.sqrt(value));
             case FLOOR:
                 return (float) Math.floor(value);
             case LOG:
+            case NATIVE_LOG:
                 return (float) Math.log(value);
+            case NATIVE_SIN:
+                return (float) Math.sin(value);
+            case NATIVE_COS:
+                return (float) Math.cos(value);
             default:
                 throw new TornadoInternalError("unable to compute op %s", op);
         }
@@ -0,0 +1,80 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.drivers.opencl.graal.nodes;
+
+import org.graalvm.compiler.core.common.LIRKind;
+import org.graalvm.compiler.core.common.type.StampFactory;
+import org.graalvm.compiler.graph.NodeClass;
+import org.graalvm.compiler.lir.Variable;
+import org.graalvm.compiler.lir.gen.LIRGeneratorTool;
+import org.graalvm.compiler.nodeinfo.NodeInfo;
+import org.graalvm.compiler.nodes.ValueNode;
+import org.graalvm.compiler.nodes.calc.FloatingNode;
+import org.graalvm.compiler.nodes.spi.LIRLowerable;
+import org.graalvm.compiler.nodes.spi.NodeLIRBuilderTool;
+
+import jdk.vm.ci.meta.JavaKind;
+import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLBinary;
+import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLKind;
+import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLLIRStmt;
+import uk.ac.manchester.tornado.runtime.common.ImageFormat;
+import uk.ac.manchester.tornado.runtime.graal.nodes.ImageReadNode;
+
+/**
+ * Reads one channel of the pixel (x, y) of an image kernel parameter that is
+ * backed by a read-only 2D image. It is the lowered form of
+ * {@link ImageReadNode}.
+ */
+@NodeInfo(shortName = "ReadImage")
+public class ReadImageNode extends FloatingNode implements LIRLowerable {
+
+    public static final NodeClass<ReadImageNode> TYPE = NodeClass.create(ReadImageNode.class);
+
+    @Input
+    ValueNode x;
+    @Input
+    ValueNode y;
+
+    private final int imageIndex;
+    private final ImageFormat format;
+    private final int channel;
+
+    public ReadImageNode(ImageReadNode read) {
+        super(TYPE, StampFactory.forKind(read.getFormat().getElementKind()));
+        this.imageIndex = read.getImageIndex();
+        this.format = read.getFormat();
+        this.channel = read.getChannel();
+        this.x = read.x();
+        this.y = read.y();
+    }
+
+    @Override
+    public void generate(NodeLIRBuilderTool gen) {
+        LIRGeneratorTool tool = gen.getLIRGeneratorTool();
+        LIRKind lirKind = LIRKind.value(format.getElementKind() == JavaKind.Float ? OCLKind.FLOAT : OCLKind.CHAR);
+        Variable result = tool.newVariable(lirKind);
+        tool.append(new OCLLIRStmt.AssignStmt(result, new OCLBinary.ReadImage(lirKind, imageIndex, format, channel, gen.operand(x), gen.operand(y))));
+        gen.setResult(this, result);
+    }
+}
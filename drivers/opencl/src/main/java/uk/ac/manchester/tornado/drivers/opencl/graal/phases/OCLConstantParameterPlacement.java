@@ -0,0 +1,56 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.drivers.opencl.graal.phases;
+
+import org.graalvm.compiler.nodes.memory.address.AddressNode;
+
+import uk.ac.manchester.tornado.drivers.opencl.graal.OCLArchitecture;
+import uk.ac.manchester.tornado.drivers.opencl.graal.backend.OCLBackend;
+import uk.ac.manchester.tornado.drivers.opencl.graal.lir.OCLAddressNode;
+import uk.ac.manchester.tornado.drivers.opencl.mm.OCLConstantRegion;
+import uk.ac.manchester.tornado.runtime.graal.phases.TornadoConstantParameterPlacement;
+import uk.ac.manchester.tornado.runtime.graal.phases.TornadoMidTierContext;
+
+/**
+ * Reads small read-only parameters through the {@code __constant} region of
+ * the kernel. The runtime packs them in {@link OCLConstantRegion}.
+ */
+public class OCLConstantParameterPlacement extends TornadoConstantParameterPlacement {
+
+    @Override
+    protected long getCapacity(TornadoMidTierContext context) {
+        final OCLBackend backend = (OCLBackend) context.getTargetProvider();
+        return backend.getDeviceContext().getDevice().getDeviceMaxConstantBufferSize() - OCLConstantRegion.ALIGNMENT;
+    }
+
+    @Override
+    protected long getPlacedSize(long bytes) {
+        return OCLConstantRegion.align(bytes);
+    }
+
+    @Override
+    protected void place(AddressNode address) {
+        ((OCLAddressNode) address).setMemoryRegister(OCLArchitecture.constantSpace);
+    }
+}
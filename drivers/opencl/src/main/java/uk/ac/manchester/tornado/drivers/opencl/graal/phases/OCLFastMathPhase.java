@@ -0,0 +1,86 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.drivers.opencl.graal.phases;
+
+import org.graalvm.compiler.nodes.StructuredGraph;
+import org.graalvm.compiler.nodes.ValueNode;
+import org.graalvm.compiler.nodes.calc.SqrtNode;
+import org.graalvm.compiler.phases.BasePhase;
+
+import jdk.vm.ci.meta.JavaKind;
+import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLFPUnaryIntrinsicNode;
+import uk.ac.manchester.tornado.drivers.opencl.graal.nodes.OCLFPUnaryIntrinsicNode.Operation;
+import uk.ac.manchester.tornado.runtime.graal.phases.TornadoHighTierContext;
+
+/**
+ * In fast-math mode, replaces the single-precision exp, log, sin, cos and sqrt
+ * intrinsics with their native_* variants, i.e. the nodes that the
+ * {@code TornadoMath.fast*} calls build. OpenCL only defines the native_*
+ * builtins for single precision, so double-precision math is left untouched.
+ */
+public class OCLFastMathPhase extends BasePhase<TornadoHighTierContext> {
+
+    private static Operation toNative(Operation operation) {
+        switch (operation) {
+            case EXP:
+                return Operation.NATIVE_EXP;
+            case LOG:
+                return Operation.NATIVE_LOG;
+            case SIN:
+                return Operation.NATIVE_SIN;
+            case COS:
+                return Operation.NATIVE_COS;
+            case SQRT:
+                return Operation.NATIVE_SQRT;
+            default:
+                return null;
+        }
+    }
+
+    private static void replace(StructuredGraph graph, ValueNode node, ValueNode value, Operation operation) {
+        ValueNode nativeNode = graph.addOrUnique(OCLFPUnaryIntrinsicNode.create(value, operation, JavaKind.Float));
+        node.replaceAtUsages(nativeNode);
+        node.safeDelete();
+    }
+
+    @Override
+    protected void run(StructuredGraph graph, TornadoHighTierContext context) {
+        if (!context.hasMeta() || !context.getMeta().isFastMathEnabled()) {
+            return;
+        }
+
+        graph.getNodes().filter(OCLFPUnaryIntrinsicNode.class).snapshot().forEach(node -> {
+            Operation operation = toNative(node.operation());
+            if (operation != null && node.getStackKind() == JavaKind.Float) {
+                replace(graph, node, node.getValue(), operation);
+            }
+        });
+
+        graph.getNodes().filter(SqrtNode.class).snapshot().forEach(node -> {
+            if (node.getStackKind() == JavaKind.Float) {
+                replace(graph, node, node.getValue(), Operation.NATIVE_SQRT);
+            }
+        });
+    }
+}
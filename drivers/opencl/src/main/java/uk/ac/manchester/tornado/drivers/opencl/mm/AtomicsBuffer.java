@@ -43,7 +43,7 @@ public class AtomicsBuffer implements ObjectBuffer {
     public AtomicsBuffer(int[] arr, OCLDeviceContext deviceContext) {
         this.deviceContext = deviceContext;
         this.atomicsList = arr;
-        deviceContext.getMemoryManager().allocateAtomicRegion();
+        deviceContext.getMemoryManager().allocateAtomicRegion(arr.length);
     }
 
     @Override
@@ -97,7 +97,7 @@ public class AtomicsBuffer implements ObjectBuffer {
 
     @Override
     public void allocate(Object reference, long batchSize) throws TornadoOutOfMemoryException, TornadoMemoryException {
-        deviceContext.getMemoryManager().allocateAtomicRegion();
+        deviceContext.getMemoryManager().allocateAtomicRegion(atomicsList.length);
     }
 
     @Override
@@ -133,6 +133,7 @@ public class AtomicsBuffer implements ObjectBuffer {
     @Override
     public void setIntBuffer(int[] arr) {
         this.atomicsList = arr;
+        deviceContext.getMemoryManager().allocateAtomicRegion(arr.length);
     }
 
 }
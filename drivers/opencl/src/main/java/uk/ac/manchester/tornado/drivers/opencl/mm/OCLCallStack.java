@@ -31,8 +31,11 @@ import static uk.ac.manchester.tornado.runtime.common.RuntimeUtilities.isBoxedPr
 import static uk.ac.manchester.tornado.runtime.common.Tornado.DEBUG;
 import static uk.ac.manchester.tornado.runtime.common.Tornado.debug;
 
+import java.util.ArrayList;
 import java.util.HashMap;
+import java.util.List;
 
+import uk.ac.manchester.tornado.api.mm.ObjectBuffer;
 import uk.ac.manchester.tornado.drivers.opencl.OCLDeviceContext;
 import uk.ac.manchester.tornado.runtime.common.CallStack;
 import uk.ac.manchester.tornado.runtime.common.DeviceObjectState;
@@ -47,6 +50,9 @@ public class OCLCallStack extends OCLByteBuffer implements CallStack {
 
     private boolean onDevice;
 
+    private final List<OCLImageWrapper> images;
+    private final List<ObjectBuffer> argumentBuffers;
+
     OCLCallStack(long offset, int numArgs, OCLDeviceContext device) {
         super(device, offset, (numArgs + RESERVED_SLOTS) << 3);
         this.numArgs = numArgs;
@@ -54,6 +60,8 @@ public class OCLCallStack extends OCLByteBuffer implements CallStack {
 
         buffer.clear();
         onDevice = false;
+        images = new ArrayList<>();
+        argumentBuffers = new ArrayList<>();
     }
 
     @Override
@@ -91,9 +99,34 @@ public class OCLCallStack extends OCLByteBuffer implements CallStack {
     public void reset() {
         buffer.mark();
         buffer.reset();
+        images.clear();
+        argumentBuffers.clear();
         onDevice = false;
     }
 
+    /**
+     * Image-backed arguments pushed onto this stack, in argument order. They are
+     * passed to the kernel as extra image arguments.
+     */
+    public List<OCLImageWrapper> getImages() {
+        return images;
+    }
+
+    /**
+     * @return the device buffer of the object pushed as the given argument, or
+     *         null if the argument is not an object.
+     */
+    public ObjectBuffer getArgumentBuffer(int index) {
+        return index < argumentBuffers.size() ? argumentBuffers.get(index) : null;
+    }
+
+    /**
+     * Overwrites the value pushed for the given argument.
+     */
+    public void setArgument(int index, long value) {
+        buffer.putLong((RESERVED_SLOTS + index) << 3, value);
+    }
+
     @Override
     public long getDeoptValue() {
         return buffer.getLong(8);
@@ -140,11 +173,13 @@ public class OCLCallStack extends OCLByteBuffer implements CallStack {
                 debug("arg : (null)");
             }
             buffer.putLong(0);
+            argumentBuffers.add(null);
         } else if (isBoxedPrimitive(arg) || arg.getClass().isPrimitive()) {
             if (DEBUG) {
                 debug("arg : type=%s, value=%s", arg.getClass().getName(), arg.toString());
             }
             PrimitiveSerialiser.put(buffer, arg, 8);
+            argumentBuffers.add(null);
         } else {
             shouldNotReachHere();
         }
@@ -157,6 +192,7 @@ public class OCLCallStack extends OCLByteBuffer implements CallStack {
                 debug("arg : (null)");
             }
             buffer.putLong(0);
+            argumentBuffers.add(null);
         } else {
             if (DEBUG) {
                 debug("arg : [0x%x] type=%s, value=%s, address=0x%x (0x%x)", arg.hashCode(), arg.getClass().getSimpleName(), arg, state.getAddress(), state.getOffset());
@@ -166,6 +202,10 @@ public class OCLCallStack extends OCLByteBuffer implements CallStack {
             } else {
                 buffer.putLong(state.getAddress());
             }
+            argumentBuffers.add(state.getBuffer());
+            if (state.getBuffer() instanceof OCLImageWrapper) {
+                images.add((OCLImageWrapper) state.getBuffer());
+            }
         }
     }
 }
@@ -0,0 +1,174 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.drivers.opencl.mm;
+
+import static uk.ac.manchester.tornado.runtime.common.Tornado.DEBUG;
+import static uk.ac.manchester.tornado.runtime.common.Tornado.debug;
+
+import uk.ac.manchester.tornado.api.exceptions.TornadoRuntimeException;
+import uk.ac.manchester.tornado.api.mm.ObjectBuffer;
+import uk.ac.manchester.tornado.drivers.opencl.OCLDeviceContext;
+import uk.ac.manchester.tornado.drivers.opencl.enums.OCLMemFlags;
+
+/**
+ * Buffer passed to a kernel as its {@code __constant} region. It holds a copy
+ * of the read-only parameters that the compiler placed in constant memory, laid
+ * out back to back. The frame slot of each placed parameter holds its offset
+ * within the region instead of its heap address.
+ *
+ * The copies are refreshed from the heap before a launch if any device buffer
+ * has been written since the last refresh, so that writes made by previous
+ * kernels or by the host are visible. The writes are counted by the device
+ * context, so the check is conservative. The copies are device-to-device and do
+ * not involve the host.
+ */
+public class OCLConstantRegion {
+
+    /**
+     * Alignment of each parameter within the region. The region starts with an
+     * unused block so that no parameter sits at offset zero, which the kernel
+     * would otherwise take for a null reference.
+     */
+    public static final int ALIGNMENT = 64;
+
+    private final OCLDeviceContext deviceContext;
+    private long bufferId;
+    private long capacity;
+    private ObjectBuffer[] sources;
+    private long[] offsets;
+    private boolean stale;
+    private long refreshedWrites;
+
+    public OCLConstantRegion(OCLDeviceContext deviceContext) {
+        this.deviceContext = deviceContext;
+        this.bufferId = -1;
+        this.capacity = 0;
+        this.sources = new ObjectBuffer[0];
+        this.offsets = new long[0];
+        this.stale = true;
+    }
+
+    public static long align(long bytes) {
+        return (bytes + ALIGNMENT - 1) & -ALIGNMENT;
+    }
+
+    /**
+     * Lays out the given parameters of the call stack in the region, and
+     * replaces their frame values with their offset in the region. It must be
+     * called before the call stack is written to the device.
+     *
+     * @param stack
+     *            call stack of the kernel.
+     * @param parameters
+     *            indexes of the parameters placed in constant memory.
+     */
+    public void bind(final OCLCallStack stack, final int[] parameters) {
+        sources = new ObjectBuffer[parameters.length];
+        offsets = new long[parameters.length];
+        stale = true;
+        if (parameters.length == 0) {
+            return;
+        }
+
+        long size = ALIGNMENT;
+        for (int i = 0; i < parameters.length; i++) {
+            sources[i] = stack.getArgumentBuffer(parameters[i]);
+            if (sources[i] == null) {
+                throw new TornadoRuntimeException("[ERROR] Parameter " + parameters[i] + " placed in constant memory is not on the device");
+            }
+            offsets[i] = size;
+            stack.setArgument(parameters[i], size);
+            size += align(sources[i].size());
+        }
+
+        if (size > deviceContext.getDevice().getDeviceMaxConstantBufferSize()) {
+            throw new TornadoRuntimeException("[ERROR] Constant parameters need " + size + " bytes, over the device limit. Run with -Dtornado.constant.params=False");
+        }
+        if (size > capacity) {
+            release();
+            bufferId = deviceContext.getPlatformContext().createBuffer(OCLMemFlags.CL_MEM_READ_ONLY, size);
+            capacity = size;
+        }
+        if (DEBUG) {
+            debug("constant region: %d parameters, %d bytes", parameters.length, size);
+        }
+    }
+
+    public boolean isEmpty() {
+        return sources.length == 0;
+    }
+
+    public long toBuffer() {
+        return bufferId;
+    }
+
+    /**
+     * Copies the placed parameters, as currently held on the device heap, into
+     * the region, unless no device buffer has been written since the last
+     * refresh. Each copy waits for the previous one, so that on out-of-order
+     * queues the event of the last copy also covers the earlier ones.
+     *
+     * @param events
+     *            list of events to wait for.
+     * @return event id of the last copy, or -1 if nothing was copied.
+     */
+    public int enqueueRefresh(int[] events) {
+        final long writes = deviceContext.getBufferWrites();
+        if (!stale && writes == refreshedWrites) {
+            return -1;
+        }
+        stale = false;
+        refreshedWrites = writes;
+        int lastEvent = -1;
+        int[] waitEvents = events;
+        for (int i = 0; i < sources.length; i++) {
+            lastEvent = deviceContext.enqueueCopyBuffer(sources[i].toBuffer(), sources[i].getBufferOffset(), bufferId, offsets[i], sources[i].size(), waitEvents);
+            waitEvents = new int[] { lastEvent };
+        }
+        return lastEvent;
+    }
+
+    /**
+     * Records a write made by the kernel of the region. The placed parameters
+     * are read-only in the kernel, so this write does not make the region
+     * stale.
+     *
+     * @param writes
+     *            number of writes returned when the write was recorded.
+     */
+    public void keepFresh(long writes) {
+        if (refreshedWrites == writes - 1) {
+            refreshedWrites = writes;
+        }
+    }
+
+    public void release() {
+        if (bufferId != -1) {
+            deviceContext.getPlatformContext().releaseBuffer(bufferId);
+            bufferId = -1;
+            capacity = 0;
+            stale = true;
+        }
+    }
+}
@@ -0,0 +1,122 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework: 
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.drivers.opencl.mm;
+
+import static uk.ac.manchester.tornado.runtime.TornadoCoreRuntime.getVMConfig;
+
+import java.util.List;
+
+import jdk.vm.ci.meta.JavaKind;
+import uk.ac.manchester.tornado.api.exceptions.TornadoMemoryException;
+import uk.ac.manchester.tornado.api.exceptions.TornadoOutOfMemoryException;
+import uk.ac.manchester.tornado.api.exceptions.TornadoRuntimeException;
+import uk.ac.manchester.tornado.drivers.opencl.OCLDeviceContext;
+import uk.ac.manchester.tornado.drivers.opencl.enums.OCLImageChannelOrder;
+import uk.ac.manchester.tornado.drivers.opencl.enums.OCLImageChannelType;
+import uk.ac.manchester.tornado.drivers.opencl.enums.OCLMemFlags;
+import uk.ac.manchester.tornado.runtime.common.ImageFormat;
+
+/**
+ * Wraps an image type (see {@link ImageFormat}) so that, in addition to the
+ * regular object layout on the heap, its storage is mirrored into a read-only
+ * 2D image. Kernels read from the image through a sampler, while writes keep
+ * going to the heap copy. The image is refreshed from the heap before a kernel
+ * launch only when the heap copy has changed since the last refresh.
+ */
+public class OCLImageWrapper extends OCLObjectWrapper {
+
+    private final OCLDeviceContext deviceContext;
+    private final ImageFormat format;
+    private final int width;
+    private final int height;
+    private final int storageHeaderSize;
+    private long imageId;
+    private boolean stale;
+
+    public OCLImageWrapper(final OCLDeviceContext deviceContext, Object image, ImageFormat format, long batchSize) {
+        super(deviceContext, image, batchSize);
+        if (!deviceContext.getDevice().isDeviceImageSupported()) {
+            throw new TornadoRuntimeException("[ERROR] Device " + deviceContext.getDevice().getDeviceName() + " does not support images. Run without -Dtornado.images=True");
+        }
+        this.deviceContext = deviceContext;
+        this.format = format;
+        this.width = format.getTexelWidth(ImageFormat.getWidth(image));
+        this.height = ImageFormat.getHeight(image);
+        this.storageHeaderSize = getVMConfig().getArrayBaseOffset(format.getElementKind());
+        this.imageId = -1;
+        this.stale = true;
+    }
+
+    @Override
+    public void allocate(Object reference, long batchSize) throws TornadoOutOfMemoryException, TornadoMemoryException {
+        super.allocate(reference, batchSize);
+        if (imageId == -1) {
+            final OCLImageChannelOrder order = (format.getTexelChannels() == 4) ? OCLImageChannelOrder.CL_RGBA : OCLImageChannelOrder.CL_R;
+            final OCLImageChannelType type = (format.getElementKind() == JavaKind.Float) ? OCLImageChannelType.CL_FLOAT : OCLImageChannelType.CL_SIGNED_INT8;
+            imageId = deviceContext.getPlatformContext().createImage2D(OCLMemFlags.CL_MEM_READ_ONLY, order, type, width, height);
+        }
+    }
+
+    @Override
+    public void write(Object object) {
+        super.write(object);
+        stale = true;
+    }
+
+    @Override
+    public List<Integer> enqueueWrite(Object ref, long batchSize, long hostOffset, int[] events, boolean useDeps) {
+        stale = true;
+        return super.enqueueWrite(ref, batchSize, hostOffset, events, useDeps);
+    }
+
+    public long getImageId() {
+        return imageId;
+    }
+
+    /**
+     * Records that the heap copy has been written on the device, so the image
+     * has to be refreshed before it is read again.
+     */
+    public void markStale() {
+        stale = true;
+    }
+
+    /**
+     * Copies the storage array of the image, as currently held on the device
+     * heap, into the image object if the heap copy has changed since the last
+     * refresh.
+     *
+     * @param events
+     *            list of events to wait for.
+     * @return event id of the copy, or -1 if the image is up to date.
+     */
+    public int enqueueRefresh(int[] events) {
+        if (!stale) {
+            return -1;
+        }
+        stale = false;
+        final FieldBuffer storage = getField(ImageFormat.STORAGE_FIELD);
+        return deviceContext.enqueueCopyBufferToImage(storage.toBuffer(), storage.getBufferOffset() + storageHeaderSize, imageId, width, height, events);
+    }
+}
@@ -30,11 +30,14 @@ import uk.ac.manchester.tornado.api.exceptions.TornadoOutOfMemoryException;
 import uk.ac.manchester.tornado.api.mm.ObjectBuffer;
 import uk.ac.manchester.tornado.api.mm.TornadoMemoryProvider;
 import uk.ac.manchester.tornado.drivers.opencl.OCLDeviceContext;
+import uk.ac.manchester.tornado.drivers.opencl.OpenCL;
 import uk.ac.manchester.tornado.drivers.opencl.enums.OCLMemFlags;
 import uk.ac.manchester.tornado.drivers.opencl.graal.backend.OCLBackend;
+import uk.ac.manchester.tornado.runtime.common.NumaTopology;
 import uk.ac.manchester.tornado.runtime.common.RuntimeUtilities;
 import uk.ac.manchester.tornado.runtime.common.Tornado;
 import uk.ac.manchester.tornado.runtime.common.TornadoLogger;
+import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
 import uk.ac.manchester.tornado.runtime.tasks.meta.ScheduleMetaData;
 
 public class OCLMemoryManager extends TornadoLogger implements TornadoMemoryProvider {
@@ -48,13 +51,14 @@ public class OCLMemoryManager extends TornadoLogger implements TornadoMemoryProv
     private long deviceHeapPointer;
     private long constantPointer;
     private long atomicsRegion = -1;
+    private int atomicsRegionCapacity;
     private long heapLimit;
     private long heapPosition;
     private boolean initialised;
 
     private static final int STACK_ALIGNMENT_SIZE = 128;
 
-    private static final int MAX_NUMBER_OF_ATOMICS_PER_KERNEL = 128;
+    private static final int INITIAL_NUMBER_OF_ATOMICS = 128;
     private static final int INTEGER_BYTES_SIZE = 4;
 
     public OCLMemoryManager(final OCLDeviceContext device) {
@@ -166,9 +170,20 @@ public class OCLMemoryManager extends TornadoLogger implements TornadoMemoryProv
      */
     public void allocateDeviceMemoryRegions(long numBytes) {
         this.heapLimit = numBytes;
-        this.deviceHeapPointer = deviceContext.getPlatformContext().createBuffer(OCLMemFlags.CL_MEM_READ_WRITE | OCLMemFlags.CL_MEM_ALLOC_HOST_PTR, numBytes);
-        this.constantPointer = deviceContext.getPlatformContext().createBuffer(OCLMemFlags.CL_MEM_READ_WRITE | OCLMemFlags.CL_MEM_ALLOC_HOST_PTR, 4);
-        this.atomicsRegion = deviceContext.getPlatformContext().createBuffer(OCLMemFlags.CL_MEM_READ_WRITE | OCLMemFlags.CL_MEM_ALLOC_HOST_PTR, INTEGER_BYTES_SIZE * MAX_NUMBER_OF_ATOMICS_PER_KERNEL);
+        // The host side of CL_MEM_ALLOC_HOST_PTR buffers is placed on the NUMA node of the device
+        final int numaNode = TornadoOptions.NUMA_AWARE_STAGING ? deviceContext.getDevice().getNumaNode() : NumaTopology.UNKNOWN_NODE;
+        if (numaNode != NumaTopology.UNKNOWN_NODE) {
+            OpenCL.setThreadMemoryNode(numaNode);
+        }
+        try {
+            this.deviceHeapPointer = deviceContext.getPlatformContext().createBuffer(OCLMemFlags.CL_MEM_READ_WRITE | OCLMemFlags.CL_MEM_ALLOC_HOST_PTR, numBytes);
+            this.constantPointer = deviceContext.getPlatformContext().createBuffer(OCLMemFlags.CL_MEM_READ_WRITE | OCLMemFlags.CL_MEM_ALLOC_HOST_PTR, 4);
+            allocateAtomicRegion(INITIAL_NUMBER_OF_ATOMICS);
+        } finally {
+            if (numaNode != NumaTopology.UNKNOWN_NODE) {
+                OpenCL.setThreadMemoryNode(NumaTopology.UNKNOWN_NODE);
+            }
+        }
     }
 
     public void init(OCLBackend backend, long address) {
@@ -204,10 +219,31 @@ public class OCLMemoryManager extends TornadoLogger implements TornadoMemoryProv
     }
 
     void allocateAtomicRegion() {
-        if (this.atomicsRegion == -1) {
-            this.atomicsRegion = deviceContext.getPlatformContext().createBuffer(OCLMemFlags.CL_MEM_READ_WRITE | OCLMemFlags.CL_MEM_ALLOC_HOST_PTR,
-                    INTEGER_BYTES_SIZE * MAX_NUMBER_OF_ATOMICS_PER_KERNEL);
+        allocateAtomicRegion(INITIAL_NUMBER_OF_ATOMICS);
+    }
+
+    /**
+     * Makes sure the region that backs the {@link java.util.concurrent.atomic.AtomicInteger}
+     * objects of a kernel holds, at least, the given number of atomics. The region
+     * grows by doubling its capacity, so kernels are not limited to a fixed number
+     * of atomics.
+     *
+     * @param numAtomics
+     *            Number of integer atomics required.
+     */
+    void allocateAtomicRegion(int numAtomics) {
+        if (this.atomicsRegion != -1 && numAtomics <= atomicsRegionCapacity) {
+            return;
+        }
+        int capacity = Math.max(INITIAL_NUMBER_OF_ATOMICS, atomicsRegionCapacity);
+        while (capacity < numAtomics) {
+            capacity <<= 1;
+        }
+        if (this.atomicsRegion != -1) {
+            deviceContext.getPlatformContext().releaseBuffer(atomicsRegion);
         }
+        this.atomicsRegion = deviceContext.getPlatformContext().createBuffer(OCLMemFlags.CL_MEM_READ_WRITE | OCLMemFlags.CL_MEM_ALLOC_HOST_PTR, (long) INTEGER_BYTES_SIZE * capacity);
+        this.atomicsRegionCapacity = capacity;
     }
 
     public long toRelativeAddress() {
@@ -32,6 +32,7 @@ import java.nio.file.Files;
 import java.nio.file.Path;
 import java.nio.file.Paths;
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.HashMap;
 import java.util.List;
 import java.util.concurrent.ConcurrentHashMap;
@@ -59,6 +60,7 @@ import uk.ac.manchester.tornado.drivers.opencl.OCLDeviceContext;
 import uk.ac.manchester.tornado.drivers.opencl.OCLDeviceContextInterface;
 import uk.ac.manchester.tornado.drivers.opencl.OCLDriver;
 import uk.ac.manchester.tornado.drivers.opencl.OCLTargetDevice;
+import uk.ac.manchester.tornado.drivers.opencl.OpenCL;
 import uk.ac.manchester.tornado.drivers.opencl.enums.OCLDeviceType;
 import uk.ac.manchester.tornado.drivers.opencl.graal.OCLInstalledCode;
 import uk.ac.manchester.tornado.drivers.opencl.graal.OCLProviders;
@@ -72,6 +74,7 @@ import uk.ac.manchester.tornado.drivers.opencl.mm.OCLByteBuffer;
 import uk.ac.manchester.tornado.drivers.opencl.mm.OCLCharArrayWrapper;
 import uk.ac.manchester.tornado.drivers.opencl.mm.OCLDoubleArrayWrapper;
 import uk.ac.manchester.tornado.drivers.opencl.mm.OCLFloatArrayWrapper;
+import uk.ac.manchester.tornado.drivers.opencl.mm.OCLImageWrapper;
 import uk.ac.manchester.tornado.drivers.opencl.mm.OCLIntArrayWrapper;
 import uk.ac.manchester.tornado.drivers.opencl.mm.OCLLongArrayWrapper;
 import uk.ac.manchester.tornado.drivers.opencl.mm.OCLMemoryManager;
@@ -81,12 +84,17 @@ import uk.ac.manchester.tornado.drivers.opencl.mm.OCLShortArrayWrapper;
 import uk.ac.manchester.tornado.runtime.TornadoCoreRuntime;
 import uk.ac.manchester.tornado.runtime.common.CallStack;
 import uk.ac.manchester.tornado.runtime.common.DeviceObjectState;
+import uk.ac.manchester.tornado.runtime.common.ImageFormat;
+import uk.ac.manchester.tornado.runtime.common.NumaTopology;
 import uk.ac.manchester.tornado.runtime.common.RuntimeUtilities;
+import uk.ac.manchester.tornado.runtime.common.TieredCompilation;
 import uk.ac.manchester.tornado.runtime.common.Tornado;
 import uk.ac.manchester.tornado.runtime.common.TornadoAcceleratorDevice;
 import uk.ac.manchester.tornado.runtime.common.TornadoInstalledCode;
+import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
 import uk.ac.manchester.tornado.runtime.common.TornadoSchedulingStrategy;
 import uk.ac.manchester.tornado.runtime.sketcher.Sketch;
+import uk.ac.manchester.tornado.runtime.sketcher.SketchDiskCache;
 import uk.ac.manchester.tornado.runtime.sketcher.TornadoSketcher;
 import uk.ac.manchester.tornado.runtime.tasks.CompilableTask;
 import uk.ac.manchester.tornado.runtime.tasks.PrebuiltTask;
@@ -227,6 +235,22 @@ public class OCLTornadoDevice implements TornadoAcceleratorDevice {
         return installedCode.isLoadBinaryOptionEnabled() && (installedCode.getOpenCLBinary(deviceInfo) != null);
     }
 
+    /**
+     * Computes the key under which the kernel of a task is shared with the tasks
+     * of other task-schedules, and stored in the disk cache.
+     *
+     * @return the key, or null if the kernel cannot be shared
+     */
+    private String getKernelKey(CompilableTask task, ResolvedJavaMethod resolvedMethod) {
+        if (OCLBackend.isDeviceAnFPGAAccelerator(getDeviceContext())) {
+            return null;
+        }
+        final TaskMetaData meta = task.meta();
+        final long batchThreads = (meta.getNumThreads() > 0) ? meta.getNumThreads() : task.getBatchThreads();
+        final String deviceDescription = String.format("%s|%s|%s|%s", platformName, device.getDeviceName(), device.getDeviceVendor(), device.getVersion());
+        return SketchDiskCache.kernelKey(task, resolvedMethod, deviceDescription, batchThreads);
+    }
+
     private TornadoInstalledCode compileTask(SchedulableTask task) {
         final OCLDeviceContextInterface deviceContext = getDeviceContext();
         final CompilableTask executable = (CompilableTask) task;
@@ -245,6 +269,33 @@ public class OCLTornadoDevice implements TornadoAcceleratorDevice {
         final Access[] taskAccess = taskMeta.getArgumentsAccess();
         System.arraycopy(sketchAccess, 0, taskAccess, 0, sketchAccess.length);
 
+        // Reuse the kernel generated for another task-schedule, if any
+        final String kernelKey = getKernelKey(executable, resolvedMethod);
+        if (kernelKey != null && !TornadoOptions.OPENCL_SCHEDULE_PROGRAM) {
+            final OCLInstalledCode sharedCode = deviceContext.getCodeCache().installSharedKernel(kernelKey, taskMeta, task.getId());
+            if (sharedCode != null) {
+                taskMeta.setCompiledGraph(resolvedMethod);
+                return sharedCode;
+            }
+        }
+
+        // Reuse the kernel generated by a previous run, if any
+        final String diskCacheKey = SketchDiskCache.isEnabled() ? kernelKey : null;
+        if (diskCacheKey != null) {
+            final byte[] source = SketchDiskCache.loadKernel(diskCacheKey, taskMeta, OCLTornadoDevice.class);
+            if (source != null) {
+                taskMeta.setCompiledGraph(resolvedMethod);
+                if (TornadoOptions.OPENCL_SCHEDULE_PROGRAM) {
+                    return deviceContext.installScheduleCode(taskMeta, task.getId(), resolvedMethod.getName(), source);
+                }
+                final OCLInstalledCode installedCode = deviceContext.installCode(taskMeta, task.getId(), resolvedMethod.getName(), source);
+                if (installedCode.isValid()) {
+                    deviceContext.getCodeCache().registerSharedKernel(kernelKey, taskMeta, resolvedMethod.getName(), source);
+                }
+                return installedCode;
+            }
+        }
+
         try {
             OCLProviders providers = (OCLProviders) getBackend().getProviders();
             TornadoProfiler profiler = task.getProfiler();
@@ -252,7 +303,11 @@ public class OCLTornadoDevice implements TornadoAcceleratorDevice {
             profiler.registerDeviceID(ProfilerType.DEVICE_ID, taskMeta.getId(), taskMeta.getLogicDevice().getDriverIndex() + ":" + taskMeta.getDeviceIndex());
             profiler.registerDeviceName(ProfilerType.DEVICE, taskMeta.getId(), taskMeta.getLogicDevice().getPhysicalDevice().getDeviceName());
             profiler.start(ProfilerType.TASK_COMPILE_GRAAL_TIME, taskMeta.getId());
-            final OCLCompilationResult result = OCLCompiler.compileSketchForDevice(sketch, executable, providers, getBackend());
+            final boolean tiered = TieredCompilation.isEnabled() && !OCLBackend.isDeviceAnFPGAAccelerator(deviceContext) && !TornadoOptions.OPENCL_SCHEDULE_PROGRAM;
+            final OCLCompilationResult result;
+            synchronized (providers.getSuitesProvider()) {
+                result = OCLCompiler.compileSketchForDevice(sketch, executable, providers, getBackend(), tiered);
+            }
 
             // Update atomics buffer for inner methods that are not inlined
             ResolvedJavaMethod[] methods = result.getMethods();
@@ -280,7 +335,18 @@ public class OCLTornadoDevice implements TornadoAcceleratorDevice {
                 installedCode = deviceContext.installCode(result.getId(), result.getName(), result.getTargetCode(), task.shouldCompile());
             } else {
                 // B) for CPU multi-core or GPU
-                installedCode = deviceContext.installCode(result);
+                if (TornadoOptions.OPENCL_SCHEDULE_PROGRAM) {
+                    // Built on the first launch together with the rest of the task-schedule
+                    installedCode = deviceContext.installScheduleCode(result.getMeta(), result.getId(), result.getName(), result.getTargetCode());
+                } else {
+                    installedCode = deviceContext.installCode(result);
+                }
+                if (tiered && !TornadoAtomicIntegerNode.globalAtomicsParameters.containsKey(resolvedMethod)) {
+                    final CompilableTask optimisedTask = executable.withMeta(taskMeta.copy());
+                    installedCode.setTieredCompilation(new TieredCompilation<>(() -> recompileOptimised(sketch, optimisedTask, providers, kernelKey)));
+                } else if (kernelKey != null && !TornadoAtomicIntegerNode.globalAtomicsParameters.containsKey(resolvedMethod)) {
+                    shareKernel(kernelKey, result, installedCode);
+                }
             }
             profiler.stop(ProfilerType.TASK_COMPILE_DRIVER_TIME, taskMeta.getId());
             profiler.sum(ProfilerType.TOTAL_DRIVER_COMPILE_TIME, profiler.getTaskTimer(ProfilerType.TASK_COMPILE_DRIVER_TIME, taskMeta.getId()));
@@ -294,6 +360,47 @@ public class OCLTornadoDevice implements TornadoAcceleratorDevice {
         }
     }
 
+    /**
+     * Compiles a task with the full optimisation pipeline. It runs on the
+     * background thread of the tiered compilation, while the kernel of the quick
+     * tier keeps running. The task is bound to a copy of the meta data, taken on
+     * the launching thread, so that the launches never see the work sizes and
+     * the constant placement that the compiler rewrites. The result is dropped
+     * if its constant memory placement differs from the one of the running
+     * kernel, which the copy holds until it is compiled.
+     */
+    private OCLInstalledCode recompileOptimised(Sketch sketch, CompilableTask executable, OCLProviders providers, String kernelKey) {
+        final TaskMetaData taskMeta = executable.meta();
+        final int[] constantParameters = taskMeta.getConstantParameters();
+        final OCLCompilationResult result;
+        synchronized (providers.getSuitesProvider()) {
+            result = OCLCompiler.compileSketchForDevice(sketch, executable, providers, getBackend(), false);
+        }
+        if (!Arrays.equals(constantParameters, taskMeta.getConstantParameters())) {
+            return null;
+        }
+        final OCLInstalledCode installedCode = getDeviceContext().getCodeCache().buildSource(taskMeta, result.getId(), result.getName(), result.getTargetCode());
+        if (kernelKey != null) {
+            shareKernel(kernelKey, result, installedCode);
+        }
+        return installedCode;
+    }
+
+    /**
+     * Makes a kernel built from source available to the tasks of other
+     * task-schedules and, if enabled, to later runs.
+     */
+    private void shareKernel(String kernelKey, OCLCompilationResult result, OCLInstalledCode installedCode) {
+        if (TornadoOptions.OPENCL_SCHEDULE_PROGRAM || !installedCode.isValid()) {
+            return;
+        }
+        final TaskMetaData taskMeta = result.getMeta();
+        getDeviceContext().getCodeCache().registerSharedKernel(kernelKey, taskMeta, result.getName(), result.getTargetCode());
+        if (SketchDiskCache.isEnabled()) {
+            SketchDiskCache.storeKernel(kernelKey, result.getCompiledMethods(), result.getTargetCode(), taskMeta, OCLTornadoDevice.class);
+        }
+    }
+
     private TornadoInstalledCode compilePreBuiltTask(SchedulableTask task) {
         final OCLDeviceContextInterface deviceContext = getDeviceContext();
         final PrebuiltTask executable = (PrebuiltTask) task;
@@ -508,6 +615,8 @@ public class OCLTornadoDevice implements TornadoAcceleratorDevice {
         } else if (!type.isPrimitive()) {
             if (object instanceof AtomicInteger) {
                 result = new AtomicsBuffer(new int[] {}, deviceContext);
+            } else if (ImageFormat.of(object) != null) {
+                result = new OCLImageWrapper(deviceContext, object, ImageFormat.of(object), batchSize);
             } else {
                 result = new OCLObjectWrapper(deviceContext, object, batchSize);
             }
@@ -600,6 +709,29 @@ public class OCLTornadoDevice implements TornadoAcceleratorDevice {
         return state.getBuffer().enqueueWrite(object, batchSize, offset, events, events == null);
     }
 
+    @Override
+    public boolean isPeerCopySupported(TornadoAcceleratorDevice source) {
+        // clEnqueueCopyBuffer requires both buffers to belong to the same OpenCL context
+        return source instanceof OCLTornadoDevice && source != this && ((OCLTornadoDevice) source).getDeviceContext().getPlatformContext() == getDeviceContext().getPlatformContext();
+    }
+
+    @Override
+    public List<Integer> copyFromPeer(Object object, TornadoAcceleratorDevice source, TornadoDeviceObjectState sourceState, TornadoDeviceObjectState state, int[] events) {
+        ensureAllocated(object, 0, state);
+        final ObjectBuffer sourceBuffer = sourceState.getBuffer();
+        final ObjectBuffer buffer = state.getBuffer();
+
+        // The copy is enqueued in the command queue of this device
+        source.sync();
+
+        state.setContents(true);
+        ((OCLDeviceContext) getDeviceContext()).markBuffersWritten();
+        List<Integer> listEvents = new ArrayList<>();
+        listEvents.add(((OCLDeviceContext) getDeviceContext()).enqueueCopyBuffer(sourceBuffer.toBuffer(), sourceBuffer.getBufferOffset(), buffer.toBuffer(), buffer.getBufferOffset(),
+                sourceBuffer.size(), events));
+        return listEvents;
+    }
+
     @Override
     public int streamOut(Object object, long offset, TornadoDeviceObjectState state, int[] events) {
         TornadoInternalError.guarantee(state.isValid(), "invalid variable");
@@ -782,6 +914,9 @@ public class OCLTornadoDevice implements TornadoAcceleratorDevice {
     @Override
     public void enableThreadSharing() {
         // OpenCL device context is shared by different threads, by default
+        if (TornadoOptions.NUMA_PIN_THREADS) {
+            NumaTopology.getInstance().pinCurrentThread(device.getNumaNode(), OpenCL::pinCurrentThread);
+        }
     }
 
     @Override
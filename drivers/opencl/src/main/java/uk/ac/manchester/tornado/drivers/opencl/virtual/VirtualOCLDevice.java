@@ -30,6 +30,7 @@ import java.nio.ByteOrder;
 
 import uk.ac.manchester.tornado.drivers.opencl.OCLTargetDevice;
 import uk.ac.manchester.tornado.drivers.opencl.enums.OCLDeviceType;
+import uk.ac.manchester.tornado.runtime.common.NumaTopology;
 import uk.ac.manchester.tornado.runtime.common.TornadoLogger;
 
 public class VirtualOCLDevice extends TornadoLogger implements OCLTargetDevice {
@@ -92,6 +93,11 @@ public class VirtualOCLDevice extends TornadoLogger implements OCLTargetDevice {
         return true;
     }
 
+    @Override
+    public boolean isDeviceImageSupported() {
+        return false;
+    }
+
     @Override
     public String getDeviceName() {
         return name;
@@ -181,6 +187,11 @@ public class VirtualOCLDevice extends TornadoLogger implements OCLTargetDevice {
         return deviceEndianLittle;
     }
 
+    @Override
+    public int getNumaNode() {
+        return NumaTopology.UNKNOWN_NODE;
+    }
+
     public int getWordSize() {
         return getDeviceAddressBits() >> 3;
     }
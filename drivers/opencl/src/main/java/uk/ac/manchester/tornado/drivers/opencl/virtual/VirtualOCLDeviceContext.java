@@ -216,6 +216,10 @@ public class VirtualOCLDeviceContext extends TornadoLogger implements Initialisa
         return null;
     }
 
+    public OCLInstalledCode installScheduleCode(TaskMetaData meta, String id, String entryPoint, byte[] code) {
+        return null;
+    }
+
     public OCLInstalledCode installCode(String id, String entryPoint, byte[] code, boolean shouldCompile) {
         return null;
     }
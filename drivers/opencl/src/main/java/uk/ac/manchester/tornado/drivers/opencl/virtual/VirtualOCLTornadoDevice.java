@@ -233,6 +233,16 @@ public class VirtualOCLTornadoDevice implements TornadoAcceleratorDevice {
         return null;
     }
 
+    @Override
+    public boolean isPeerCopySupported(TornadoAcceleratorDevice source) {
+        return false;
+    }
+
+    @Override
+    public List<Integer> copyFromPeer(Object object, TornadoAcceleratorDevice source, TornadoDeviceObjectState sourceState, TornadoDeviceObjectState objectState, int[] events) {
+        return null;
+    }
+
     @Override
     public boolean isFullJITMode(SchedulableTask task) {
         return true;
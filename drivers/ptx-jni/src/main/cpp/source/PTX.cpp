@@ -26,6 +26,9 @@
 #include <cuda.h>
 
 #include <iostream>
+#ifdef __linux__
+#include <sched.h>
+#endif
 #include "PTX.h"
 #include "ptx_log.h"
 
@@ -39,4 +42,28 @@ JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTX_cuInit
     CUresult result = cuInit(0);
     LOG_PTX_AND_VALIDATE("cuInit", 0);
     return (jlong) result;
-}
\ No newline at end of file
+}
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_ptx_PTX
+ * Method:    pinCurrentThread
+ * Signature: ([I)V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTX_pinCurrentThread
+  (JNIEnv *env, jclass clazz, jintArray cpus) {
+#ifdef __linux__
+    jsize length = env->GetArrayLength(cpus);
+    jint *native_cpus = env->GetIntArrayElements(cpus, NULL);
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int i = 0; i < length; i++) {
+        if (native_cpus[i] >= 0 && native_cpus[i] < CPU_SETSIZE) {
+            CPU_SET(native_cpus[i], &cpu_set);
+        }
+    }
+    env->ReleaseIntArrayElements(cpus, native_cpus, JNI_ABORT);
+    if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+        std::cout << "\t[JNI] " << __FILE__ << ":" << __LINE__ << " in function: " << __FUNCTION__ << " sched_setaffinity failed" << std::endl;
+    }
+#endif
+}
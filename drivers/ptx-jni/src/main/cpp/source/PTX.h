@@ -39,6 +39,14 @@ extern "C" {
 JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTX_cuInit
         (JNIEnv *, jclass);
 
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_ptx_PTX
+ * Method:    pinCurrentThread
+ * Signature: ([I)V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTX_pinCurrentThread
+        (JNIEnv *, jclass, jintArray);
+
 #ifdef __cplusplus
 }
 #endif
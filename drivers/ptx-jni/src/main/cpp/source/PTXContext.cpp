@@ -25,6 +25,7 @@
 #include <jni.h>
 #include <cuda.h>
 
+#include <cstring>
 #include <iostream>
 #include "PTXContext.h"
 #include "ptx_log.h"
@@ -101,4 +102,67 @@ JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXContext_cuC
     CUresult result = cuCtxSetCurrent(*ctx);
     LOG_PTX_AND_VALIDATE("cuCtxSetCurrent", result);
     return (jlong) result;
-}
\ No newline at end of file
+}
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXContext
+ * Method:    cuTexObjectCreate
+ * Signature: (JIIIZ)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXContext_cuTexObjectCreate
+  (JNIEnv *env, jclass clazz, jlong cuContext, jint width, jint height, jint channels, jboolean is_float) {
+    CUcontext* ctx = (CUcontext*) cuContext;
+    CUresult result = cuCtxSetCurrent(*ctx);
+    LOG_PTX_AND_VALIDATE("cuCtxSetCurrent", result);
+
+    CUDA_ARRAY_DESCRIPTOR array_descriptor;
+    memset(&array_descriptor, 0, sizeof(array_descriptor));
+    array_descriptor.Width = (size_t) width;
+    array_descriptor.Height = (size_t) height;
+    array_descriptor.Format = is_float ? CU_AD_FORMAT_FLOAT : CU_AD_FORMAT_SIGNED_INT8;
+    array_descriptor.NumChannels = (unsigned int) channels;
+
+    CUarray array;
+    result = cuArrayCreate(&array, &array_descriptor);
+    LOG_PTX_AND_VALIDATE("cuArrayCreate", result);
+
+    CUDA_RESOURCE_DESC resource_descriptor;
+    memset(&resource_descriptor, 0, sizeof(resource_descriptor));
+    resource_descriptor.resType = CU_RESOURCE_TYPE_ARRAY;
+    resource_descriptor.res.array.hArray = array;
+
+    // Same sampling as the OpenCL path: unnormalised coordinates clamped to the edge, no filtering
+    CUDA_TEXTURE_DESC texture_descriptor;
+    memset(&texture_descriptor, 0, sizeof(texture_descriptor));
+    texture_descriptor.addressMode[0] = CU_TR_ADDRESS_MODE_CLAMP;
+    texture_descriptor.addressMode[1] = CU_TR_ADDRESS_MODE_CLAMP;
+    texture_descriptor.filterMode = CU_TR_FILTER_MODE_POINT;
+    texture_descriptor.flags = CU_TRSF_READ_AS_INTEGER;
+
+    CUtexObject texture = 0;
+    result = cuTexObjectCreate(&texture, &resource_descriptor, &texture_descriptor, NULL);
+    LOG_PTX_AND_VALIDATE("cuTexObjectCreate", result);
+
+    jlong handles[2] = { (jlong) array, (jlong) texture };
+    jlongArray handles_array = env->NewLongArray(2);
+    env->SetLongArrayRegion(handles_array, 0, 2, handles);
+    return handles_array;
+}
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXContext
+ * Method:    cuTexObjectDestroy
+ * Signature: (JJJ)J
+ */
+JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXContext_cuTexObjectDestroy
+  (JNIEnv *env, jclass clazz, jlong cuContext, jlong cuArray, jlong texObject) {
+    CUcontext* ctx = (CUcontext*) cuContext;
+    CUresult result = cuCtxSetCurrent(*ctx);
+    LOG_PTX_AND_VALIDATE("cuCtxSetCurrent", result);
+
+    result = cuTexObjectDestroy((CUtexObject) texObject);
+    LOG_PTX_AND_VALIDATE("cuTexObjectDestroy", result);
+    result = cuArrayDestroy((CUarray) cuArray);
+    LOG_PTX_AND_VALIDATE("cuArrayDestroy", result);
+    return (jlong) result;
+}
@@ -71,6 +71,22 @@ JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXContext_cuM
 JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXContext_cuCtxSetCurrent
         (JNIEnv *env, jclass clazz, jlong cuContext);
 
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXContext
+ * Method:    cuTexObjectCreate
+ * Signature: (JIIIZ)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXContext_cuTexObjectCreate
+        (JNIEnv *env, jclass clazz, jlong cuContext, jint width, jint height, jint channels, jboolean is_float);
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXContext
+ * Method:    cuTexObjectDestroy
+ * Signature: (JJJ)J
+ */
+JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXContext_cuTexObjectDestroy
+        (JNIEnv *env, jclass clazz, jlong cuContext, jlong cuArray, jlong texObject);
+
 #ifdef __cplusplus
 }
 #endif
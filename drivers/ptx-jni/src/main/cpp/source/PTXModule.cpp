@@ -26,9 +26,13 @@
 #include <cuda.h>
 
 #include <iostream>
+#include <cstdint>
+#include <cstring>
 #include "PTXModule.h"
 #include "ptx_log.h"
 
+#define JIT_LOG_SIZE 8192
+
 jbyteArray from_module(JNIEnv *env, CUmodule *module) {
     jbyteArray array = env->NewByteArray(sizeof(CUmodule));
     env->SetByteArrayRegion(array, 0, sizeof(CUmodule), static_cast<const jbyte *>((void *) module));
@@ -39,13 +43,20 @@ void array_to_module(JNIEnv *env, CUmodule *module_ptr, jbyteArray javaWrapper)
     env->GetByteArrayRegion(javaWrapper, 0, sizeof(CUmodule), static_cast<jbyte *>((void *) module_ptr));
 }
 
+jbyteArray from_log(JNIEnv *env, const char *log) {
+    size_t length = strlen(log);
+    jbyteArray array = env->NewByteArray(length);
+    env->SetByteArrayRegion(array, 0, length, reinterpret_cast<const jbyte *>(log));
+    return array;
+}
+
 /*
  * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXModule
- * Method:    cuModuleLoadData
- * Signature: ([B)[B
+ * Method:    cuModuleLoadDataEx
+ * Signature: ([BIII)[[B
  */
-JNIEXPORT jbyteArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXModule_cuModuleLoadData
-  (JNIEnv *env, jclass clazz, jbyteArray source) {
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXModule_cuModuleLoadDataEx
+  (JNIEnv *env, jclass clazz, jbyteArray source, jint optimisation_level, jint max_registers, jint target) {
     CUresult result;
 
     size_t ptx_length = env->GetArrayLength(source);
@@ -53,27 +64,59 @@ JNIEXPORT jbyteArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXModule
     env->GetByteArrayRegion(source, 0, ptx_length, reinterpret_cast<jbyte *>(ptx));
     ptx[ptx_length] = 0; // Make sure string terminates with a 0
 
+    char info_log[JIT_LOG_SIZE] = { 0 };
+    char error_log[JIT_LOG_SIZE] = { 0 };
+
+    CUjit_option options[8];
+    void *values[8];
+    unsigned int num_options = 0;
+    options[num_options] = CU_JIT_INFO_LOG_BUFFER;
+    values[num_options++] = (void *) info_log;
+    options[num_options] = CU_JIT_INFO_LOG_BUFFER_SIZE_BYTES;
+    values[num_options++] = (void *) (uintptr_t) JIT_LOG_SIZE;
+    options[num_options] = CU_JIT_ERROR_LOG_BUFFER;
+    values[num_options++] = (void *) error_log;
+    options[num_options] = CU_JIT_ERROR_LOG_BUFFER_SIZE_BYTES;
+    values[num_options++] = (void *) (uintptr_t) JIT_LOG_SIZE;
+    // Verbose mode adds the register and spill summary to the info log
+    options[num_options] = CU_JIT_LOG_VERBOSE;
+    values[num_options++] = (void *) (uintptr_t) 1;
+    options[num_options] = CU_JIT_OPTIMIZATION_LEVEL;
+    values[num_options++] = (void *) (uintptr_t) optimisation_level;
+    if (max_registers > 0) {
+        options[num_options] = CU_JIT_MAX_REGISTERS;
+        values[num_options++] = (void *) (uintptr_t) max_registers;
+    }
+    if (target > 0) {
+        options[num_options] = CU_JIT_TARGET;
+        values[num_options++] = (void *) (uintptr_t) target;
+    }
+
     CUmodule module;
-    result = cuModuleLoadData(&module, ptx);
-    LOG_PTX_AND_VALIDATE("cuModuleLoadData", result);
+    result = cuModuleLoadDataEx(&module, ptx, num_options, options, values);
+    LOG_PTX_AND_VALIDATE("cuModuleLoadDataEx", result);
 
-    /// FIXME
+    jclass byte_array_class = env->FindClass("[B");
+    jobjectArray jit_result = env->NewObjectArray(3, byte_array_class, NULL);
     if (result != CUDA_SUCCESS) {
-        printf("PTX to cubin JIT compilation failed! (%d)\n", result);
+        printf("PTX to cubin JIT compilation failed! (%d)\n%s\n", result, error_log);
         fflush(stdout);
-        jbyteArray error_array = env->NewByteArray(0);
-        return error_array;
+        env->SetObjectArrayElement(jit_result, 0, env->NewByteArray(0));
+    } else {
+        env->SetObjectArrayElement(jit_result, 0, from_module(env, &module));
     }
-    return from_module(env, &module);
+    env->SetObjectArrayElement(jit_result, 1, from_log(env, info_log));
+    env->SetObjectArrayElement(jit_result, 2, from_log(env, error_log));
+    return jit_result;
 }
 
 /*
  * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXModule
  * Method:    cuOccupancyMaxPotentialBlockSize
- * Signature: ([BLjava/lang/String;)I
+ * Signature: ([BLjava/lang/String;I)[I
  */
-JNIEXPORT jint JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXModule_cuOccupancyMaxPotentialBlockSize
-  (JNIEnv *env, jclass clazz, jbyteArray module_wrapper, jstring func_name) {
+JNIEXPORT jintArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXModule_cuOccupancyMaxPotentialBlockSize
+  (JNIEnv *env, jclass clazz, jbyteArray module_wrapper, jstring func_name, jint dynamic_shared_memory_bytes) {
     CUresult result;
     CUmodule module;
     array_to_module(env, &module, module_wrapper);
@@ -86,7 +129,34 @@ JNIEXPORT jint JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXModule_cuOcc
 
     int min_grid_size;
     int block_size;
-    result = cuOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, kernel, 0, 0, 0);
+    result = cuOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, kernel, 0, (size_t) dynamic_shared_memory_bytes, 0);
     LOG_PTX_AND_VALIDATE("cuOccupancyMaxPotentialBlockSize", result);
-    return block_size;
-}
\ No newline at end of file
+
+    jint occupancy[2] = { min_grid_size, block_size };
+    jintArray array = env->NewIntArray(2);
+    env->SetIntArrayRegion(array, 0, 2, occupancy);
+    return array;
+}
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXModule
+ * Method:    cuFuncGetAttribute
+ * Signature: ([BLjava/lang/String;I)I
+ */
+JNIEXPORT jint JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXModule_cuFuncGetAttribute
+  (JNIEnv *env, jclass clazz, jbyteArray module_wrapper, jstring func_name, jint attribute) {
+    CUresult result;
+    CUmodule module;
+    array_to_module(env, &module, module_wrapper);
+
+    const char *native_function_name = env->GetStringUTFChars(func_name, 0);
+    CUfunction kernel;
+    result = cuModuleGetFunction(&kernel, module, native_function_name);
+    LOG_PTX_AND_VALIDATE("cuModuleGetFunction", result);
+    env->ReleaseStringUTFChars(func_name, native_function_name);
+
+    int value;
+    result = cuFuncGetAttribute(&value, (CUfunction_attribute) attribute, kernel);
+    LOG_PTX_AND_VALIDATE("cuFuncGetAttribute", result);
+    return value;
+}
@@ -36,19 +36,27 @@ void array_to_module(JNIEnv *env, CUmodule *module_ptr, jbyteArray javaWrapper);
 
 /*
  * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXModule
- * Method:    cuModuleLoadData
- * Signature: ([B)[B
+ * Method:    cuModuleLoadDataEx
+ * Signature: ([BIII)[[B
  */
-JNIEXPORT jbyteArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXModule_cuModuleLoadData
-        (JNIEnv *, jclass, jbyteArray);
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXModule_cuModuleLoadDataEx
+        (JNIEnv *, jclass, jbyteArray, jint, jint, jint);
 
 /*
  * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXModule
  * Method:    cuOccupancyMaxPotentialBlockSize
- * Signature: ([BLjava/lang/String;)I
+ * Signature: ([BLjava/lang/String;I)[I
  */
-JNIEXPORT jint JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXModule_cuOccupancyMaxPotentialBlockSize
-        (JNIEnv *, jclass, jbyteArray, jstring);
+JNIEXPORT jintArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXModule_cuOccupancyMaxPotentialBlockSize
+        (JNIEnv *, jclass, jbyteArray, jstring, jint);
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXModule
+ * Method:    cuFuncGetAttribute
+ * Signature: ([BLjava/lang/String;I)I
+ */
+JNIEXPORT jint JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXModule_cuFuncGetAttribute
+        (JNIEnv *, jclass, jbyteArray, jstring, jint);
 
 #ifdef __cplusplus
 }
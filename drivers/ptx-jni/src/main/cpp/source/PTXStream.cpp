@@ -25,7 +25,14 @@
 #include <jni.h>
 #include <cuda.h>
 
+#include <cstring>
 #include <iostream>
+#ifdef __linux__
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 #include "PTXStream.h"
 #include "PTXModule.h"
 #include "PTXEvent.h"
@@ -34,7 +41,7 @@
 
 /*
     A singly linked list (with elements of type StagingAreaList) is used to keep all the allocated pinned memory through cuMemAllocHost.
-    A queue (with elements of type QueueNode) is used to hold all the free (no longer used) pinned memory regions.
+    Queues (with elements of type QueueNode) are used to hold all the free (no longer used) pinned memory regions, one per NUMA node.
 
     On a new read/write we call get_first_free_staging_area which will try to dequeue a pinned memory region to use it.
 */
@@ -45,13 +52,98 @@
     next            -- next element of the list
     staging_area    -- pointer to the pinned memory region
     length          -- length in bytes of the memory region referenced by staging_area
+    numa_node       -- NUMA node the memory region was bound to (-1 if none)
+    registered      -- true if the region was mapped by us and registered through cuMemHostRegister
+    pool            -- NUMA node of the free queue the region returns to (-1 if none)
+    device          -- ordinal of the device the region is used for, read by the stream callbacks (-1 if unknown)
 */
 typedef struct area_list {
     struct area_list *next;
     void *staging_area;
     size_t length;
+    int numa_node;
+    bool registered;
+    int pool;
+    int device;
 } StagingAreaList;
 
+/*
+    NUMA node closest to each device (indexed by device ordinal), and the cores of that node
+    the stream callbacks are pinned to. Set from Java through PTXStream.setStagingNode.
+*/
+#define MAX_NUMA_DEVICES 64
+#define MAX_NUMA_CPUS 1024
+#define MAX_NUMA_NODES ((int) (sizeof(unsigned long) * 8))
+static int numa_node_of_device[MAX_NUMA_DEVICES];
+static int numa_nodes_initialized = 0;
+static int callback_cpus[MAX_NUMA_DEVICES][MAX_NUMA_CPUS];
+static int num_callback_cpus[MAX_NUMA_DEVICES];
+
+#ifdef __linux__
+#define TORNADO_MPOL_PREFERRED 1
+#endif
+
+/*
+    Returns the ordinal of the device of the current context, or -1 if unknown.
+    It must not be called from stream callbacks, which cannot make CUDA calls.
+*/
+static int current_device() {
+    CUdevice device;
+    if (cuCtxGetDevice(&device) != CUDA_SUCCESS || device < 0 || device >= MAX_NUMA_DEVICES) {
+        return -1;
+    }
+    return device;
+}
+
+/*
+    Returns the NUMA node of the given device, or -1 if unknown or beyond the nodes the staging areas can be bound to.
+*/
+static int numa_node_of(int device) {
+    if (!numa_nodes_initialized || device < 0) {
+        return -1;
+    }
+    int numa_node = numa_node_of_device[device];
+    return (numa_node < MAX_NUMA_NODES) ? numa_node : -1;
+}
+
+/*
+    Allocates pinned memory. If the NUMA node is known, the pages are mapped and bound to that node
+    before they are registered with the driver, so the first touch does not place them on the node
+    of the calling thread. Otherwise, or if any step fails, it falls back to cuMemAllocHost.
+*/
+static CUresult alloc_staging_area(StagingAreaList *list, size_t size, int numa_node) {
+    list->numa_node = -1;
+    list->registered = false;
+#ifdef __linux__
+    if (numa_node >= 0 && numa_node < MAX_NUMA_NODES) {
+        void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr != MAP_FAILED) {
+            unsigned long node_mask = 1UL << numa_node;
+            if (syscall(SYS_mbind, ptr, size, TORNADO_MPOL_PREFERRED, &node_mask, sizeof(node_mask) * 8, 0) == 0
+                    && cuMemHostRegister(ptr, size, CU_MEMHOSTREGISTER_PORTABLE) == CUDA_SUCCESS) {
+                list->staging_area = ptr;
+                list->numa_node = numa_node;
+                list->registered = true;
+                return CUDA_SUCCESS;
+            }
+            munmap(ptr, size);
+        }
+    }
+#endif
+    return cuMemAllocHost(&(list->staging_area), size);
+}
+
+static CUresult free_staging_area(StagingAreaList *list) {
+#ifdef __linux__
+    if (list->registered) {
+        CUresult result = cuMemHostUnregister(list->staging_area);
+        munmap(list->staging_area, list->length);
+        return result;
+    }
+#endif
+    return cuMemFreeHost(list->staging_area);
+}
+
 /*
     Head of the allocated pinned memory list
  */
@@ -66,86 +158,94 @@ typedef struct queue_list {
 } QueueNode;
 
 /*
-    Pointers to the front and rear of the queue.
+    Pointers to the front and rear of the queue of each NUMA node. The first queue holds the regions
+    not bound to any node, and the queue of node N is at index N + 1.
 */
-static QueueNode *front = NULL;
-static QueueNode *rear = NULL;
+static QueueNode *front[MAX_NUMA_NODES + 1] = { NULL };
+static QueueNode *rear[MAX_NUMA_NODES + 1] = { NULL };
 
 /*
-    Adds a free pinned memory region to the queue.
+    Adds a free pinned memory region to the queue of its NUMA node.
 */
 static void enqueue(StagingAreaList *region) {
-    if (front == NULL) {
-        front = static_cast<QueueNode *>(malloc(sizeof(QueueNode)));
-        front->next = NULL;
-        front->element = region;
+    int queue = region->pool + 1;
+    if (front[queue] == NULL) {
+        front[queue] = static_cast<QueueNode *>(malloc(sizeof(QueueNode)));
+        front[queue]->next = NULL;
+        front[queue]->element = region;
 
-        rear = front;
+        rear[queue] = front[queue];
     } else {
         QueueNode *newRear = static_cast<QueueNode *>(malloc(sizeof(QueueNode)));
         newRear->next = NULL;
         newRear->element = region;
 
-        rear->next = newRear;
-        rear = newRear;
+        rear[queue]->next = newRear;
+        rear[queue] = newRear;
     }
 }
 
 /*
-    Returns the first element (free pinned memory region) of the queue.
+    Returns the first element (free pinned memory region) of the queue of the given NUMA node.
 */
-static StagingAreaList* dequeue() {
-    if (front == NULL) {
+static StagingAreaList* dequeue(int numa_node) {
+    int queue = numa_node + 1;
+    if (front[queue] == NULL) {
         return NULL;
     }
-    StagingAreaList* region = front->element;
-    QueueNode *oldFront = front;
-    front = front->next;
+    StagingAreaList* region = front[queue]->element;
+    QueueNode *oldFront = front[queue];
+    front[queue] = front[queue]->next;
     free(oldFront);
 
     return region;
 }
 
 /*
-    Free the queue.
+    Free the queues.
 */
 static void free_queue() {
-    if (front == NULL) return;
-
     QueueNode *node;
-    while(front != NULL) {
-        node = front;
-        front = front->next;
-        free(node);
+    for (int queue = 0; queue <= MAX_NUMA_NODES; queue++) {
+        while (front[queue] != NULL) {
+            node = front[queue];
+            front[queue] = front[queue]->next;
+            free(node);
+        }
+        rear[queue] = NULL;
     }
 }
 
 /*
     Checks if the given staging region can fit into the required size. If not, it allocates the required pinned memory.
+    Regions are taken from the queue of the NUMA node they were allocated for, so they are only reallocated to grow.
 */
-static StagingAreaList *check_or_init_staging_area(size_t size, StagingAreaList *list) {
+static StagingAreaList *check_or_init_staging_area(size_t size, StagingAreaList *list, int numa_node) {
     // Create
     if (list == NULL) {
         list = static_cast<StagingAreaList *>(malloc(sizeof(StagingAreaList)));
-        CUresult result = cuMemAllocHost(&(list->staging_area), size);
+        CUresult result = alloc_staging_area(list, size, numa_node);
         if (result != CUDA_SUCCESS) {
             std::cout << "\t[JNI] " << __FILE__ << ":" << __LINE__ << " in function: " << __FUNCTION__ << " result = " << result << std::endl;
             std::flush(std::cout);
+            free(list);
             return NULL;
         }
         list->length = size;
-        list->next = NULL;
+        list->pool = numa_node;
+        list->next = head;
+        head = list;
     }
 
     // Update
     else if (list->length < size) {
-        CUresult result = cuMemFreeHost(list->staging_area);
+        CUresult result = free_staging_area(list);
         if (result != CUDA_SUCCESS) {
             std::cout << "\t[JNI] " << __FILE__ << ":" << __LINE__ << " in function: " << __FUNCTION__ << " result = " << result << std::endl;
             std::flush(std::cout);
             return NULL;
         }
-        result = cuMemAllocHost(&(list->staging_area), size);
+        result = alloc_staging_area(list, size, numa_node);
         if (result != CUDA_SUCCESS) {
             std::cout << "\t[JNI] " << __FILE__ << ":" << __LINE__ << " in function: " << __FUNCTION__ << " result = " << result << std::endl;
             std::flush(std::cout);
@@ -160,11 +260,16 @@ static StagingAreaList *check_or_init_staging_area(size_t size, StagingAreaList
     Returns a StagingAreaList with pinned memory of given size.
 */
 static StagingAreaList *get_first_free_staging_area(size_t size) {
-    // Dequeue the first free staging area
-    StagingAreaList *list = dequeue();
+    int device = current_device();
+    int numa_node = numa_node_of(device);
 
-    list = check_or_init_staging_area(size, list);
-    if (head == NULL) head = list;
+    // Dequeue the first free staging area of the NUMA node of the device
+    StagingAreaList *list = dequeue(numa_node);
+
+    list = check_or_init_staging_area(size, list, numa_node);
+    if (list != NULL) {
+        list->device = device;
+    }
 
     return list;
 }
@@ -177,13 +282,44 @@ static void set_to_unused(CUstream hStream,  CUresult status, void *list) {
     enqueue(stagingList);
 }
 
+/*
+    Stream callback used when the callbacks must run on the NUMA node of the device. The driver
+    thread is pinned the first time it runs a callback. Callbacks cannot make CUDA calls, so the
+    device is taken from the staging area passed as user data.
+*/
+static void set_to_unused_pinned(CUstream hStream, CUresult status, void *list) {
+#ifdef __linux__
+    static thread_local bool pinned = false;
+    if (!pinned) {
+        pinned = true;
+        int device = ((StagingAreaList *) list)->device;
+        if (device >= 0 && num_callback_cpus[device] > 0) {
+            cpu_set_t cpu_set;
+            CPU_ZERO(&cpu_set);
+            for (int i = 0; i < num_callback_cpus[device]; i++) {
+                CPU_SET(callback_cpus[device][i], &cpu_set);
+            }
+            sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+        }
+    }
+#endif
+    set_to_unused(hStream, status, list);
+}
+
+static CUstreamCallback staging_callback(StagingAreaList *list) {
+    if (list->device >= 0 && num_callback_cpus[list->device] > 0) {
+        return set_to_unused_pinned;
+    }
+    return set_to_unused;
+}
+
 /*
     Free all the allocated pinned memory.
 */
 static CUresult free_staging_area_list() {
     CUresult result;
     while (head != NULL) {
-        result = cuMemFreeHost(head->staging_area);
+        result = free_staging_area(head);
         if (result != CUDA_SUCCESS) {
             std::cout << "\t[JNI] " << __FILE__ << ":" << __LINE__ << " in function: " << __FUNCTION__ << " result = " << result << std::endl;
             std::flush(std::cout);
@@ -392,7 +528,7 @@ JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXStre
     CUresult result = cuMemcpyHtoDAsync(device_ptr, staging_list->staging_area, (size_t) length, stream);\
     LOG_PTX_AND_VALIDATE("cuMemcpyHtoDAsync", result);                           \
     record_event(&afterEvent, &stream);                                 \
-    result = cuStreamAddCallback(stream, set_to_unused, staging_list, 0);\
+    result = cuStreamAddCallback(stream, staging_callback(staging_list), staging_list, 0);\
     LOG_PTX_AND_VALIDATE("cuStreamAddCallback", result);                         \
     return wrapper_from_events(env, &beforeEvent, &afterEvent);
 
@@ -408,7 +544,7 @@ JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXStre
     CUresult result = cuMemcpyHtoDAsync(device_ptr, staging_list->staging_area, (size_t) length, stream);\
     LOG_PTX_AND_VALIDATE("cuMemcpyHtoDAsync", result);                           \
     record_event(&afterEvent, &stream);                                 \
-    result = cuStreamAddCallback(stream, set_to_unused, staging_list, 0);\
+    result = cuStreamAddCallback(stream, staging_callback(staging_list), staging_list, 0);\
     LOG_PTX_AND_VALIDATE("cuStreamAddCallback", result);                         \
     return wrapper_from_events(env, &beforeEvent, &afterEvent);
 
@@ -655,6 +791,68 @@ JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXStream_cuSt
     return (jlong) result;
 }
 
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXStream
+ * Method:    cuMemcpyPeerAsync
+ * Signature: (JJJ[B)[[B
+ */
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXStream_cuMemcpyPeerAsync
+  (JNIEnv *env, jclass clazz, jlong dst_device_ptr, jlong src_device_ptr, jlong length, jbyteArray stream_wrapper) {
+    CUevent beforeEvent, afterEvent;
+    CUstream stream;
+    stream_from_array(env, &stream, stream_wrapper);
+
+    CUcontext dst_context;
+    CUcontext src_context;
+    CUresult result = cuPointerGetAttribute(&dst_context, CU_POINTER_ATTRIBUTE_CONTEXT, (CUdeviceptr) dst_device_ptr);
+    LOG_PTX_AND_VALIDATE("cuPointerGetAttribute", result);
+    result = cuPointerGetAttribute(&src_context, CU_POINTER_ATTRIBUTE_CONTEXT, (CUdeviceptr) src_device_ptr);
+    LOG_PTX_AND_VALIDATE("cuPointerGetAttribute", result);
+
+    record_events_create(&beforeEvent, &afterEvent);
+    record_event(&beforeEvent, &stream);
+    if (dst_context == src_context) {
+        result = cuMemcpyDtoDAsync((CUdeviceptr) dst_device_ptr, (CUdeviceptr) src_device_ptr, (size_t) length, stream);
+        LOG_PTX_AND_VALIDATE("cuMemcpyDtoDAsync", result);
+    } else {
+        result = cuMemcpyPeerAsync((CUdeviceptr) dst_device_ptr, dst_context, (CUdeviceptr) src_device_ptr, src_context, (size_t) length, stream);
+        LOG_PTX_AND_VALIDATE("cuMemcpyPeerAsync", result);
+    }
+    record_event(&afterEvent, &stream);
+
+    return wrapper_from_events(env, &beforeEvent, &afterEvent);
+}
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXStream
+ * Method:    cuMemcpyDtoArrayAsync
+ * Signature: (JJJJ[B)[[B
+ */
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXStream_cuMemcpyDtoArrayAsync
+  (JNIEnv *env, jclass clazz, jlong src_device_ptr, jlong dst_array, jlong width_in_bytes, jlong height, jbyteArray stream_wrapper) {
+    CUevent beforeEvent, afterEvent;
+    CUstream stream;
+    stream_from_array(env, &stream, stream_wrapper);
+
+    CUDA_MEMCPY2D copy;
+    memset(&copy, 0, sizeof(copy));
+    copy.srcMemoryType = CU_MEMORYTYPE_DEVICE;
+    copy.srcDevice = (CUdeviceptr) src_device_ptr;
+    copy.srcPitch = (size_t) width_in_bytes;
+    copy.dstMemoryType = CU_MEMORYTYPE_ARRAY;
+    copy.dstArray = (CUarray) dst_array;
+    copy.WidthInBytes = (size_t) width_in_bytes;
+    copy.Height = (size_t) height;
+
+    record_events_create(&beforeEvent, &afterEvent);
+    record_event(&beforeEvent, &stream);
+    CUresult result = cuMemcpy2DAsync(&copy, stream);
+    LOG_PTX_AND_VALIDATE("cuMemcpy2DAsync", result);
+    record_event(&afterEvent, &stream);
+
+    return wrapper_from_events(env, &beforeEvent, &afterEvent);
+}
+
 /*
  * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXStream
  * Method:    cuEventCreateAndRecord
@@ -672,4 +870,32 @@ JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXStre
     record_event(&afterEvent, &stream);
 
     return wrapper_from_events(env, &beforeEvent, &afterEvent);
-}
\ No newline at end of file
+}
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXStream
+ * Method:    setStagingNode
+ * Signature: (II[I)V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXStream_setStagingNode
+  (JNIEnv *env, jclass clazz, jint device_ordinal, jint numa_node, jintArray cpus) {
+    if (!numa_nodes_initialized) {
+        for (int i = 0; i < MAX_NUMA_DEVICES; i++) {
+            numa_node_of_device[i] = -1;
+            num_callback_cpus[i] = 0;
+        }
+        numa_nodes_initialized = 1;
+    }
+    if (device_ordinal < 0 || device_ordinal >= MAX_NUMA_DEVICES) {
+        return;
+    }
+    numa_node_of_device[device_ordinal] = numa_node;
+    jsize length = (cpus == NULL) ? 0 : env->GetArrayLength(cpus);
+    if (length > MAX_NUMA_CPUS) {
+        length = MAX_NUMA_CPUS;
+    }
+    if (length > 0) {
+        env->GetIntArrayRegion(cpus, 0, length, callback_cpus[device_ordinal]);
+    }
+    num_callback_cpus[device_ordinal] = length;
+}
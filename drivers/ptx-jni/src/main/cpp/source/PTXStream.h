@@ -287,6 +287,22 @@ JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXStream_cuDe
 JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXStream_cuStreamSynchronize
   (JNIEnv *, jclass, jbyteArray);
 
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXStream
+ * Method:    cuMemcpyPeerAsync
+ * Signature: (JJJ[B)[[B
+ */
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXStream_cuMemcpyPeerAsync
+  (JNIEnv *, jclass, jlong, jlong, jlong, jbyteArray);
+
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXStream
+ * Method:    cuMemcpyDtoArrayAsync
+ * Signature: (JJJJ[B)[[B
+ */
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXStream_cuMemcpyDtoArrayAsync
+  (JNIEnv *, jclass, jlong, jlong, jlong, jlong, jbyteArray);
+
 /*
  * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXStream
  * Method:    cuEventCreateAndRecord
@@ -295,6 +311,14 @@ JNIEXPORT jlong JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXStream_cuSt
 JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXStream_cuEventCreateAndRecord
   (JNIEnv *, jclass, jboolean, jbyteArray);
 
+/*
+ * Class:     uk_ac_manchester_tornado_drivers_ptx_PTXStream
+ * Method:    setStagingNode
+ * Signature: (II[I)V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_tornado_drivers_ptx_PTXStream_setStagingNode
+  (JNIEnv *, jclass, jint, jint, jintArray);
+
 #ifdef __cplusplus
 }
 #endif
@@ -60,6 +60,11 @@ public class PTX {
 
     private native static long cuInit();
 
+    /**
+     * Sets the affinity of the calling thread to the given cores.
+     */
+    public native static void pinCurrentThread(int[] cpus);
+
     private static void initialise() {
         if (initialised) {
             return;
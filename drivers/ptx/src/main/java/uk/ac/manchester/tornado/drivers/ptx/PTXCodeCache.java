@@ -23,11 +23,14 @@
  */
 package uk.ac.manchester.tornado.drivers.ptx;
 
+import java.util.ArrayList;
+import java.util.List;
 import java.util.concurrent.ConcurrentHashMap;
 
 import uk.ac.manchester.tornado.api.exceptions.TornadoBailoutRuntimeException;
 import uk.ac.manchester.tornado.drivers.ptx.graal.PTXInstalledCode;
 import uk.ac.manchester.tornado.runtime.common.RuntimeUtilities;
+import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
 import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
 
 public class PTXCodeCache {
@@ -44,20 +47,46 @@ public class PTXCodeCache {
         String cacheKey = name;
 
         if (!cache.containsKey(cacheKey)) {
-            RuntimeUtilities.maybePrintSource(targetCode);
+            PTXInstalledCode code = buildSource(name, targetCode, taskMeta, resolvedMethodName);
+            cache.put(cacheKey, code);
+            return code;
+        }
 
-            PTXModule module = new PTXModule(resolvedMethodName, targetCode, name, taskMeta);
+        return cache.get(cacheKey);
+    }
 
-            if (module.isPTXJITSuccess()) {
-                PTXInstalledCode code = new PTXInstalledCode(name, module, deviceContext);
-                cache.put(cacheKey, code);
-                return code;
-            } else {
-                throw new TornadoBailoutRuntimeException("PTX JIT compilation failed!");
-            }
+    /**
+     * JIT compiles a kernel without adding it to the cache. It is used by the
+     * tiered compilation to build the optimised version of a cached kernel.
+     */
+    public PTXInstalledCode buildSource(String name, byte[] targetCode, TaskMetaData taskMeta, String resolvedMethodName) {
+        RuntimeUtilities.maybePrintSource(targetCode);
+
+        PTXModule module = new PTXModule(resolvedMethodName, targetCode, name, taskMeta, taskMeta.getDynamicSharedMemoryBytes());
+
+        if (module.isPTXJITSuccess()) {
+            return new PTXInstalledCode(name, createRegisterVariants(module), deviceContext);
+        } else {
+            throw new TornadoBailoutRuntimeException("PTX JIT compilation failed! " + module.getJITErrorLog());
         }
+    }
 
-        return cache.get(cacheKey);
+    private PTXModule[] createRegisterVariants(PTXModule module) {
+        List<PTXModule> variants = new ArrayList<>();
+        variants.add(module);
+        if (!TornadoOptions.PTX_JIT_REGISTER_VARIANTS.isEmpty()) {
+            for (String registers : TornadoOptions.PTX_JIT_REGISTER_VARIANTS.split(",")) {
+                int maxRegisters = Integer.parseInt(registers.trim());
+                if (maxRegisters == module.getMaxRegisters()) {
+                    continue;
+                }
+                PTXModule variant = new PTXModule(module.javaName, module.getSource(), module.kernelFunctionName, module.metaData, module.getDynamicSharedMemoryBytes(), maxRegisters);
+                if (variant.isPTXJITSuccess()) {
+                    variants.add(variant);
+                }
+            }
+        }
+        return variants.toArray(new PTXModule[0]);
     }
 
     public PTXInstalledCode getCachedCode(String name) {
@@ -25,9 +25,15 @@ package uk.ac.manchester.tornado.drivers.ptx;
 
 import uk.ac.manchester.tornado.api.exceptions.TornadoBailoutRuntimeException;
 import uk.ac.manchester.tornado.api.exceptions.TornadoInternalError;
+import uk.ac.manchester.tornado.runtime.common.NumaTopology;
 import uk.ac.manchester.tornado.runtime.common.TornadoLogger;
 
+import java.util.ArrayList;
+import java.util.List;
+
 import static uk.ac.manchester.tornado.runtime.common.TornadoOptions.DUMP_EVENTS;
+import static uk.ac.manchester.tornado.runtime.common.TornadoOptions.NUMA_AWARE_STAGING;
+import static uk.ac.manchester.tornado.runtime.common.TornadoOptions.NUMA_PIN_THREADS;
 
 public class PTXContext extends TornadoLogger {
 
@@ -36,14 +42,21 @@ public class PTXContext extends TornadoLogger {
     private final PTXStream stream;
     private final PTXDeviceContext deviceContext;
     private long allocatedRegion;
+    private final List<long[]> textures;
 
     public PTXContext(PTXDevice device) {
         this.device = device;
 
         ptxContext = cuCtxCreate(device.getCuDevice());
+        if (NUMA_AWARE_STAGING || NUMA_PIN_THREADS) {
+            int numaNode = device.getNumaNode();
+            int[] callbackCpus = NUMA_PIN_THREADS ? NumaTopology.getInstance().getCpusOfNode(numaNode) : new int[0];
+            PTXStream.setStagingNode(device.getDeviceIndex(), NUMA_AWARE_STAGING ? numaNode : NumaTopology.UNKNOWN_NODE, callbackCpus);
+        }
 
         stream = new PTXStream();
         deviceContext = new PTXDeviceContext(device, stream);
+        textures = new ArrayList<>();
     }
 
     private native static long cuCtxCreate(long deviceIndex);
@@ -56,6 +69,10 @@ public class PTXContext extends TornadoLogger {
 
     private native static long cuCtxSetCurrent(long cuContext);
 
+    private native static long[] cuTexObjectCreate(long cuContext, int width, int height, int channels, boolean isFloat);
+
+    private native static long cuTexObjectDestroy(long cuContext, long cuArray, long texObject);
+
     public void enablePTXContext() {
         cuCtxSetCurrent(ptxContext);
     }
@@ -66,6 +83,10 @@ public class PTXContext extends TornadoLogger {
         }
 
         deviceContext.cleanup();
+        for (long[] texture : textures) {
+            cuTexObjectDestroy(ptxContext, texture[0], texture[1]);
+        }
+        textures.clear();
         cuMemFree(ptxContext, allocatedRegion);
         cuCtxDestroy(ptxContext);
     }
@@ -83,4 +104,18 @@ public class PTXContext extends TornadoLogger {
         }
         return allocatedRegion;
     }
+
+    /**
+     * Creates a 2D CUDA array with {@code channels} 32-bit float or 8-bit signed
+     * integer channels per texel, and a texture object to read it. Both live
+     * until the context is cleaned up.
+     *
+     * @return the CUDA array handle at index 0 and the texture object at index
+     *         1.
+     */
+    public long[] createTexture(int width, int height, int channels, boolean isFloat) {
+        final long[] texture = cuTexObjectCreate(ptxContext, width, height, channels, isFloat);
+        textures.add(texture);
+        return texture;
+    }
 }
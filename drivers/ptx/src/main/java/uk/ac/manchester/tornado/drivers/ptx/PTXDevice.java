@@ -28,6 +28,7 @@ import java.nio.ByteOrder;
 import uk.ac.manchester.tornado.api.TornadoTargetDevice;
 import uk.ac.manchester.tornado.api.enums.TornadoDeviceType;
 import uk.ac.manchester.tornado.drivers.ptx.enums.PTXDeviceAttribute;
+import uk.ac.manchester.tornado.runtime.common.NumaTopology;
 import uk.ac.manchester.tornado.runtime.common.TornadoLogger;
 
 public class PTXDevice extends TornadoLogger implements TornadoTargetDevice {
@@ -48,6 +49,7 @@ public class PTXDevice extends TornadoLogger implements TornadoTargetDevice {
     private final long totalDeviceMemory;
     private final long constantBufferSize;
     private final long maxAllocationSize;
+    private final int numaNode;
 
     public PTXDevice(int deviceIndex) {
         this.deviceIndex = deviceIndex;
@@ -63,6 +65,7 @@ public class PTXDevice extends TornadoLogger implements TornadoTargetDevice {
         ptxVersion = CUDAVersion.getMaxPTXVersion(cuDriverGetVersion());
         computeCapability = initComputeCapability();
         targetArchitecture = ptxVersion.getArchitecture(computeCapability);
+        numaNode = initNumaNode();
 
         // A PTXcontext for the CUDevice must be created first before cuMemGetInfo
         // is invoked.
@@ -93,6 +96,21 @@ public class PTXDevice extends TornadoLogger implements TornadoTargetDevice {
         return new CUDAComputeCapability(major, minor);
     }
 
+    private int initNumaNode() {
+        int domain = cuDeviceGetAttribute(cuDevice, PTXDeviceAttribute.PCI_DOMAIN_ID.value());
+        int bus = cuDeviceGetAttribute(cuDevice, PTXDeviceAttribute.PCI_BUS_ID.value());
+        int slot = cuDeviceGetAttribute(cuDevice, PTXDeviceAttribute.PCI_DEVICE_ID.value());
+        return NumaTopology.getInstance().getNodeOfPCIDevice(NumaTopology.formatPCIBusId(domain, bus, slot, 0));
+    }
+
+    /**
+     * @return the NUMA node closest to the device, or
+     *         {@link NumaTopology#UNKNOWN_NODE}.
+     */
+    public int getNumaNode() {
+        return numaNode;
+    }
+
     public CUDAComputeCapability getComputeCapability() {
         return computeCapability;
     }
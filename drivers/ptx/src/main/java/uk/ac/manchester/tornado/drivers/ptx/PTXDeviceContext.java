@@ -32,20 +32,23 @@ import java.util.List;
 
 import uk.ac.manchester.tornado.api.TornadoDeviceContext;
 import uk.ac.manchester.tornado.api.WorkerGrid;
+import uk.ac.manchester.tornado.api.common.Access;
 import uk.ac.manchester.tornado.api.common.Event;
 import uk.ac.manchester.tornado.api.common.SchedulableTask;
 import uk.ac.manchester.tornado.api.exceptions.TornadoBailoutRuntimeException;
+import uk.ac.manchester.tornado.api.mm.ObjectBuffer;
 import uk.ac.manchester.tornado.api.profiler.ProfilerType;
 import uk.ac.manchester.tornado.api.runtime.TornadoRuntime;
 import uk.ac.manchester.tornado.drivers.ptx.graal.compiler.PTXCompilationResult;
 import uk.ac.manchester.tornado.drivers.ptx.mm.PTXCallStack;
+import uk.ac.manchester.tornado.drivers.ptx.mm.PTXImageWrapper;
 import uk.ac.manchester.tornado.drivers.ptx.mm.PTXMemoryManager;
 import uk.ac.manchester.tornado.drivers.ptx.runtime.PTXTornadoDevice;
 import uk.ac.manchester.tornado.runtime.common.CallStack;
 import uk.ac.manchester.tornado.runtime.common.Initialisable;
 import uk.ac.manchester.tornado.runtime.common.TornadoInstalledCode;
 import uk.ac.manchester.tornado.runtime.common.TornadoLogger;
-import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
+import uk.ac.manchester.tornado.runtime.profiler.ProfilerSampler;
 import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
 
 public class PTXDeviceContext extends TornadoLogger implements Initialisable, TornadoDeviceContext {
@@ -150,6 +153,19 @@ public class PTXDeviceContext extends TornadoLogger implements Initialisable, To
         return device.getByteOrder();
     }
 
+    /**
+     * Keeps the event of {@code localEventId} alive until
+     * {@link #releaseEvent(int)}, so it can be queried after newer events have
+     * been registered.
+     */
+    public void retainEvent(int localEventId) {
+        stream.retainEvent(localEventId);
+    }
+
+    public void releaseEvent(int localEventId) {
+        stream.releaseEvent(localEventId);
+    }
+
     public Event resolveEvent(int event) {
         return stream.resolveEvent(event);
     }
@@ -178,6 +194,14 @@ public class PTXDeviceContext extends TornadoLogger implements Initialisable, To
         return stream.enqueueBarrier(events);
     }
 
+    public int enqueueCopyFromPeer(long dstAddress, long srcAddress, long length, int[] waitEvents) {
+        return stream.enqueueCopyFromPeer(dstAddress, srcAddress, length, waitEvents);
+    }
+
+    public int enqueueCopyBufferToImage(long address, long array, long widthInBytes, long height, int[] waitEvents) {
+        return stream.enqueueCopyBufferToArray(address, array, widthInBytes, height, waitEvents);
+    }
+
     public void sync() {
         stream.sync();
     }
@@ -216,16 +240,28 @@ public class PTXDeviceContext extends TornadoLogger implements Initialisable, To
             gridDimension = scheduler.calculateGridDimension(module.javaName, grid.dimension(), global, blockDimension);
         } else if (module.metaData.isParallel()) {
             scheduler.calculateGlobalWork(module.metaData, batchThreads);
-            blockDimension = scheduler.calculateBlockDimension(module);
-            gridDimension = scheduler.calculateGridDimension(module, blockDimension);
+            if (scheduler.isGridStrideLaunchAllowed(module)) {
+                int[][] launch = scheduler.calculateGridStrideLaunch(module);
+                blockDimension = launch[0];
+                gridDimension = launch[1];
+            } else {
+                blockDimension = scheduler.calculateBlockDimension(module);
+                gridDimension = scheduler.calculateGridDimension(module, blockDimension);
+            }
         }
-        int kernelLaunchEvent = stream.enqueueKernelLaunch(module, writePTXStackOnDevice((PTXCallStack) stack), gridDimension, blockDimension);
-        updateProfiler(kernelLaunchEvent, module.metaData);
+        final PTXCallStack ptxStack = (PTXCallStack) stack;
+        // The stream is in order, so the texture copies complete before the kernel runs
+        for (PTXImageWrapper image : ptxStack.getImages()) {
+            image.enqueueRefresh(null);
+        }
+        int kernelLaunchEvent = stream.enqueueKernelLaunch(module, writePTXStackOnDevice(ptxStack), gridDimension, blockDimension);
+        markWrittenImages(ptxStack, module.metaData);
+        updateProfiler(kernelLaunchEvent, module);
         return kernelLaunchEvent;
     }
 
     private byte[] writePTXStackOnDevice(PTXCallStack stack) {
-        ByteBuffer args = ByteBuffer.allocate(8);
+        ByteBuffer args = ByteBuffer.allocate(8 * (1 + stack.getImages().size()));
         args.order(getByteOrder());
 
         // Stack pointer
@@ -235,11 +271,34 @@ public class PTXDeviceContext extends TornadoLogger implements Initialisable, To
         long address = stack.getAddress();
         args.putLong(address);
 
+        // Texture objects of the image parameters
+        for (PTXImageWrapper image : stack.getImages()) {
+            args.putLong(image.getTextureObject());
+        }
+
         return args.array();
     }
 
-    private void updateProfiler(final int taskEvent, final TaskMetaData meta) {
-        if (TornadoOptions.isProfilerEnabled()) {
+    /**
+     * Kernels write images through the heap copy, so every image passed to an
+     * argument the kernel may write is refreshed before it is read again.
+     */
+    private void markWrittenImages(PTXCallStack stack, TaskMetaData meta) {
+        if (stack.getImages().isEmpty()) {
+            return;
+        }
+        final Access[] accesses = meta.getArgumentsAccess();
+        for (int i = 0; i < accesses.length; i++) {
+            final ObjectBuffer argument = stack.getArgumentBuffer(i);
+            if (argument instanceof PTXImageWrapper && accesses[i] != Access.READ) {
+                ((PTXImageWrapper) argument).markStale();
+            }
+        }
+    }
+
+    private void updateProfiler(final int taskEvent, final PTXModule module) {
+        if (ProfilerSampler.isTimed()) {
+            final TaskMetaData meta = module.metaData;
             Event tornadoKernelEvent = resolveEvent(taskEvent);
             tornadoKernelEvent.waitForEvents();
             long timer = meta.getProfiler().getTimer(ProfilerType.TOTAL_KERNEL_TIME);
@@ -247,6 +306,11 @@ public class PTXDeviceContext extends TornadoLogger implements Initialisable, To
             meta.getProfiler().setTimer(ProfilerType.TOTAL_KERNEL_TIME, timer + tornadoKernelEvent.getExecutionTime());
             // Register the time for the task
             meta.getProfiler().setTaskTimer(ProfilerType.TASK_KERNEL_TIME, meta.getId(), tornadoKernelEvent.getExecutionTime());
+            // Register the resource usage reported by the JIT compiler
+            meta.getProfiler().setMetric(ProfilerType.TASK_REGISTERS, meta.getId(), module.getRegistersPerThread());
+            meta.getProfiler().setMetric(ProfilerType.TASK_SPILL_STORES_BYTES, meta.getId(), module.getSpillStoreBytes());
+            meta.getProfiler().setMetric(ProfilerType.TASK_SPILL_LOADS_BYTES, meta.getId(), module.getSpillLoadBytes());
+            meta.getProfiler().setMetric(ProfilerType.TASK_SHARED_MEMORY_BYTES, meta.getId(), module.getSharedMemoryBytes());
         }
     }
 
@@ -22,6 +22,8 @@
 */
 package uk.ac.manchester.tornado.drivers.ptx;
 
+import java.util.Arrays;
+
 import uk.ac.manchester.tornado.api.common.Event;
 import uk.ac.manchester.tornado.api.enums.TornadoExecutionStatus;
 import uk.ac.manchester.tornado.drivers.ptx.enums.PTXEventStatus;
@@ -50,6 +52,8 @@ public class PTXEvent extends TornadoLogger implements Event {
             "readFromDevice - double[]",
             "sync - marker",
             "sync - barrier",
+            "copyBuffer - peer",
+            "copyBuffer - texture",
             "none"
     };
     // @formatter:on
@@ -70,7 +74,9 @@ public class PTXEvent extends TornadoLogger implements Event {
     protected static final int DESC_READ_DOUBLE = 13;
     protected static final int DESC_SYNC_MARKER = 14;
     protected static final int DESC_SYNC_BARRIER = 15;
-    protected static final int EVENT_NONE = 16;
+    protected static final int DESC_COPY_BUFFER_PEER = 16;
+    protected static final int DESC_COPY_BUFFER_TEXTURE = 17;
+    protected static final int EVENT_NONE = 18;
 
     /**
      * Wrapper containing two serialized CUevent structs. Between the two events, on
@@ -85,6 +91,7 @@ public class PTXEvent extends TornadoLogger implements Event {
     private final byte[][] eventWrapper;
 
     private boolean isCompleted;
+    private boolean isDestroyed;
     private final String description;
     private final long tag;
     private final String name;
@@ -111,12 +118,11 @@ public class PTXEvent extends TornadoLogger implements Event {
     private native static long cuEventElapsedTime(byte[][] wrappers);
 
     public static void waitForEventArray(PTXEvent[] events) {
-        byte[][] wrappers = new byte[events.length][];
-        for (int i = 0; i < events.length; i++) {
-            wrappers[i] = events[i].eventWrapper[1];
+        // Destroyed events have already completed
+        byte[][] wrappers = Arrays.stream(events).filter(event -> !event.isDestroyed).map(event -> event.eventWrapper[1]).toArray(byte[][]::new);
+        if (wrappers.length > 0) {
+            tornadoCUDAEventsSynchronize(wrappers);
         }
-
-        tornadoCUDAEventsSynchronize(wrappers);
     }
 
     @Override
@@ -165,8 +171,15 @@ public class PTXEvent extends TornadoLogger implements Event {
         return -1;
     }
 
+    /**
+     * @return the elapsed time, or -1 if the event has been destroyed (e.g.,
+     *         its slot was recycled by the events wrapper).
+     */
     @Override
     public long getExecutionTime() {
+        if (isDestroyed) {
+            return -1;
+        }
         return cuEventElapsedTime(eventWrapper);
     }
 
@@ -177,7 +190,7 @@ public class PTXEvent extends TornadoLogger implements Event {
 
     @Override
     public double getExecutionTimeInSeconds() {
-        return RuntimeUtilities.elapsedTimeInSeconds(cuEventElapsedTime(eventWrapper));
+        return RuntimeUtilities.elapsedTimeInSeconds(getExecutionTime());
     }
 
     @Override
@@ -201,8 +214,17 @@ public class PTXEvent extends TornadoLogger implements Event {
         waitForEvents();
     }
 
+    public boolean isDestroyed() {
+        return isDestroyed;
+    }
+
     public void destroy() {
+        if (isDestroyed) {
+            return;
+        }
         cuEventDestroy(eventWrapper[0]);
         cuEventDestroy(eventWrapper[1]);
+        isDestroyed = true;
+        isCompleted = true;
     }
 }
@@ -23,95 +23,76 @@
  */
 package uk.ac.manchester.tornado.drivers.ptx;
 
-import static uk.ac.manchester.tornado.api.exceptions.TornadoInternalError.guarantee;
 import static uk.ac.manchester.tornado.drivers.ptx.PTXEvent.EVENT_DESCRIPTIONS;
 import static uk.ac.manchester.tornado.runtime.common.Tornado.EVENT_WINDOW;
 import static uk.ac.manchester.tornado.runtime.common.Tornado.fatal;
-import static uk.ac.manchester.tornado.runtime.common.TornadoOptions.CIRCULAR_EVENTS;
 
 import java.util.ArrayList;
-import java.util.Arrays;
-import java.util.BitSet;
 import java.util.List;
 
+import uk.ac.manchester.tornado.api.enums.TornadoExecutionStatus;
 import uk.ac.manchester.tornado.api.exceptions.TornadoBailoutRuntimeException;
+import uk.ac.manchester.tornado.runtime.common.EventTable;
 
+/**
+ * Holds the mapping between CUDA events and TornadoVM local events. Slots are
+ * kept in a growable {@link EventTable} and recycled once {@code EVENT_WINDOW}
+ * newer events have been registered and the CUDA event has completed.
+ */
 public class PTXEventsWrapper {
 
-    private final PTXEvent[] events;
-    private final BitSet retain;
-    private int eventIndex;
+    private final EventTable<PTXEvent> events;
 
     protected PTXEventsWrapper() {
-        this.retain = new BitSet(EVENT_WINDOW);
-        this.retain.clear();
-        this.events = new PTXEvent[EVENT_WINDOW];
-        this.eventIndex = 0;
+        this.events = new EventTable<>(EVENT_WINDOW, EVENT_WINDOW, new EventTable.Reclaimer<PTXEvent>() {
+            @Override
+            public boolean isComplete(PTXEvent event) {
+                // Failed events are never going to complete
+                final TornadoExecutionStatus status = event.getStatus();
+                return status == TornadoExecutionStatus.COMPLETE || status == TornadoExecutionStatus.ERROR;
+            }
+
+            @Override
+            public void release(PTXEvent event) {
+                event.destroy();
+            }
+        });
     }
 
     protected int registerEvent(byte[][] eventWrapper, int descriptorId, long tag) {
-        if (retain.get(eventIndex)) {
-            findNextEventSlot();
-        }
-        final int currentEvent = eventIndex;
-        guarantee(!retain.get(currentEvent), "overwriting retained event");
-
         if (eventWrapper == null) {
             fatal("invalid event: description=%s, tag=0x%x\n", EVENT_DESCRIPTIONS[descriptorId], tag);
             fatal("terminating application as system integrity has been compromised.");
             throw new TornadoBailoutRuntimeException("[ERROR] NULL event received from the CUDA driver !");
         }
 
-        if (events[currentEvent] != null && !retain.get(currentEvent)) {
-            events[currentEvent].waitForEvents();
-            events[currentEvent].destroy();
-            events[currentEvent] = null;
-        }
-        events[currentEvent] = new PTXEvent(eventWrapper, descriptorId, tag);
-
-        findNextEventSlot();
-        return currentEvent;
-    }
-
-    private void findNextEventSlot() {
-        eventIndex = retain.nextClearBit(eventIndex + 1);
-
-        if (CIRCULAR_EVENTS && (eventIndex >= events.length)) {
-            eventIndex = 0;
-        }
-
-        guarantee(eventIndex != -1, "event window is full (retained=%d, capacity=%d)", retain.cardinality(), EVENT_WINDOW);
+        return events.register(new PTXEvent(eventWrapper, descriptorId, tag));
     }
 
     protected void reset() {
-        for (PTXEvent event : events) {
-            if (event != null) {
-                event.destroy();
-            }
-        }
-        Arrays.fill(events, null);
-        eventIndex = 0;
+        events.clear();
     }
 
-    private void releaseEvent(int localEventID) {
-        retain.clear(localEventID);
+    protected void releaseEvent(int localEventID) {
+        events.release(localEventID);
     }
 
-    private void retainEvent(int localEventID) {
-        retain.set(localEventID);
+    protected void retainEvent(int localEventID) {
+        events.retain(localEventID);
     }
 
     protected PTXEvent getEvent(int localEventID) {
-        return events[localEventID];
+        return events.get(localEventID);
     }
 
     public List<PTXEvent> getEvents() {
         List<PTXEvent> result = new ArrayList<>();
-        for (int i = 0; i < eventIndex; i++) {
-            if (events[i] == null) {
+        for (int i = 0; i < events.size(); i++) {
+            final PTXEvent event = events.get(i);
+            if (event == null) {
                 continue;
             }
-            result.add(events[i]);
+            result.add(event);
         }
         return result;
     }
@@ -23,36 +23,190 @@
  */
 package uk.ac.manchester.tornado.drivers.ptx;
 
+import java.nio.charset.StandardCharsets;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import uk.ac.manchester.tornado.api.exceptions.TornadoRuntimeException;
+import uk.ac.manchester.tornado.drivers.ptx.enums.PTXFunctionAttribute;
+import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
 import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
 
 public class PTXModule {
+    private static final Pattern SPILL_STORES = Pattern.compile("(\\d+) bytes spill stores");
+    private static final Pattern SPILL_LOADS = Pattern.compile("(\\d+) bytes spill loads");
+    private static final int JIT_TARGET = parseJITTarget(TornadoOptions.PTX_JIT_TARGET);
+
     public final byte[] moduleWrapper;
     public final String kernelFunctionName;
     public final TaskMetaData metaData;
     private int maxBlockSize;
+    private int residentBlocks;
+    private int registersPerThread;
+    private int sharedMemoryBytes;
+    private final int dynamicSharedMemoryBytes;
+    private final int maxRegisters;
+    private final String jitInfoLog;
+    private final String jitErrorLog;
     public final String javaName;
     private final byte[] source;
+    private final boolean blockCooperation;
 
     public PTXModule(String name, byte[] source, String kernelFunctionName, TaskMetaData taskMetaData) {
-        moduleWrapper = cuModuleLoadData(source);
+        this(name, source, kernelFunctionName, taskMetaData, taskMetaData.getDynamicSharedMemoryBytes());
+    }
+
+    public PTXModule(String name, byte[] source, String kernelFunctionName, TaskMetaData taskMetaData, int dynamicSharedMemoryBytes) {
+        this(name, source, kernelFunctionName, taskMetaData, dynamicSharedMemoryBytes, TornadoOptions.PTX_JIT_MAX_REGISTERS);
+    }
+
+    public PTXModule(String name, byte[] source, String kernelFunctionName, TaskMetaData taskMetaData, int dynamicSharedMemoryBytes, int maxRegisters) {
+        byte[][] jit = cuModuleLoadDataEx(source, TornadoOptions.PTX_JIT_OPTIMISATION_LEVEL, maxRegisters, JIT_TARGET);
+        moduleWrapper = jit[0];
+        jitInfoLog = new String(jit[1], StandardCharsets.US_ASCII).trim();
+        jitErrorLog = new String(jit[2], StandardCharsets.US_ASCII).trim();
         this.source = source;
+        this.blockCooperation = usesBlockCooperation(new String(source, StandardCharsets.US_ASCII));
         this.kernelFunctionName = kernelFunctionName;
+        this.dynamicSharedMemoryBytes = dynamicSharedMemoryBytes;
+        this.maxRegisters = maxRegisters;
         metaData = taskMetaData;
         maxBlockSize = -1;
+        registersPerThread = -1;
+        sharedMemoryBytes = -1;
         javaName = name;
+
+        if (metaData.isDebug() && !jitInfoLog.isEmpty()) {
+            System.out.println("[CUDA-PTX] JIT info log for " + kernelFunctionName + ":\n" + jitInfoLog);
+        }
     }
 
-    private native static byte[] cuModuleLoadData(byte[] source);
+    /**
+     * JIT compiles the PTX source with {@code cuModuleLoadDataEx}. Zero disables
+     * the register cap and selects the target of the current context.
+     *
+     * @return {module wrapper (empty on failure), JIT info log, JIT error log}
+     */
+    private native static byte[][] cuModuleLoadDataEx(byte[] source, int optimisationLevel, int maxRegisters, int target);
+
+    /**
+     * Returns {minGridSize, blockSize}, where minGridSize is the number of blocks
+     * of blockSize threads that fill the device at maximum occupancy.
+     */
+    private native static int[] cuOccupancyMaxPotentialBlockSize(byte[] module, String funcName, int dynamicSharedMemoryBytes);
 
-    private native static int cuOccupancyMaxPotentialBlockSize(byte[] module, String funcName);
+    private native static int cuFuncGetAttribute(byte[] module, String funcName, int attribute);
 
+    private void computeOccupancy() {
+        int[] occupancy = cuOccupancyMaxPotentialBlockSize(moduleWrapper, kernelFunctionName, dynamicSharedMemoryBytes);
+        residentBlocks = occupancy[0];
+        maxBlockSize = occupancy[1];
+    }
+
+    /**
+     * Block size that maximises occupancy, taking into account the registers,
+     * static shared memory and dynamic shared memory used by the kernel.
+     */
     public int getMaxThreadBlocks() {
         if (maxBlockSize < 0) {
-            maxBlockSize = cuOccupancyMaxPotentialBlockSize(moduleWrapper, kernelFunctionName);
+            computeOccupancy();
         }
         return maxBlockSize;
     }
 
+    /**
+     * Number of blocks of {@link #getMaxThreadBlocks()} threads that can be
+     * resident on the device at the same time.
+     */
+    public int getResidentBlocks() {
+        if (maxBlockSize < 0) {
+            computeOccupancy();
+        }
+        return residentBlocks;
+    }
+
+    public int getRegistersPerThread() {
+        if (registersPerThread < 0) {
+            registersPerThread = cuFuncGetAttribute(moduleWrapper, kernelFunctionName, PTXFunctionAttribute.NUM_REGS.value());
+        }
+        return registersPerThread;
+    }
+
+    /**
+     * Static plus dynamic shared memory used by one block.
+     */
+    public int getSharedMemoryBytes() {
+        if (sharedMemoryBytes < 0) {
+            sharedMemoryBytes = cuFuncGetAttribute(moduleWrapper, kernelFunctionName, PTXFunctionAttribute.SHARED_SIZE_BYTES.value()) + dynamicSharedMemoryBytes;
+        }
+        return sharedMemoryBytes;
+    }
+
+    /**
+     * Bytes of spill stores reported by the JIT. Falls back to the local memory
+     * per thread, which includes the spill area, when the log has no summary.
+     */
+    public int getSpillStoreBytes() {
+        int spills = sumLogValues(SPILL_STORES);
+        if (spills < 0) {
+            return cuFuncGetAttribute(moduleWrapper, kernelFunctionName, PTXFunctionAttribute.LOCAL_SIZE_BYTES.value());
+        }
+        return spills;
+    }
+
+    public int getSpillLoadBytes() {
+        return Math.max(sumLogValues(SPILL_LOADS), 0);
+    }
+
+    private int sumLogValues(Pattern pattern) {
+        Matcher matcher = pattern.matcher(jitInfoLog);
+        int total = -1;
+        while (matcher.find()) {
+            total = Math.max(total, 0) + Integer.parseInt(matcher.group(1));
+        }
+        return total;
+    }
+
+    public int getMaxRegisters() {
+        return maxRegisters;
+    }
+
+    public String getJITInfoLog() {
+        return jitInfoLog;
+    }
+
+    public String getJITErrorLog() {
+        return jitErrorLog;
+    }
+
+    private static int parseJITTarget(String target) {
+        if (target.isEmpty()) {
+            return 0;
+        }
+        try {
+            // CUjit_target values are encoded as 10 * major + minor
+            return Integer.parseInt(target.toLowerCase().replace("sm_", "").replace("compute_", ""));
+        } catch (NumberFormatException e) {
+            throw new TornadoRuntimeException("Invalid PTX JIT target: " + target + " (expected e.g. sm_75)");
+        }
+    }
+
+    public int getDynamicSharedMemoryBytes() {
+        return dynamicSharedMemoryBytes;
+    }
+
+    /**
+     * Kernels that synchronise or share data within a block (e.g. reductions)
+     * depend on the exact grid size and cannot be launched with a smaller grid.
+     */
+    public boolean usesBlockCooperation() {
+        return blockCooperation;
+    }
+
+    private static boolean usesBlockCooperation(String ptx) {
+        return ptx.contains("bar.sync") || ptx.contains("barrier.sync") || ptx.contains(".shared");
+    }
+
     public byte[] getSource() {
         return source;
     }
@@ -31,6 +31,7 @@ import static uk.ac.manchester.tornado.runtime.common.Tornado.warn;
 import java.util.Arrays;
 
 import uk.ac.manchester.tornado.api.exceptions.TornadoBailoutRuntimeException;
+import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
 import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
 
 public class PTXScheduler {
@@ -125,4 +126,59 @@ public class PTXScheduler {
         }
         return defaultGrids;
     }
+
+    /**
+     * Kernels generated from parallel loops iterate with a stride equal to the
+     * total number of threads in the grid, so they can be launched with fewer
+     * blocks than iterations. This is not the case when the user fixes the
+     * global work size or when blocks cooperate through barriers and shared
+     * memory.
+     */
+    public boolean isGridStrideLaunchAllowed(PTXModule module) {
+        return TornadoOptions.PTX_GRID_STRIDE && module.metaData.isParallel() && !module.metaData.isGlobalWorkDefined() && !module.usesBlockCooperation();
+    }
+
+    /**
+     * Launch configuration for grid-stride kernels: blocks use the block size
+     * that maximises occupancy, and the grid is limited to the number of blocks
+     * that can be resident on the device at the same time.
+     *
+     * @return {blockDimension, gridDimension}
+     */
+    public int[][] calculateGridStrideLaunch(PTXModule module) {
+        final int dimension = module.metaData.getDims();
+        final long[] globalWork = module.metaData.getGlobalWork();
+        final int[] blockDimension;
+        if (module.metaData.isLocalWorkDefined()) {
+            blockDimension = calculateBlockDimension(module);
+        } else {
+            blockDimension = new int[] { 1, 1, 1 };
+            long maxBlockSize = calculateEffectiveMaxWorkItemSize(dimension, module.getMaxThreadBlocks());
+            for (int i = 0; i < dimension; i++) {
+                blockDimension[i] = (int) Math.max(Math.min(maxBlockSize, globalWork[i]), 1);
+            }
+        }
+
+        final int[] gridDimension = { 1, 1, 1 };
+        final long[] maxGridSizes = device.getDeviceMaxWorkGroupSize();
+        long threadsPerBlock = 1;
+        for (int i = 0; i < dimension; i++) {
+            long blocks = (globalWork[i] + blockDimension[i] - 1) / blockDimension[i];
+            gridDimension[i] = (int) Math.max(Math.min(blocks, maxGridSizes[i]), 1);
+            threadsPerBlock *= blockDimension[i];
+        }
+
+        // Resident capacity scales with the number of threads per block.
+        long residentBlocks = Math.max(((long) module.getResidentBlocks() * module.getMaxThreadBlocks()) / threadsPerBlock, 1);
+        for (int i = 0; i < dimension; i++) {
+            gridDimension[i] = (int) Math.min(gridDimension[i], residentBlocks);
+            residentBlocks = Math.max(residentBlocks / gridDimension[i], 1);
+        }
+
+        if (DEBUG) {
+            System.out.printf("[CUDA-PTX] %s: registers=%d, dynamic shared memory=%d bytes, resident blocks=%d, blocks=%s, grid=%s%n", module.javaName, module.getRegistersPerThread(),
+                    module.getDynamicSharedMemoryBytes(), module.getResidentBlocks(), Arrays.toString(blockDimension), Arrays.toString(gridDimension));
+        }
+        return new int[][] { blockDimension, gridDimension };
+    }
 }
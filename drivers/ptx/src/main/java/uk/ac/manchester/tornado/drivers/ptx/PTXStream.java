@@ -24,6 +24,8 @@
 package uk.ac.manchester.tornado.drivers.ptx;
 
 import static uk.ac.manchester.tornado.drivers.ptx.PTXEvent.DEFAULT_TAG;
+import static uk.ac.manchester.tornado.drivers.ptx.PTXEvent.DESC_COPY_BUFFER_PEER;
+import static uk.ac.manchester.tornado.drivers.ptx.PTXEvent.DESC_COPY_BUFFER_TEXTURE;
 import static uk.ac.manchester.tornado.drivers.ptx.PTXEvent.DESC_PARALLEL_KERNEL;
 import static uk.ac.manchester.tornado.drivers.ptx.PTXEvent.DESC_READ_BYTE;
 import static uk.ac.manchester.tornado.drivers.ptx.PTXEvent.DESC_READ_DOUBLE;
@@ -46,14 +48,12 @@ import java.util.Arrays;
 import uk.ac.manchester.tornado.api.common.Event;
 import uk.ac.manchester.tornado.runtime.EmptyEvent;
 import uk.ac.manchester.tornado.runtime.common.TornadoLogger;
-import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
+import uk.ac.manchester.tornado.runtime.profiler.ProfilerSampler;
 
 public class PTXStream extends TornadoLogger {
 
     protected static final Event EMPTY_EVENT = new EmptyEvent();
 
-    private static final int DYNAMIC_SHARED_MEMORY_BYTES = 0;
-
     private final byte[] streamWrapper;
     private final PTXEventsWrapper eventsWrapper;
 
@@ -138,8 +138,19 @@ public class PTXStream extends TornadoLogger {
 
     private native static byte[][] cuEventCreateAndRecord(boolean isProfilingEnabled, byte[] streamWrapper);
 
+    private native static byte[][] cuMemcpyPeerAsync(long dstDevicePtr, long srcDevicePtr, long length, byte[] streamWrapper);
+
+    private native static byte[][] cuMemcpyDtoArrayAsync(long srcDevicePtr, long dstArray, long widthInBytes, long height, byte[] streamWrapper);
+
+    /**
+     * Sets the NUMA node where the pinned staging buffers of a device are
+     * allocated, and the cores the stream callbacks of the device are pinned to
+     * (none if empty).
+     */
+    native static void setStagingNode(int deviceIndex, int numaNode, int[] callbackCpus);
+
     private int registerEvent(int descriptorId, long tag) {
-        return eventsWrapper.registerEvent(cuEventCreateAndRecord(TornadoOptions.isProfilerEnabled(), streamWrapper), descriptorId, tag);
+        return eventsWrapper.registerEvent(cuEventCreateAndRecord(ProfilerSampler.isTimed(), streamWrapper), descriptorId, tag);
     }
 
     private int registerEvent(byte[][] eventWrapper, int descriptorId, long tag) {
@@ -158,6 +169,14 @@ public class PTXStream extends TornadoLogger {
         cuDestroyStream(streamWrapper);
     }
 
+    public void retainEvent(int localEventId) {
+        eventsWrapper.retainEvent(localEventId);
+    }
+
+    public void releaseEvent(int localEventId) {
+        eventsWrapper.releaseEvent(localEventId);
+    }
+
     public Event resolveEvent(int event) {
         if (event == -1) {
             return EMPTY_EVENT;
@@ -192,10 +211,28 @@ public class PTXStream extends TornadoLogger {
             module.metaData.printThreadDims();
         }
 
-        return registerEvent(cuLaunchKernel(module.moduleWrapper, module.kernelFunctionName, gridDim[0], gridDim[1], gridDim[2], blockDim[0], blockDim[1], blockDim[2], DYNAMIC_SHARED_MEMORY_BYTES,
+        return registerEvent(cuLaunchKernel(module.moduleWrapper, module.kernelFunctionName, gridDim[0], gridDim[1], gridDim[2], blockDim[0], blockDim[1], blockDim[2], module.getDynamicSharedMemoryBytes(),
                 streamWrapper, kernelParams), DESC_PARALLEL_KERNEL, module.kernelFunctionName.hashCode());
     }
 
+    /**
+     * Copies {@code length} bytes from a buffer of another CUDA device (or of the
+     * same context) without staging the data through the host.
+     */
+    public int enqueueCopyFromPeer(long dstAddress, long srcAddress, long length, int[] waitEvents) {
+        waitForEvents(waitEvents);
+        return registerEvent(cuMemcpyPeerAsync(dstAddress, srcAddress, length, streamWrapper), DESC_COPY_BUFFER_PEER, dstAddress);
+    }
+
+    /**
+     * Copies {@code height} rows of {@code widthInBytes} bytes from a device
+     * buffer into the CUDA array behind a texture object.
+     */
+    public int enqueueCopyBufferToArray(long srcAddress, long array, long widthInBytes, long height, int[] waitEvents) {
+        waitForEvents(waitEvents);
+        return registerEvent(cuMemcpyDtoArrayAsync(srcAddress, array, widthInBytes, height, streamWrapper), DESC_COPY_BUFFER_TEXTURE, array);
+    }
+
     public int enqueueBarrier() {
         cuStreamSynchronize(streamWrapper);
         return registerEvent(DESC_SYNC_BARRIER, DEFAULT_TAG);
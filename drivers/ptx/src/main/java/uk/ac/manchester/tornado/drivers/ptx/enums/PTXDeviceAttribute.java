@@ -42,6 +42,9 @@ public enum PTXDeviceAttribute {
     MAX_REGISTERS_PER_BLOCK(12), //
     CLOCK_RATE(13), //
     MULTIPROCESSOR_COUNT(16), //
+    PCI_BUS_ID(33), //
+    PCI_DEVICE_ID(34), //
+    PCI_DOMAIN_ID(50), //
     COMPUTE_CAPABILITY_MAJOR(75), //
     COMPUTE_CAPABILITY_MINOR(76); //
 
@@ -0,0 +1,47 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+package uk.ac.manchester.tornado.drivers.ptx.enums;
+
+/**
+ * Contains a subset of the kernel function properties that can be queried. See
+ * @link{ https://docs.nvidia.com/cuda/cuda-driver-api/group__CUDA__TYPES.html }
+ * for the full list.
+ */
+public enum PTXFunctionAttribute {
+
+    MAX_THREADS_PER_BLOCK(0), //
+    SHARED_SIZE_BYTES(1), //
+    CONST_SIZE_BYTES(2), //
+    LOCAL_SIZE_BYTES(3), //
+    NUM_REGS(4); //
+
+    private final int value;
+
+    PTXFunctionAttribute(int value) {
+        this.value = value;
+    }
+
+    public int value() {
+        return value;
+    }
+}
@@ -49,6 +49,10 @@ public class PTXArchitecture extends Architecture {
     public static final PTXMemoryBase paramSpace = new PTXMemoryBase(PTXMemorySpace.PARAM);
     public static final PTXMemoryBase sharedSpace = new PTXMemoryBase(PTXMemorySpace.SHARED);
     public static final PTXMemoryBase localSpace = new PTXMemoryBase(PTXMemorySpace.LOCAL);
+    /**
+     * Global memory read through the non-coherent (read-only) data cache.
+     */
+    public static final PTXMemoryBase readOnlySpace = new PTXMemoryBase(PTXMemorySpace.GLOBAL_NC);
 
     public static PTXParam STACK_POINTER;
     public static PTXParam[] abiRegisters;
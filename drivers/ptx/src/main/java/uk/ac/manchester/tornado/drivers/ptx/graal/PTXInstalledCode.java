@@ -23,22 +23,47 @@ package uk.ac.manchester.tornado.drivers.ptx.graal;
 
 import static uk.ac.manchester.tornado.api.exceptions.TornadoInternalError.unimplemented;
 
+import java.util.ArrayDeque;
+import java.util.Arrays;
+import java.util.Deque;
+
 import jdk.vm.ci.code.InstalledCode;
+import uk.ac.manchester.tornado.api.enums.TornadoExecutionStatus;
 import uk.ac.manchester.tornado.api.mm.ObjectBuffer;
 import uk.ac.manchester.tornado.drivers.ptx.PTXDeviceContext;
+import uk.ac.manchester.tornado.drivers.ptx.PTXEvent;
 import uk.ac.manchester.tornado.drivers.ptx.PTXModule;
 import uk.ac.manchester.tornado.runtime.common.CallStack;
+import uk.ac.manchester.tornado.runtime.common.TieredCompilation;
 import uk.ac.manchester.tornado.runtime.common.TornadoInstalledCode;
 import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
 
 public class PTXInstalledCode extends InstalledCode implements TornadoInstalledCode {
+
+    // Launches per JIT variant that are not timed (module loading, caches)
+    private static final int WARMUP_LAUNCHES = 1;
+    // Launches per JIT variant whose kernel time is compared
+    private static final int TIMED_LAUNCHES = 3;
+
     private PTXModule module;
     private PTXDeviceContext deviceContext;
 
+    // JIT variants timed on the first launches; the fastest one is kept
+    private PTXModule[] variants;
+    private VariantSelection selection;
+
+    private TieredCompilation<PTXInstalledCode> tieredCompilation;
+
     public PTXInstalledCode(String name, PTXModule module, PTXDeviceContext deviceContext) {
+        this(name, new PTXModule[] { module }, deviceContext);
+    }
+
+    public PTXInstalledCode(String name, PTXModule[] variants, PTXDeviceContext deviceContext) {
         super(name);
-        this.module = module;
+        this.module = variants[0];
         this.deviceContext = deviceContext;
+        this.variants = variants;
+        this.selection = (variants.length > 1) ? new VariantSelection(variants.length) : null;
     }
 
     @Override
@@ -49,10 +74,149 @@ public class PTXInstalledCode extends InstalledCode implements TornadoInstalledC
 
     @Override
     public int launchWithoutDependencies(CallStack stack, ObjectBuffer atomicSpace, TaskMetaData meta, long batchThreads) {
+        tierUp();
+        if (selection != null) {
+            return launchVariant(stack, batchThreads);
+        }
         return deviceContext.enqueueKernelLaunch(module, stack, batchThreads);
     }
 
+    /**
+     * Attaches the recompilation of a kernel built by the quick tier.
+     */
+    public void setTieredCompilation(TieredCompilation<PTXInstalledCode> tieredCompilation) {
+        this.tieredCompilation = tieredCompilation;
+    }
+
+    /**
+     * Swaps in the optimised module, and its register variants, once the
+     * background recompilation has finished. The optimised modules carry the
+     * copy of the meta data they were compiled against, so the launches use it
+     * from the swap on.
+     */
+    private void tierUp() {
+        if (tieredCompilation == null) {
+            return;
+        }
+        final PTXInstalledCode optimised = tieredCompilation.onLaunch();
+        if (optimised != null) {
+            releasePendingLaunches();
+            module = optimised.module;
+            variants = optimised.variants;
+            selection = optimised.selection;
+            tieredCompilation = null;
+        }
+    }
+
+    /**
+     * Launches the variants round-robin: {@link #WARMUP_LAUNCHES} untimed
+     * launches each, then {@link #TIMED_LAUNCHES} timed ones. Kernel events are
+     * not waited on; their times are collected once the stream has completed
+     * them, and the first variant is used until every sample is in.
+     */
+    private int launchVariant(CallStack stack, long batchThreads) {
+        collectVariantTimes();
+        if (selection == null) {
+            return deviceContext.enqueueKernelLaunch(module, stack, batchThreads);
+        }
+
+        final int totalLaunches = variants.length * (WARMUP_LAUNCHES + TIMED_LAUNCHES);
+        if (selection.issued == totalLaunches) {
+            return deviceContext.enqueueKernelLaunch(module, stack, batchThreads);
+        }
+
+        final int index = selection.issued % variants.length;
+        final boolean timed = (selection.issued / variants.length) >= WARMUP_LAUNCHES;
+        selection.issued++;
+        final int kernelEvent = deviceContext.enqueueKernelLaunch(variants[index], stack, batchThreads);
+        if (timed) {
+            deviceContext.retainEvent(kernelEvent);
+            selection.pending.add(new TimedLaunch(kernelEvent, (PTXEvent) deviceContext.resolveEvent(kernelEvent), index));
+        }
+        return kernelEvent;
+    }
+
+    private void collectVariantTimes() {
+        while (!selection.pending.isEmpty()) {
+            final TimedLaunch launch = selection.pending.peek();
+            if (!launch.event.isDestroyed()) {
+                if (launch.event.getStatus() != TornadoExecutionStatus.COMPLETE) {
+                    // Launches complete in stream order
+                    return;
+                }
+                selection.record(launch.variant, launch.event.getExecutionTime());
+                deviceContext.releaseEvent(launch.eventId);
+            }
+            selection.pending.poll();
+        }
+
+        if (selection.issued == variants.length * (WARMUP_LAUNCHES + TIMED_LAUNCHES)) {
+            final int fastest = selection.fastest();
+            module = variants[fastest];
+            if (module.metaData.isDebug()) {
+                System.out.printf("[CUDA-PTX] %s: selected register cap %d (%d ns)%n", module.kernelFunctionName, module.getMaxRegisters(), selection.times[fastest]);
+            }
+            selection = null;
+        }
+    }
+
+    private void releasePendingLaunches() {
+        if (selection == null) {
+            return;
+        }
+        for (TimedLaunch launch : selection.pending) {
+            if (!launch.event.isDestroyed()) {
+                deviceContext.releaseEvent(launch.eventId);
+            }
+        }
+        selection.pending.clear();
+    }
+
     public String getGeneratedSourceCode() {
         return new String(module.getSource());
     }
+
+    private static final class TimedLaunch {
+        private final int eventId;
+        private final PTXEvent event;
+        private final int variant;
+
+        private TimedLaunch(int eventId, PTXEvent event, int variant) {
+            this.eventId = eventId;
+            this.event = event;
+            this.variant = variant;
+        }
+    }
+
+    /**
+     * Timing state of the register variants. A variant is scored by its fastest
+     * warm launch.
+     */
+    private static final class VariantSelection {
+        private final long[] times;
+        private final Deque<TimedLaunch> pending;
+        private int issued;
+
+        private VariantSelection(int numVariants) {
+            this.times = new long[numVariants];
+            this.pending = new ArrayDeque<>();
+            Arrays.fill(times, Long.MAX_VALUE);
+        }
+
+        private void record(int variant, long time) {
+            if (time > 0) {
+                times[variant] = Math.min(times[variant], time);
+            }
+        }
+
+        private int fastest() {
+            int fastest = 0;
+            for (int i = 1; i < times.length; i++) {
+                if (times[i] < times[fastest]) {
+                    fastest = i;
+                }
+            }
+            return fastest;
+        }
+    }
 }
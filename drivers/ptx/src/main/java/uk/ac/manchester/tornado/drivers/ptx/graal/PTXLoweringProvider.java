@@ -78,17 +78,21 @@ import org.graalvm.compiler.options.OptionValues;
 import org.graalvm.compiler.phases.util.Providers;
 import org.graalvm.compiler.replacements.DefaultJavaLoweringProvider;
 import org.graalvm.compiler.replacements.SnippetCounter;
+import uk.ac.manchester.tornado.drivers.ptx.graal.lir.PTXAtomicIndexedWriteNode;
 import uk.ac.manchester.tornado.drivers.ptx.graal.lir.PTXKind;
 import uk.ac.manchester.tornado.drivers.ptx.graal.lir.PTXWriteNode;
 import uk.ac.manchester.tornado.drivers.ptx.graal.nodes.CastNode;
 import uk.ac.manchester.tornado.drivers.ptx.graal.nodes.FixedArrayNode;
 import uk.ac.manchester.tornado.drivers.ptx.graal.nodes.GlobalThreadIdNode;
 import uk.ac.manchester.tornado.drivers.ptx.graal.nodes.LocalArrayNode;
+import uk.ac.manchester.tornado.drivers.ptx.graal.nodes.PTXReadImageNode;
 import uk.ac.manchester.tornado.drivers.ptx.graal.nodes.calc.DivNode;
 import uk.ac.manchester.tornado.drivers.ptx.graal.nodes.vector.LoadIndexedVectorNode;
 import uk.ac.manchester.tornado.drivers.ptx.graal.phases.TornadoFloatingReadReplacement;
 import uk.ac.manchester.tornado.drivers.ptx.graal.snippets.PTXGPUReduceSnippets;
 import uk.ac.manchester.tornado.runtime.TornadoVMConfig;
+import uk.ac.manchester.tornado.runtime.graal.nodes.AtomicIndexedNode;
+import uk.ac.manchester.tornado.runtime.graal.nodes.ImageReadNode;
 import uk.ac.manchester.tornado.runtime.graal.nodes.NewArrayNonVirtualizableNode;
 import uk.ac.manchester.tornado.runtime.graal.nodes.StoreAtomicIndexedNode;
 import uk.ac.manchester.tornado.runtime.graal.nodes.TornadoDirectCallTargetNode;
@@ -195,6 +199,8 @@ public class PTXLoweringProvider extends DefaultJavaLoweringProvider {
             lowerLoadIndexedNode((LoadIndexedNode) node, tool);
         } else if (node instanceof StoreIndexedNode) {
             lowerStoreIndexedNode((StoreIndexedNode) node, tool);
+        } else if (node instanceof AtomicIndexedNode) {
+            lowerAtomicIndexedNode((AtomicIndexedNode) node);
         } else if (node instanceof StoreAtomicIndexedNode) {
             lowerStoreAtomicsReduction(node, tool);
         } else if (node instanceof LoadFieldNode) {
@@ -205,6 +211,8 @@ public class PTXLoweringProvider extends DefaultJavaLoweringProvider {
             lowerArrayLengthNode((ArrayLengthNode) node, tool);
         } else if (node instanceof IntegerDivRemNode) {
             lowerIntegerDivRemNode((IntegerDivRemNode) node);
+        } else if (node instanceof ImageReadNode) {
+            lowerImageReadNode((ImageReadNode) node);
         } else if (node instanceof InstanceOfNode) {
             // ignore InstanceOfNode nodes
         } else {
@@ -319,6 +327,22 @@ public class PTXLoweringProvider extends DefaultJavaLoweringProvider {
         unimplemented();
     }
 
+    private void lowerAtomicIndexedNode(AtomicIndexedNode atomicIndexed) {
+        StructuredGraph graph = atomicIndexed.graph();
+        JavaKind elementKind = atomicIndexed.elementKind();
+        AddressNode address = createArrayAddress(graph, atomicIndexed.array(), elementKind, atomicIndexed.index());
+        PTXAtomicIndexedWriteNode atomicWrite = graph.add(new PTXAtomicIndexedWriteNode(address, NamedLocationIdentity.getArrayLocation(elementKind), atomicIndexed.value(),
+                OnHeapMemoryAccess.BarrierType.NONE, elementKind, atomicIndexed.getOperation()));
+        atomicWrite.setStateAfter(atomicIndexed.stateAfter());
+        graph.replaceFixedWithFixed(atomicIndexed, atomicWrite);
+    }
+
+    private void lowerImageReadNode(ImageReadNode imageRead) {
+        StructuredGraph graph = imageRead.graph();
+        PTXReadImageNode readImage = graph.addOrUnique(new PTXReadImageNode(imageRead));
+        graph.replaceFixedWithFloating(imageRead, readImage);
+    }
+
     private void lowerIntegerDivRemNode(IntegerDivRemNode integerDivRemNode) {
         StructuredGraph graph = integerDivRemNode.graph();
         switch (integerDivRemNode.getOp()) {
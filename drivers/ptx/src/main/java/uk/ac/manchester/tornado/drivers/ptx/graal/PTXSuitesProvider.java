@@ -23,6 +23,10 @@
  */
 package uk.ac.manchester.tornado.drivers.ptx.graal;
 
+import static org.graalvm.compiler.core.common.GraalOptions.ConditionalElimination;
+import static org.graalvm.compiler.core.common.GraalOptions.FullUnroll;
+import static org.graalvm.compiler.core.common.GraalOptions.ReassociateInvariants;
+
 import org.graalvm.compiler.java.GraphBuilderPhase;
 import org.graalvm.compiler.nodes.graphbuilderconf.GraphBuilderConfiguration;
 import org.graalvm.compiler.options.OptionValues;
@@ -33,6 +37,7 @@ import org.graalvm.compiler.phases.tiers.HighTierContext;
 import jdk.vm.ci.meta.MetaAccessProvider;
 import uk.ac.manchester.tornado.drivers.ptx.PTXDeviceContext;
 import uk.ac.manchester.tornado.drivers.ptx.graal.compiler.PTXCompilerConfiguration;
+import uk.ac.manchester.tornado.runtime.common.TieredCompilation;
 import uk.ac.manchester.tornado.runtime.graal.TornadoLIRSuites;
 import uk.ac.manchester.tornado.runtime.graal.TornadoSuites;
 import uk.ac.manchester.tornado.runtime.graal.compiler.TornadoSketchTier;
@@ -41,15 +46,25 @@ import uk.ac.manchester.tornado.runtime.graal.compiler.TornadoSuitesProvider;
 public class PTXSuitesProvider implements TornadoSuitesProvider {
     private final PhaseSuite<HighTierContext> graphBuilderSuite;
     private final TornadoSuites suites;
+    private final TornadoSuites quickSuites;
     private final TornadoLIRSuites lirSuites;
 
     public PTXSuitesProvider(OptionValues options, PTXDeviceContext deviceContext, GraphBuilderConfiguration.Plugins plugins, MetaAccessProvider metaAccessProvider,
             PTXCompilerConfiguration compilerConfig, AddressLoweringPhase.AddressLowering addressLowering) {
         graphBuilderSuite = createGraphBuilderSuite(plugins);
         suites = new TornadoSuites(options, deviceContext, compilerConfig, metaAccessProvider, null, addressLowering);
+        quickSuites = TieredCompilation.isEnabled() ? new TornadoSuites(createQuickTierOptions(options), deviceContext, compilerConfig, metaAccessProvider, null, addressLowering) : suites;
         lirSuites = createLIRSuites();
     }
 
+    /**
+     * The quick tier leaves out the Graal optimisations that do not change the
+     * shape of the generated kernel. The Tornado phases run in both tiers.
+     */
+    private static OptionValues createQuickTierOptions(OptionValues options) {
+        return new OptionValues(options, ConditionalElimination, false, FullUnroll, false, ReassociateInvariants, false);
+    }
+
     private PhaseSuite<HighTierContext> createGraphBuilderSuite(GraphBuilderConfiguration.Plugins plugins) {
         PhaseSuite<HighTierContext> suite = new PhaseSuite<>();
 
@@ -70,6 +85,13 @@ public class PTXSuitesProvider implements TornadoSuitesProvider {
         return suites;
     }
 
+    /**
+     * Suites of the first tier of tiered compilation.
+     */
+    public TornadoSuites createQuickSuites() {
+        return quickSuites;
+    }
+
     @Override
     public PhaseSuite<HighTierContext> getGraphBuilderSuite() {
         return graphBuilderSuite;
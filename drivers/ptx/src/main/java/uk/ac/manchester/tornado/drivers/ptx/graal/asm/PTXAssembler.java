@@ -478,6 +478,13 @@ public class PTXAssembler extends Assembler {
         public static final PTXUnaryIntrinsic LOG2 = new PTXUnaryIntrinsic("lg2.approx", null);
         public static final PTXUnaryIntrinsic SIN = new PTXUnaryIntrinsic("sin.approx", null);
         public static final PTXUnaryIntrinsic COS = new PTXUnaryIntrinsic("cos.approx", null);
+
+        public static final PTXUnaryIntrinsic EXP2_APPROX_FTZ = new PTXUnaryIntrinsic("ex2.approx.ftz", null);
+        public static final PTXUnaryIntrinsic LOG2_APPROX_FTZ = new PTXUnaryIntrinsic("lg2.approx.ftz", null);
+        public static final PTXUnaryIntrinsic SIN_APPROX_FTZ = new PTXUnaryIntrinsic("sin.approx.ftz", null);
+        public static final PTXUnaryIntrinsic COS_APPROX_FTZ = new PTXUnaryIntrinsic("cos.approx.ftz", null);
+        public static final PTXUnaryIntrinsic SQRT_APPROX_FTZ = new PTXUnaryIntrinsic("sqrt.approx.ftz", null);
+        public static final PTXUnaryIntrinsic RSQRT_APPROX_FTZ = new PTXUnaryIntrinsic("rsqrt.approx.ftz", null);
         public static final PTXUnaryIntrinsic FLOAT_FLOOR = new PTXUnaryIntrinsic(CONVERT, ROUND_NEGATIVE_INFINITY_INTEGER, true, false);
 
         public static final PTXUnaryIntrinsic LOCAL_MEMORY = new PTXUnaryIntrinsic("__local");
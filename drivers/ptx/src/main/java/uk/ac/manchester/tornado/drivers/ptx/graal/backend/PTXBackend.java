@@ -78,6 +78,7 @@ import uk.ac.manchester.tornado.drivers.ptx.graal.compiler.PTXNodeLIRBuilder;
 import uk.ac.manchester.tornado.drivers.ptx.graal.compiler.PTXNodeMatchRules;
 import uk.ac.manchester.tornado.drivers.ptx.graal.lir.PTXKind;
 import uk.ac.manchester.tornado.drivers.ptx.graal.lir.PTXVectorSplit;
+import uk.ac.manchester.tornado.runtime.common.ImageFormat;
 import uk.ac.manchester.tornado.runtime.common.Tornado;
 import uk.ac.manchester.tornado.runtime.graal.backend.TornadoBackend;
 import uk.ac.manchester.tornado.runtime.graal.compiler.TornadoSuitesProvider;
@@ -220,7 +221,7 @@ public class PTXBackend extends TornadoBackend<PTXProviders> implements FrameMap
     private void emitPrologue(PTXCompilationResultBuilder crb, PTXAssembler asm, PTXLIRGenerationResult lirGenRes, ResolvedJavaMethod method) {
         emitPrintfPrototype(crb);
         if (crb.isKernel()) {
-            emitKernelFunction(asm, crb.compilationResult.getName());
+            emitKernelFunction(asm, crb.compilationResult.getName(), method);
             emitParamVariableDefs(asm, lirGenRes);
             emitVariableDefs(asm, lirGenRes);
         } else {
@@ -287,8 +288,13 @@ public class PTXBackend extends TornadoBackend<PTXProviders> implements FrameMap
         }
     }
 
-    private void emitKernelFunction(PTXAssembler asm, String methodName) {
-        asm.emitLine("%s %s %s(%s) {", PTXAssemblerConstants.EXTERNALLY_VISIBLE, PTXAssemblerConstants.KERNEL_ENTRYPOINT, methodName, architecture.getABI());
+    private void emitKernelFunction(PTXAssembler asm, String methodName, ResolvedJavaMethod method) {
+        // One texture object follows the stack pointer for each image parameter
+        final StringBuilder textureParams = new StringBuilder();
+        for (int index : ImageFormat.getImageParameterIndexes(method)) {
+            textureParams.append(String.format(", .param .u64 %s%d", PTXAssemblerConstants.TEXTURE_PARAM_PREFIX, index));
+        }
+        asm.emitLine("%s %s %s(%s%s) {", PTXAssemblerConstants.EXTERNALLY_VISIBLE, PTXAssemblerConstants.KERNEL_ENTRYPOINT, methodName, architecture.getABI(), textureParams);
     }
 
     private void emitParamVariableDefs(PTXAssembler asm, PTXLIRGenerationResult lirGenRes) {
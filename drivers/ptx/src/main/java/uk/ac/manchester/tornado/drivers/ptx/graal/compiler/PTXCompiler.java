@@ -57,6 +57,7 @@ import uk.ac.manchester.tornado.drivers.ptx.graal.PTXProviders;
 import uk.ac.manchester.tornado.drivers.ptx.graal.PTXSuitesProvider;
 import uk.ac.manchester.tornado.drivers.ptx.graal.backend.PTXBackend;
 import uk.ac.manchester.tornado.drivers.ptx.graal.nodes.PrintfNode;
+import uk.ac.manchester.tornado.drivers.ptx.graal.phases.PTXConstantParameterPlacement;
 import uk.ac.manchester.tornado.runtime.TornadoCoreRuntime;
 import uk.ac.manchester.tornado.runtime.common.Tornado;
 import uk.ac.manchester.tornado.runtime.graal.TornadoLIRSuites;
@@ -398,6 +399,14 @@ public class PTXCompiler {
             final LowTierContext lowTierContext = new LowTierContext(r.providers, r.backend);
             r.suites.getLowTier().apply(r.graph, lowTierContext);
 
+            /*
+             * The placement needs the task metadata, which the low tier context does not
+             * carry, so it runs on the final graph with the mid tier context.
+             */
+            if (r.isKernel) {
+                new PTXConstantParameterPlacement().apply(r.graph, midTierContext);
+            }
+
             getDebugContext().dump(DebugContext.BASIC_LEVEL, r.graph.getLastSchedule(), "Final HIR schedule");
         } catch (Throwable e) {
             throw getDebugContext().handle(e);
@@ -409,6 +418,14 @@ public class PTXCompiler {
     }
 
     public static PTXCompilationResult compileSketchForDevice(Sketch sketch, CompilableTask task, PTXProviders providers, PTXBackend backend) {
+        return compileSketchForDevice(sketch, task, providers, backend, false);
+    }
+
+    /**
+     * Compiles a task from its sketch. The quick tier of tiered compilation
+     * leaves out the Graal optimisations to install a first kernel sooner.
+     */
+    public static PTXCompilationResult compileSketchForDevice(Sketch sketch, CompilableTask task, PTXProviders providers, PTXBackend backend, boolean quickTier) {
         final StructuredGraph kernelGraph = (StructuredGraph) sketch.getGraph().getReadonlyCopy().copy(getDebugContext());
         ResolvedJavaMethod resolvedMethod = kernelGraph.method();
 
@@ -428,9 +445,10 @@ public class PTXCompiler {
         boolean includePrintf = kernelGraph.hasNode(PrintfNode.TYPE);
 
         final PTXSuitesProvider suitesProvider = (PTXSuitesProvider) providers.getSuitesProvider();
+        final TornadoSuites suites = quickTier ? suitesProvider.createQuickSuites() : suitesProvider.createSuites();
         PTXCompilationRequest kernelCompilationRequest = PTXCompilationRequest.PTXCompilationRequestBuilder.getInstance().withGraph(kernelGraph).withCodeOwner(resolvedMethod).withArgs(args)
                 .withMetaData(taskMeta).withProviders(providers).withBackend(backend).withGraphBuilderSuite(suitesProvider.getGraphBuilderSuite()).withOptimizations(optimisticOpts)
-                .withProfilingInfo(profilingInfo).withSuites(suitesProvider.createSuites()).withLIRSuites(suitesProvider.getLIRSuites()).withResult(kernelCompResult).withResultBuilderFactory(factory)
+                .withProfilingInfo(profilingInfo).withSuites(suites).withLIRSuites(suitesProvider.getLIRSuites()).withResult(kernelCompResult).withResultBuilderFactory(factory)
                 .isKernel(true).buildGraph(true).includePrintf(includePrintf).withBatchThreads(batchThreads).build();
 
         kernelCompilationRequest.execute();
@@ -451,7 +469,7 @@ public class PTXCompiler {
 
             PTXCompilationRequest methodCompilationRequest = PTXCompilationRequest.PTXCompilationRequestBuilder.getInstance().withGraph(graph).withCodeOwner(currentMethod).withProviders(providers)
                     .withBackend(backend).withGraphBuilderSuite(suitesProvider.getGraphBuilderSuite()).withOptimizations(optimisticOpts).withProfilingInfo(profilingInfo)
-                    .withSuites(suitesProvider.createSuites()).withLIRSuites(suitesProvider.getLIRSuites()).withResult(compResult).withResultBuilderFactory(factory).isKernel(false).buildGraph(false)
+                    .withSuites(suites).withLIRSuites(suitesProvider.getLIRSuites()).withResult(compResult).withResultBuilderFactory(factory).isKernel(false).buildGraph(false)
                     .includePrintf(false).withBatchThreads(0).build();
 
             methodCompilationRequest.execute();
@@ -25,6 +25,7 @@
 package uk.ac.manchester.tornado.drivers.ptx.graal.compiler;
 
 import static org.graalvm.compiler.core.common.GraalOptions.ConditionalElimination;
+import static org.graalvm.compiler.core.common.GraalOptions.FullUnroll;
 import static org.graalvm.compiler.core.common.GraalOptions.ImmutableCode;
 import static org.graalvm.compiler.core.common.GraalOptions.OptConvertDeoptsToGuards;
 import static org.graalvm.compiler.core.common.GraalOptions.PartialEscapeAnalysis;
@@ -54,7 +55,9 @@ import uk.ac.manchester.tornado.drivers.ptx.graal.phases.TornadoTaskSpecialisati
 import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
 import uk.ac.manchester.tornado.runtime.graal.compiler.TornadoHighTier;
 import uk.ac.manchester.tornado.runtime.graal.phases.ExceptionSuppression;
+import uk.ac.manchester.tornado.runtime.graal.phases.TornadoCoalescingAnalysis;
 import uk.ac.manchester.tornado.runtime.graal.phases.TornadoFullInliningPolicy;
+import uk.ac.manchester.tornado.runtime.graal.phases.TornadoImageReadSelection;
 import uk.ac.manchester.tornado.runtime.graal.phases.TornadoInliningPolicy;
 import uk.ac.manchester.tornado.runtime.graal.phases.TornadoLocalMemoryAllocation;
 import uk.ac.manchester.tornado.runtime.graal.phases.TornadoPartialInliningPolicy;
@@ -93,6 +96,9 @@ public class PTXHighTier extends TornadoHighTier {
         appendPhase(canonicalizer);
         appendPhase(new DeadCodeEliminationPhase(Optional));
 
+        // Needs the inlined graph to see every write to an image
+        appendPhase(new TornadoImageReadSelection());
+
         appendPhase(canonicalizer);
 
         appendPhase(new TornadoNewArrayDevirtualizationReplacement());
@@ -106,13 +112,16 @@ public class PTXHighTier extends TornadoHighTier {
             appendPhase(new ConvertDeoptimizeToGuardPhase());
         }
 
+        appendPhase(new TornadoCoalescingAnalysis());
         appendPhase(new TornadoShapeAnalysis());
         appendPhase(canonicalizer);
         appendPhase(new TornadoParallelScheduler());
         appendPhase(new SchedulePhase(SchedulePhase.SchedulingStrategy.EARLIEST));
 
-        LoopPolicies loopPolicies = new DefaultLoopPolicies();
-        appendPhase(new LoopFullUnrollPhase(canonicalizer, loopPolicies));
+        if (FullUnroll.getValue(options)) {
+            LoopPolicies loopPolicies = new DefaultLoopPolicies();
+            appendPhase(new LoopFullUnrollPhase(canonicalizer, loopPolicies));
+        }
 
         appendPhase(canonicalizer);
         appendPhase(new RemoveValueProxyPhase());
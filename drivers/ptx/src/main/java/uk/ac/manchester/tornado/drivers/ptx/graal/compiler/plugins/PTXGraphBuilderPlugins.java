@@ -52,12 +52,15 @@ import org.graalvm.compiler.nodes.util.GraphUtil;
 import jdk.vm.ci.meta.JavaConstant;
 import jdk.vm.ci.meta.JavaKind;
 import jdk.vm.ci.meta.ResolvedJavaMethod;
+import uk.ac.manchester.tornado.api.atomics.TornadoAtomics;
 import uk.ac.manchester.tornado.api.exceptions.Debug;
 import uk.ac.manchester.tornado.drivers.ptx.graal.nodes.PTXFPBinaryIntrinsicNode;
 import uk.ac.manchester.tornado.drivers.ptx.graal.nodes.PTXFPUnaryIntrinsicNode;
 import uk.ac.manchester.tornado.drivers.ptx.graal.nodes.PTXIntBinaryIntrinsicNode;
 import uk.ac.manchester.tornado.drivers.ptx.graal.nodes.PTXIntUnaryIntrinsicNode;
 import uk.ac.manchester.tornado.drivers.ptx.graal.nodes.PrintfNode;
+import uk.ac.manchester.tornado.runtime.graal.nodes.AtomicIndexedNode;
+import uk.ac.manchester.tornado.runtime.graal.nodes.AtomicIndexedNode.AtomicOperation;
 
 public class PTXGraphBuilderPlugins {
 
@@ -66,6 +69,34 @@ public class PTXGraphBuilderPlugins {
         registerPTXBuiltinPlugins(plugins);
         PTXMathPlugins.registerTornadoMathPlugins(plugins);
         PTXVectorPlugins.registerPlugins(ps, plugins);
+        PTXImagePlugins.registerPlugins(plugins);
+        registerTornadoAtomicsPlugins(plugins);
+    }
+
+    private static void registerTornadoAtomicsPlugins(InvocationPlugins plugins) {
+        Registration r = new Registration(plugins, TornadoAtomics.class);
+
+        registerAtomicIndexed(r, "atomicAdd", int[].class, int.class, JavaKind.Int, AtomicOperation.ADD);
+        registerAtomicIndexed(r, "atomicAdd", long[].class, long.class, JavaKind.Long, AtomicOperation.ADD);
+        registerAtomicIndexed(r, "atomicAdd", float[].class, float.class, JavaKind.Float, AtomicOperation.ADD);
+
+        registerAtomicIndexed(r, "atomicMin", int[].class, int.class, JavaKind.Int, AtomicOperation.MIN);
+        registerAtomicIndexed(r, "atomicMin", long[].class, long.class, JavaKind.Long, AtomicOperation.MIN);
+        registerAtomicIndexed(r, "atomicMin", float[].class, float.class, JavaKind.Float, AtomicOperation.MIN);
+
+        registerAtomicIndexed(r, "atomicMax", int[].class, int.class, JavaKind.Int, AtomicOperation.MAX);
+        registerAtomicIndexed(r, "atomicMax", long[].class, long.class, JavaKind.Long, AtomicOperation.MAX);
+        registerAtomicIndexed(r, "atomicMax", float[].class, float.class, JavaKind.Float, AtomicOperation.MAX);
+    }
+
+    private static void registerAtomicIndexed(Registration r, String methodName, Class<?> arrayType, Class<?> valueType, JavaKind elementKind, AtomicOperation operation) {
+        r.register3(methodName, arrayType, int.class, valueType, new InvocationPlugin() {
+            @Override
+            public boolean apply(GraphBuilderContext b, ResolvedJavaMethod targetMethod, Receiver receiver, ValueNode array, ValueNode index, ValueNode value) {
+                b.append(new AtomicIndexedNode(array, index, elementKind, value, operation));
+                return true;
+            }
+        });
     }
 
     private static void registerTornadoInstrinsicsPlugins(InvocationPlugins plugins) {
@@ -85,6 +85,14 @@ public class PTXAddressNode extends AddressNode implements LIRLowerable {
         return memoryRegister.memorySpace.index() == PTXMemorySpace.SHARED.index();
     }
 
+    public PTXMemoryBase getMemoryRegister() {
+        return memoryRegister;
+    }
+
+    public void setMemoryRegister(PTXMemoryBase memoryRegister) {
+        this.memoryRegister = memoryRegister;
+    }
+
     @Override
     public ValueNode getBase() {
         return base;
@@ -0,0 +1,99 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.drivers.ptx.graal.lir;
+
+import static uk.ac.manchester.tornado.api.exceptions.TornadoInternalError.guarantee;
+
+import jdk.vm.ci.meta.JavaKind;
+import jdk.vm.ci.meta.Value;
+import org.graalvm.compiler.core.common.type.Stamp;
+import org.graalvm.compiler.graph.NodeClass;
+import org.graalvm.compiler.nodeinfo.NodeInfo;
+import org.graalvm.compiler.nodes.NodeView;
+import org.graalvm.compiler.nodes.ValueNode;
+import org.graalvm.compiler.nodes.memory.AbstractWriteNode;
+import org.graalvm.compiler.nodes.memory.LIRLowerableAccess;
+import org.graalvm.compiler.nodes.memory.address.AddressNode;
+import org.graalvm.compiler.nodes.spi.NodeLIRBuilderTool;
+import org.graalvm.word.LocationIdentity;
+import uk.ac.manchester.tornado.runtime.graal.nodes.AtomicIndexedNode.AtomicOperation;
+
+/**
+ * Atomically combines a {@linkplain #value() value} with the array element at
+ * the given {@linkplain AddressNode address} using a PTX reduction
+ * instruction, or a compare-and-swap loop for float min/max.
+ */
+@NodeInfo(nameTemplate = "PTXAtomicIndexedWrite#{p#location/s}")
+public class PTXAtomicIndexedWriteNode extends AbstractWriteNode implements LIRLowerableAccess {
+
+    public static final NodeClass<PTXAtomicIndexedWriteNode> TYPE = NodeClass.create(PTXAtomicIndexedWriteNode.class);
+
+    private final JavaKind elementKind;
+    private final AtomicOperation operation;
+
+    public PTXAtomicIndexedWriteNode(AddressNode address, LocationIdentity location, ValueNode value, BarrierType barrierType, JavaKind elementKind, AtomicOperation operation) {
+        super(TYPE, address, location, value, barrierType);
+        this.elementKind = elementKind;
+        this.operation = operation;
+    }
+
+    @Override
+    public Stamp getAccessStamp(NodeView view) {
+        return value().stamp(view);
+    }
+
+    /**
+     * PTX has no signed 64-bit atomic add, but two's complement addition is
+     * the same for both signed and unsigned operands.
+     */
+    private PTXKind resolveKind() {
+        switch (elementKind) {
+            case Int:
+                return PTXKind.S32;
+            case Long:
+                return operation == AtomicOperation.ADD ? PTXKind.U64 : PTXKind.S64;
+            case Float:
+                return PTXKind.F32;
+            default:
+                throw new RuntimeException("Data type for atomics not supported yet: " + elementKind);
+        }
+    }
+
+    @Override
+    public void generate(NodeLIRBuilderTool gen) {
+        Value address = gen.operand(getAddress());
+        guarantee(address instanceof PTXUnary.MemoryAccess, "atomic operations require a memory access: %s", address);
+        gen.getLIRGeneratorTool().append(new PTXLIRStmt.AtomicIndexedStmt((PTXUnary.MemoryAccess) address, gen.operand(value()), operation, resolveKind()));
+    }
+
+    @Override
+    public boolean canNullCheck() {
+        return false;
+    }
+
+    @Override
+    public LocationIdentity getKilledLocationIdentity() {
+        return getLocationIdentity();
+    }
+}
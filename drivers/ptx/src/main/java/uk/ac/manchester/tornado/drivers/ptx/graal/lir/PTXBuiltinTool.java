@@ -32,12 +32,18 @@ import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXBin
 import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXBinaryIntrinsic.INT_MIN;
 import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXUnaryIntrinsic.ABS;
 import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXUnaryIntrinsic.COS;
+import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXUnaryIntrinsic.COS_APPROX_FTZ;
 import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXUnaryIntrinsic.EXP2;
+import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXUnaryIntrinsic.EXP2_APPROX_FTZ;
 import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXUnaryIntrinsic.FLOAT_FLOOR;
 import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXUnaryIntrinsic.LOG2;
+import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXUnaryIntrinsic.LOG2_APPROX_FTZ;
 import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXUnaryIntrinsic.POPCOUNT;
+import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXUnaryIntrinsic.RSQRT_APPROX_FTZ;
 import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXUnaryIntrinsic.SIN;
+import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXUnaryIntrinsic.SIN_APPROX_FTZ;
 import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXUnaryIntrinsic.SQRT;
+import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXUnaryIntrinsic.SQRT_APPROX_FTZ;
 import static uk.ac.manchester.tornado.runtime.graal.compiler.TornadoCodeGenerator.trace;
 
 public class PTXBuiltinTool {
@@ -222,6 +228,36 @@ public class PTXBuiltinTool {
         return null;
     }
 
+    public Value genFloatApproxCos(Value input) {
+        trace("genApproxCos: cos.approx.ftz(%s)", input);
+        return new PTXUnary.Intrinsic(COS_APPROX_FTZ, LIRKind.value(input.getPlatformKind()), input);
+    }
+
+    public Value genFloatApproxExp2(Value input) {
+        trace("genApproxExp2: ex2.approx.ftz(%s)", input);
+        return new PTXUnary.Intrinsic(EXP2_APPROX_FTZ, LIRKind.value(input.getPlatformKind()), input);
+    }
+
+    public Value genFloatApproxLog2(Value input) {
+        trace("genApproxLog2: lg2.approx.ftz(%s)", input);
+        return new PTXUnary.Intrinsic(LOG2_APPROX_FTZ, LIRKind.value(input.getPlatformKind()), input);
+    }
+
+    public Value genFloatApproxRSqrt(Value input) {
+        trace("genApproxRSqrt: rsqrt.approx.ftz(%s)", input);
+        return new PTXUnary.Intrinsic(RSQRT_APPROX_FTZ, LIRKind.value(input.getPlatformKind()), input);
+    }
+
+    public Value genFloatApproxSin(Value input) {
+        trace("genApproxSin: sin.approx.ftz(%s)", input);
+        return new PTXUnary.Intrinsic(SIN_APPROX_FTZ, LIRKind.value(input.getPlatformKind()), input);
+    }
+
+    public Value genFloatApproxSqrt(Value input) {
+        trace("genApproxSqrt: sqrt.approx.ftz(%s)", input);
+        return new PTXUnary.Intrinsic(SQRT_APPROX_FTZ, LIRKind.value(input.getPlatformKind()), input);
+    }
+
     public Value genFloatATan2(Value x, Value y) {
         unimplemented();
         return null;
@@ -24,6 +24,7 @@
 
 package uk.ac.manchester.tornado.drivers.ptx.graal.lir;
 
+import jdk.vm.ci.meta.JavaKind;
 import jdk.vm.ci.meta.Value;
 import org.graalvm.compiler.lir.ConstantValue;
 import org.graalvm.compiler.lir.LIRInstruction;
@@ -35,8 +36,11 @@ import uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler;
 import uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssembler.PTXNullaryOp;
 import uk.ac.manchester.tornado.drivers.ptx.graal.compiler.PTXCompilationResultBuilder;
 import uk.ac.manchester.tornado.drivers.ptx.graal.meta.PTXMemorySpace;
+import uk.ac.manchester.tornado.runtime.common.ImageFormat;
+import uk.ac.manchester.tornado.runtime.graal.nodes.AtomicIndexedNode.AtomicOperation;
 
 import java.nio.charset.StandardCharsets;
+import java.util.concurrent.atomic.AtomicInteger;
 
 import static uk.ac.manchester.tornado.drivers.ptx.graal.PTXCodeUtil.getFPURoundingMode;
 import static uk.ac.manchester.tornado.drivers.ptx.graal.asm.PTXAssemblerConstants.*;
@@ -331,6 +335,202 @@ public class PTXLIRStmt {
         }
     }
 
+    @Opcode("ATOMIC_INDEXED")
+    public static class AtomicIndexedStmt extends AbstractInstruction {
+
+        public static final LIRInstructionClass<AtomicIndexedStmt> TYPE = LIRInstructionClass.create(AtomicIndexedStmt.class);
+
+        // Labels are scoped to the function, so each loop gets its own
+        private static final AtomicInteger CAS_LOOP_IDS = new AtomicInteger();
+
+        @Use
+        protected Value rhs;
+        @Use
+        protected PTXUnary.MemoryAccess address;
+
+        private final AtomicOperation operation;
+        private final PTXKind kind;
+
+        public AtomicIndexedStmt(PTXUnary.MemoryAccess address, Value rhs, AtomicOperation operation, PTXKind kind) {
+            super(TYPE);
+            this.rhs = rhs;
+            this.address = address;
+            this.operation = operation;
+            this.kind = kind;
+        }
+
+        @Override
+        public void emitCode(PTXCompilationResultBuilder crb, PTXAssembler asm) {
+            if (kind == PTXKind.F32 && operation != AtomicOperation.ADD) {
+                emitCompareAndSwapLoop(crb, asm);
+                return;
+            }
+            // red.global.add.s32 [%rd19], %r10;
+            asm.emit("red");
+            asm.emitSymbol(DOT);
+            asm.emit(address.getBase().memorySpace.getName());
+            asm.emitSymbol(DOT);
+            asm.emit(operation.name().toLowerCase());
+            asm.emitSymbol(DOT);
+            asm.emit(kind.toString());
+            asm.emitSymbol(TAB);
+
+            address.emit(crb, asm, null);
+            asm.emitSymbol(COMMA);
+            asm.space();
+
+            asm.emitValueOrOp(crb, rhs, null);
+            asm.delimiter();
+            asm.eol();
+        }
+
+        /**
+         * PTX has no float min/max reduction. The element is updated with an
+         * atom.cas loop on its bit pattern instead:
+         *
+         * <pre>
+         * {
+         *   .reg .b32 %casOld, %casSeen, %casNew;
+         *   .reg .f32 %casValue;
+         *   .reg .pred %casRetry;
+         *   ld.global.b32 %casOld, [%rd19];
+         * CAS_LOOP_0:
+         *   mov.b32 %casValue, %casOld;
+         *   min.f32 %casValue, %casValue, %f10;
+         *   mov.b32 %casNew, %casValue;
+         *   atom.global.cas.b32 %casSeen, [%rd19], %casOld, %casNew;
+         *   setp.ne.b32 %casRetry, %casSeen, %casOld;
+         *   mov.b32 %casOld, %casSeen;
+         *   @%casRetry bra CAS_LOOP_0;
+         * }
+         * </pre>
+         */
+        private void emitCompareAndSwapLoop(PTXCompilationResultBuilder crb, PTXAssembler asm) {
+            final String memorySpace = address.getBase().memorySpace.getName();
+            final String label = "CAS_LOOP_" + CAS_LOOP_IDS.getAndIncrement();
+
+            asm.emitLine(CURLY_BRACKETS_OPEN);
+            asm.emitLine(".reg .b32 %casOld, %casSeen, %casNew;");
+            asm.emitLine(".reg .f32 %casValue;");
+            asm.emitLine(".reg .pred %casRetry;");
+            asm.emit("ld." + memorySpace + ".b32" + TAB + "%casOld, ");
+            address.emit(crb, asm, null);
+            asm.delimiter();
+            asm.eol();
+            asm.emitLine(label + COLON);
+            asm.emitLine("mov.b32" + TAB + "%casValue, %casOld;");
+            asm.emit(operation.name().toLowerCase() + ".f32" + TAB + "%casValue, %casValue, ");
+            asm.emitValueOrOp(crb, rhs, null);
+            asm.delimiter();
+            asm.eol();
+            asm.emitLine("mov.b32" + TAB + "%casNew, %casValue;");
+            asm.emit("atom." + memorySpace + ".cas.b32" + TAB + "%casSeen, ");
+            address.emit(crb, asm, null);
+            asm.emit(", %casOld, %casNew");
+            asm.delimiter();
+            asm.eol();
+            asm.emitLine("setp.ne.b32" + TAB + "%casRetry, %casSeen, %casOld;");
+            asm.emitLine("mov.b32" + TAB + "%casOld, %casSeen;");
+            asm.emitLine("@%casRetry " + BRANCH + TAB + label + STMT_DELIMITER);
+            asm.emitLine(CURLY_BRACKETS_CLOSE);
+        }
+
+        public Value getRhs() {
+            return rhs;
+        }
+
+        public PTXUnary.MemoryAccess getAddress() {
+            return address;
+        }
+
+        public AtomicOperation getOperation() {
+            return operation;
+        }
+    }
+
+    @Opcode("READ_IMAGE")
+    public static class ReadImageStmt extends AbstractInstruction {
+
+        public static final LIRInstructionClass<ReadImageStmt> TYPE = LIRInstructionClass.create(ReadImageStmt.class);
+
+        @Def
+        protected Variable result;
+        @Use
+        protected Value x;
+        @Use
+        protected Value y;
+
+        private final int imageIndex;
+        private final ImageFormat format;
+        private final int channel;
+
+        public ReadImageStmt(Variable result, int imageIndex, ImageFormat format, int channel, Value x, Value y) {
+            super(TYPE);
+            this.result = result;
+            this.imageIndex = imageIndex;
+            this.format = format;
+            this.channel = channel;
+            this.x = x;
+            this.y = y;
+        }
+
+        /**
+         * Reads a texel of the texture object passed as the kernel parameter
+         * {@code texture<imageIndex>}. The channels of a 3-channel pixel are
+         * consecutive texels of a single-channel texture:
+         *
+         * <pre>
+         * {
+         *   .reg .u64 %texObject;
+         *   .reg .s32 %texX, %texY;
+         *   .reg .f32 %texel<4>;
+         *   ld.param.u64 %texObject, [texture1];
+         *   mad.lo.s32 %texX, %r5, 3, 2;
+         *   mov.s32 %texY, %r6;
+         *   tex.2d.v4.f32.s32 {%texel0, %texel1, %texel2, %texel3}, [%texObject, {%texX, %texY}];
+         *   mov.f32 %f7, %texel0;
+         * }
+         * </pre>
+         */
+        @Override
+        public void emitCode(PTXCompilationResultBuilder crb, PTXAssembler asm) {
+            final boolean isFloat = format.getElementKind() == JavaKind.Float;
+            final String texelType = isFloat ? "f32" : "s32";
+            final int texel = format.isSplitPixel() ? 0 : channel;
+
+            asm.emitLine(CURLY_BRACKETS_OPEN);
+            asm.emitLine(".reg .u64 %texObject;");
+            asm.emitLine(".reg .s32 %texX, %texY;");
+            asm.emitLine(".reg ." + texelType + " %texel<4>;");
+            asm.emitLine("ld.param.u64" + TAB + "%texObject, [" + TEXTURE_PARAM_PREFIX + imageIndex + "];");
+            if (format.isSplitPixel()) {
+                asm.emit("mad.lo.s32" + TAB + "%texX, ");
+                asm.emitValueOrOp(crb, x, null);
+                asm.emit(", " + format.getPixelChannels() + ", " + channel);
+            } else {
+                asm.emit("mov.s32" + TAB + "%texX, ");
+                asm.emitValueOrOp(crb, x, null);
+            }
+            asm.delimiter();
+            asm.eol();
+            asm.emit("mov.s32" + TAB + "%texY, ");
+            asm.emitValueOrOp(crb, y, null);
+            asm.delimiter();
+            asm.eol();
+            asm.emitLine("tex.2d.v4." + texelType + ".s32" + TAB + "{%texel0, %texel1, %texel2, %texel3}, [%texObject, {%texX, %texY}];");
+            if (isFloat) {
+                asm.emit("mov.f32" + TAB);
+            } else {
+                asm.emit(CONVERT + DOT + result.getPlatformKind().toString() + ".s32" + TAB);
+            }
+            asm.emitValue(result);
+            asm.emit(", %texel" + texel);
+            asm.delimiter();
+            asm.eol();
+            asm.emitLine(CURLY_BRACKETS_CLOSE);
+        }
+    }
+
     @Opcode("VSTORE")
     public static class VectorStoreStmt extends AbstractInstruction {
 
@@ -30,7 +30,8 @@ public enum PTXMemorySpace {
     GLOBAL(0, PTXAssemblerConstants.GLOBAL_MEM_MODIFIER), //
     PARAM(1, PTXAssemblerConstants.PARAM_MEM_MODIFIER), //
     SHARED(2, PTXAssemblerConstants.SHARED_MEM_MODIFIER), //
-    LOCAL(3, PTXAssemblerConstants.LOCAL_MEM_MODIFIER); //
+    LOCAL(3, PTXAssemblerConstants.LOCAL_MEM_MODIFIER), //
+    GLOBAL_NC(4, PTXAssemblerConstants.GLOBAL_NC_MEM_MODIFIER); //
 
     private final int index;
     private final String name;
@@ -66,6 +66,12 @@ public class PTXFPUnaryIntrinsicNode extends UnaryNode implements ArithmeticLIRL
 
     // @formatter:off
     public enum Operation {
+        APPROX_COS,
+        APPROX_EXP,
+        APPROX_LOG,
+        APPROX_RSQRT,
+        APPROX_SIN,
+        APPROX_SQRT,
         COS,
         EXP,
         FABS,
@@ -151,6 +157,24 @@ public class PTXFPUnaryIntrinsicNode extends UnaryNode implements ArithmeticLIRL
             case LOG:
                 generateLog(builder, lirGenPTX, gen, initialInput);
                 return;
+            case APPROX_COS:
+                result = gen.genFloatApproxCos(auxValue);
+                break;
+            case APPROX_SIN:
+                result = gen.genFloatApproxSin(auxValue);
+                break;
+            case APPROX_SQRT:
+                result = gen.genFloatApproxSqrt(auxValue);
+                break;
+            case APPROX_RSQRT:
+                result = gen.genFloatApproxRSqrt(auxValue);
+                break;
+            case APPROX_EXP:
+                generateApproxExp(builder, lirGenPTX, gen, initialInput);
+                return;
+            case APPROX_LOG:
+                generateApproxLog(builder, lirGenPTX, gen, initialInput);
+                return;
             default:
                 throw shouldNotReachHere();
         }
@@ -231,6 +255,29 @@ public class PTXFPUnaryIntrinsicNode extends UnaryNode implements ArithmeticLIRL
         builder.setResult(this, result);
     }
 
+    /**
+     * Single precision e ^ a for {@code TornadoMath.fastExp}, computed as
+     * ex2.approx.ftz(a * log2(e)).
+     */
+    private void generateApproxExp(NodeLIRBuilderTool builder, PTXArithmeticTool lirGen, PTXBuiltinTool gen, Value x) {
+        Value log2e = new ConstantValue(LIRKind.value(PTXKind.F32), JavaConstant.forFloat((float) (1.0 / Math.log(2))));
+        Value aMulLog2e = lirGen.emitMul(x, log2e, false);
+        Variable result = builder.getLIRGeneratorTool().newVariable(LIRKind.value(PTXKind.F32));
+        builder.getLIRGeneratorTool().append(new AssignStmt(result, gen.genFloatApproxExp2(aMulLog2e)));
+        builder.setResult(this, result);
+    }
+
+    /**
+     * Single precision log_e(a) for {@code TornadoMath.fastLog}, computed as
+     * lg2.approx.ftz(a) * ln(2), which avoids the division of the precise path.
+     */
+    private void generateApproxLog(NodeLIRBuilderTool builder, PTXArithmeticTool lirGen, PTXBuiltinTool gen, Value x) {
+        Variable var = builder.getLIRGeneratorTool().newVariable(LIRKind.value(PTXKind.F32));
+        Value log2 = builder.getLIRGeneratorTool().append(new AssignStmt(var, gen.genFloatApproxLog2(x))).getResult();
+        Value ln2 = new ConstantValue(LIRKind.value(PTXKind.F32), JavaConstant.forFloat((float) Math.log(2)));
+        builder.setResult(this, lirGen.emitMul(log2, ln2, false));
+    }
+
     private boolean shouldConvertInput(Value input) {
         return (operation() == Operation.COS || operation() == Operation.SIN || operation() == Operation.EXP || operation() == Operation.LOG) && !((PTXKind) input.getPlatformKind()).isF32();
     }
@@ -240,13 +287,22 @@ public class PTXFPUnaryIntrinsicNode extends UnaryNode implements ArithmeticLIRL
             case FABS:
                 return Math.abs(value);
             case EXP:
+            case APPROX_EXP:
                 return Math.exp(value);
             case SQRT:
+            case APPROX_SQRT:
                 return Math.sqrt(value);
+            case APPROX_RSQRT:
+                return 1.0 / Math.sqrt(value);
             case FLOOR:
                 return Math.floor(value);
             case LOG:
+            case APPROX_LOG:
                 return Math.log(value);
+            case APPROX_SIN:
+                return Math.sin(value);
+            case APPROX_COS:
+                return Math.cos(value);
             default:
                 throw new TornadoInternalError("unable to compute op %s", op);
         }
@@ -257,13 +313,22 @@ public class PTXFPUnaryIntrinsicNode extends UnaryNode implements ArithmeticLIRL
             case FABS:
                 return Math.abs(value);
             case EXP:
+            case APPROX_EXP:
                 return (float) Math.exp(value);
             case SQRT:
+            case APPROX_SQRT:
                 return (float) Math.sqrt(value);
+            case APPROX_RSQRT:
+                return (float) (1.0 / Math.sqrt(value));
             case FLOOR:
                 return (float) Math.floor(value);
             case LOG:
+            case APPROX_LOG:
                 return (float) Math.log(value);
+            case APPROX_SIN:
+                return (float) Math.sin(value);
+            case APPROX_COS:
+                return (float) Math.cos(value);
             default:
                 throw new TornadoInternalError("unable to compute op %s", op);
         }
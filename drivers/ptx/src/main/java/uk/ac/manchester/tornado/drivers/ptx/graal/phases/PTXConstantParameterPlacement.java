@@ -0,0 +1,59 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.drivers.ptx.graal.phases;
+
+import org.graalvm.compiler.nodes.memory.address.AddressNode;
+
+import uk.ac.manchester.tornado.drivers.ptx.graal.PTXArchitecture;
+import uk.ac.manchester.tornado.drivers.ptx.graal.lir.PTXAddressNode;
+import uk.ac.manchester.tornado.runtime.graal.phases.TornadoConstantParameterPlacement;
+import uk.ac.manchester.tornado.runtime.graal.phases.TornadoMidTierContext;
+
+/**
+ * Reads small read-only parameters with {@code ld.global.nc}, through the
+ * read-only data cache. The parameters stay on the heap, so, unlike a
+ * {@code .const} bank, no upload or frame rewrite is needed.
+ */
+public class PTXConstantParameterPlacement extends TornadoConstantParameterPlacement {
+
+    /**
+     * Size of the {@code .const} bank available to a kernel.
+     */
+    private static final long CONSTANT_BANK_SIZE = 65536;
+
+    @Override
+    protected long getCapacity(TornadoMidTierContext context) {
+        return CONSTANT_BANK_SIZE;
+    }
+
+    @Override
+    protected void place(AddressNode address) {
+        ((PTXAddressNode) address).setMemoryRegister(PTXArchitecture.readOnlySpace);
+    }
+
+    @Override
+    protected boolean usesConstantRegion() {
+        return false;
+    }
+}
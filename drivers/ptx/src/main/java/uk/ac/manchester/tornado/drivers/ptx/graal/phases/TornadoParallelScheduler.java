@@ -56,7 +56,9 @@ public class TornadoParallelScheduler extends BasePhase<TornadoHighTierContext>
     private void replaceStrideNode(StructuredGraph graph, ParallelStrideNode stride) {
         final ConstantNode index = graph.addOrUnique(ConstantNode.forInt(stride.index()));
         final GlobalThreadSizeNode threadCount = graph.addOrUnique(new GlobalThreadSizeNode(index));
-        stride.replaceAtUsages(threadCount);
+        // Grid-stride loop: the grid may have fewer threads than iterations
+        final MulNode gridStride = graph.addOrUnique(new MulNode(threadCount, stride.value()));
+        stride.replaceAtUsages(gridStride);
         stride.safeDelete();
     }
 
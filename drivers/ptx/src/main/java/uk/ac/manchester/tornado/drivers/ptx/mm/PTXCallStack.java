@@ -23,12 +23,15 @@
  */
 package uk.ac.manchester.tornado.drivers.ptx.mm;
 
+import uk.ac.manchester.tornado.api.mm.ObjectBuffer;
 import uk.ac.manchester.tornado.drivers.ptx.PTXDeviceContext;
 import uk.ac.manchester.tornado.runtime.common.CallStack;
 import uk.ac.manchester.tornado.runtime.common.DeviceObjectState;
 
 import java.nio.ByteBuffer;
+import java.util.ArrayList;
 import java.util.HashMap;
+import java.util.List;
 
 import static uk.ac.manchester.tornado.api.exceptions.TornadoInternalError.shouldNotReachHere;
 import static uk.ac.manchester.tornado.runtime.common.RuntimeUtilities.isBoxedPrimitive;
@@ -42,6 +45,9 @@ public class PTXCallStack extends PTXByteBuffer implements CallStack {
     private boolean onDevice;
     private byte argStart;
 
+    private final List<PTXImageWrapper> images;
+    private final List<ObjectBuffer> argumentBuffers;
+
     public PTXCallStack(long offset, int numArgs, PTXDeviceContext deviceContext) {
         super((numArgs + RESERVED_SLOTS) << 3, offset, deviceContext);
 
@@ -50,6 +56,8 @@ public class PTXCallStack extends PTXByteBuffer implements CallStack {
         setArgStart(buffer);
 
         onDevice = false;
+        images = new ArrayList<>();
+        argumentBuffers = new ArrayList<>();
     }
 
     private void setArgStart(ByteBuffer buffer) {
@@ -61,9 +69,27 @@ public class PTXCallStack extends PTXByteBuffer implements CallStack {
     public void reset() {
         buffer.mark();
         buffer.reset();
+        images.clear();
+        argumentBuffers.clear();
         onDevice = false;
     }
 
+    /**
+     * Image-backed arguments pushed onto this stack, in argument order. Their
+     * texture objects are passed to the kernel as extra parameters.
+     */
+    public List<PTXImageWrapper> getImages() {
+        return images;
+    }
+
+    /**
+     * @return the device buffer of the object pushed as the given argument, or
+     *         null if the argument is not an object.
+     */
+    public ObjectBuffer getArgumentBuffer(int index) {
+        return index < argumentBuffers.size() ? argumentBuffers.get(index) : null;
+    }
+
     @Override
     public long getDeoptValue() {
         return buffer.getLong(8);
@@ -87,11 +113,13 @@ public class PTXCallStack extends PTXByteBuffer implements CallStack {
                 debug("arg : (null)");
             }
             buffer.putLong(0);
+            argumentBuffers.add(null);
         } else if (isBoxedPrimitive(arg) || arg.getClass().isPrimitive()) {
             if (DEBUG) {
                 debug("arg : type=%s, value=%s", arg.getClass().getName(), arg.toString());
             }
             PrimitiveSerialiser.put(buffer, arg, 8);
+            argumentBuffers.add(null);
         } else {
             shouldNotReachHere();
         }
@@ -104,11 +132,16 @@ public class PTXCallStack extends PTXByteBuffer implements CallStack {
                 debug("arg : (null)");
             }
             buffer.putLong(0);
+            argumentBuffers.add(null);
         } else {
             if (DEBUG) {
                 debug("arg : [0x%x] type=%s, value=%s, address=0x%x (0x%x)", arg.hashCode(), arg.getClass().getSimpleName(), arg, state.getAddress(), state.getOffset());
             }
             buffer.putLong(state.getAddress());
+            argumentBuffers.add(state.getBuffer());
+            if (state.getBuffer() instanceof PTXImageWrapper) {
+                images.add((PTXImageWrapper) state.getBuffer());
+            }
         }
     }
 
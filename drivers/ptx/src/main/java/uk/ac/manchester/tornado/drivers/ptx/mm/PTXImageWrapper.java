@@ -0,0 +1,110 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.drivers.ptx.mm;
+
+import jdk.vm.ci.meta.JavaKind;
+import uk.ac.manchester.tornado.drivers.ptx.PTXDeviceContext;
+import uk.ac.manchester.tornado.runtime.common.ImageFormat;
+
+import java.util.List;
+
+import static uk.ac.manchester.tornado.runtime.TornadoCoreRuntime.getVMConfig;
+
+/**
+ * Wraps an image type (see {@link ImageFormat}) so that, in addition to the
+ * regular object layout on the heap, its storage is mirrored into a CUDA array
+ * read through a texture object. Kernels read through the texture, while
+ * writes keep going to the heap copy. The array is refreshed from the heap
+ * before a kernel launch only when the heap copy has changed since the last
+ * refresh.
+ */
+public class PTXImageWrapper extends PTXObjectWrapper {
+
+    private final PTXDeviceContext deviceContext;
+    private final ImageFormat format;
+    private final int width;
+    private final int height;
+    private final int storageHeaderSize;
+    private long[] texture;
+    private boolean stale;
+
+    public PTXImageWrapper(final PTXDeviceContext deviceContext, Object image, ImageFormat format, long batchSize) {
+        super(deviceContext, image, batchSize);
+        this.deviceContext = deviceContext;
+        this.format = format;
+        this.width = format.getTexelWidth(ImageFormat.getWidth(image));
+        this.height = ImageFormat.getHeight(image);
+        this.storageHeaderSize = getVMConfig().getArrayBaseOffset(format.getElementKind());
+        this.stale = true;
+    }
+
+    @Override
+    public void allocate(Object reference, long batchSize) {
+        super.allocate(reference, batchSize);
+        if (texture == null) {
+            texture = deviceContext.getDevice().getPTXContext().createTexture(width, height, format.getTexelChannels(), format.getElementKind() == JavaKind.Float);
+        }
+    }
+
+    @Override
+    public void write(Object object) {
+        super.write(object);
+        stale = true;
+    }
+
+    @Override
+    public List<Integer> enqueueWrite(Object ref, long batchSize, long hostOffset, int[] events, boolean useDeps) {
+        stale = true;
+        return super.enqueueWrite(ref, batchSize, hostOffset, events, useDeps);
+    }
+
+    public long getTextureObject() {
+        return texture[1];
+    }
+
+    /**
+     * Records that the heap copy has been written on the device, so the texture
+     * has to be refreshed before it is read again.
+     */
+    public void markStale() {
+        stale = true;
+    }
+
+    /**
+     * Copies the storage array of the image, as currently held on the device
+     * heap, into the CUDA array if the heap copy has changed since the last
+     * refresh.
+     *
+     * @return event id of the copy, or -1 if the texture is up to date.
+     */
+    public int enqueueRefresh(int[] events) {
+        if (!stale) {
+            return -1;
+        }
+        stale = false;
+        final FieldBuffer storage = getField(ImageFormat.STORAGE_FIELD);
+        final long rowBytes = (long) width * format.getTexelChannels() * format.getElementKind().getByteCount();
+        return deviceContext.enqueueCopyBufferToImage(storage.toAbsoluteAddress() + storageHeaderSize, texture[0], rowBytes, height, events);
+    }
+}
@@ -488,12 +488,10 @@ public class PTXObjectWrapper implements ObjectBuffer {
     }
 
     public FieldBuffer getField(String name) {
-        int index = 0;
-        for (HotSpotResolvedJavaField field : fields) {
-            if (field.getName().equalsIgnoreCase(name)) {
+        for (int index = 0; index < fields.length; index++) {
+            if (fields[index].getName().equalsIgnoreCase(name)) {
                 return wrappedFields[index];
             }
-            break;
         }
         return null;
     }
@@ -31,6 +31,7 @@ import java.nio.channels.FileChannel;
 import java.nio.file.Files;
 import java.nio.file.Path;
 import java.nio.file.Paths;
+import java.util.ArrayList;
 import java.util.List;
 import java.util.concurrent.ConcurrentHashMap;
 
@@ -56,6 +57,7 @@ import uk.ac.manchester.tornado.drivers.ptx.PTXDevice;
 import uk.ac.manchester.tornado.drivers.ptx.PTXDeviceContext;
 import uk.ac.manchester.tornado.drivers.ptx.PTXDriver;
 import uk.ac.manchester.tornado.drivers.ptx.graal.PTXCodeUtil;
+import uk.ac.manchester.tornado.drivers.ptx.graal.PTXInstalledCode;
 import uk.ac.manchester.tornado.drivers.ptx.graal.PTXProviders;
 import uk.ac.manchester.tornado.drivers.ptx.graal.backend.PTXBackend;
 import uk.ac.manchester.tornado.drivers.ptx.graal.compiler.PTXCompilationResult;
@@ -65,6 +67,7 @@ import uk.ac.manchester.tornado.drivers.ptx.mm.PTXByteBuffer;
 import uk.ac.manchester.tornado.drivers.ptx.mm.PTXCharArrayWrapper;
 import uk.ac.manchester.tornado.drivers.ptx.mm.PTXDoubleArrayWrapper;
 import uk.ac.manchester.tornado.drivers.ptx.mm.PTXFloatArrayWrapper;
+import uk.ac.manchester.tornado.drivers.ptx.mm.PTXImageWrapper;
 import uk.ac.manchester.tornado.drivers.ptx.mm.PTXIntArrayWrapper;
 import uk.ac.manchester.tornado.drivers.ptx.mm.PTXLongArrayWrapper;
 import uk.ac.manchester.tornado.drivers.ptx.mm.PTXMemoryManager;
@@ -73,10 +76,14 @@ import uk.ac.manchester.tornado.drivers.ptx.mm.PTXShortArrayWrapper;
 import uk.ac.manchester.tornado.runtime.TornadoCoreRuntime;
 import uk.ac.manchester.tornado.runtime.common.CallStack;
 import uk.ac.manchester.tornado.runtime.common.DeviceObjectState;
+import uk.ac.manchester.tornado.runtime.common.ImageFormat;
+import uk.ac.manchester.tornado.runtime.common.NumaTopology;
 import uk.ac.manchester.tornado.runtime.common.RuntimeUtilities;
+import uk.ac.manchester.tornado.runtime.common.TieredCompilation;
 import uk.ac.manchester.tornado.runtime.common.Tornado;
 import uk.ac.manchester.tornado.runtime.common.TornadoAcceleratorDevice;
 import uk.ac.manchester.tornado.runtime.common.TornadoInstalledCode;
+import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
 import uk.ac.manchester.tornado.runtime.common.TornadoSchedulingStrategy;
 import uk.ac.manchester.tornado.runtime.sketcher.Sketch;
 import uk.ac.manchester.tornado.runtime.sketcher.TornadoSketcher;
@@ -180,13 +187,17 @@ public class PTXTornadoDevice implements TornadoAcceleratorDevice {
 
         try {
             PTXCompilationResult result;
+            boolean tiered = false;
             if (!deviceContext.isCached(resolvedMethod.getName(), executable)) {
                 PTXProviders providers = (PTXProviders) getBackend().getProviders();
+                tiered = TieredCompilation.isEnabled();
                 // profiler
                 profiler.registerDeviceID(ProfilerType.DEVICE_ID, taskMeta.getId(), taskMeta.getLogicDevice().getDriverIndex() + ":" + taskMeta.getDeviceIndex());
                 profiler.registerDeviceName(ProfilerType.DEVICE, taskMeta.getId(), taskMeta.getLogicDevice().getPhysicalDevice().getDeviceName());
                 profiler.start(ProfilerType.TASK_COMPILE_GRAAL_TIME, taskMeta.getId());
-                result = PTXCompiler.compileSketchForDevice(sketch, executable, providers, getBackend());
+                synchronized (providers.getSuitesProvider()) {
+                    result = PTXCompiler.compileSketchForDevice(sketch, executable, providers, getBackend(), tiered);
+                }
                 profiler.stop(ProfilerType.TASK_COMPILE_GRAAL_TIME, taskMeta.getId());
                 profiler.sum(ProfilerType.TOTAL_GRAAL_COMPILE_TIME, profiler.getTaskTimer(ProfilerType.TASK_COMPILE_GRAAL_TIME, taskMeta.getId()));
             } else {
@@ -195,6 +206,11 @@ public class PTXTornadoDevice implements TornadoAcceleratorDevice {
 
             profiler.start(ProfilerType.TASK_COMPILE_DRIVER_TIME, taskMeta.getId());
             TornadoInstalledCode installedCode = deviceContext.installCode(result, resolvedMethod.getName());
+            if (tiered) {
+                final PTXProviders providers = (PTXProviders) getBackend().getProviders();
+                final CompilableTask optimisedTask = executable.withMeta(taskMeta.copy());
+                ((PTXInstalledCode) installedCode).setTieredCompilation(new TieredCompilation<>(() -> recompileOptimised(sketch, optimisedTask, providers, resolvedMethod.getName())));
+            }
             profiler.stop(ProfilerType.TASK_COMPILE_DRIVER_TIME, taskMeta.getId());
             profiler.sum(ProfilerType.TOTAL_DRIVER_COMPILE_TIME, profiler.getTaskTimer(ProfilerType.TASK_COMPILE_DRIVER_TIME, taskMeta.getId()));
             return installedCode;
@@ -206,6 +222,23 @@ public class PTXTornadoDevice implements TornadoAcceleratorDevice {
         }
     }
 
+    /**
+     * Compiles a task with the full optimisation pipeline. It runs on the
+     * background thread of the tiered compilation, while the kernel of the quick
+     * tier keeps running. The task is bound to a copy of the meta data, taken on
+     * the launching thread; the optimised module carries that copy, which is
+     * published to the launches when the module is swapped in.
+     */
+    private PTXInstalledCode recompileOptimised(Sketch sketch, CompilableTask executable, PTXProviders providers, String resolvedMethodName) {
+        // The CUDA context is current per thread
+        device.getPTXContext().enablePTXContext();
+        final PTXCompilationResult result;
+        synchronized (providers.getSuitesProvider()) {
+            result = PTXCompiler.compileSketchForDevice(sketch, executable, providers, getBackend(), false);
+        }
+        return getDeviceContext().getCodeCache().buildSource(result.getName(), result.getTargetCode(), result.getTaskMeta(), resolvedMethodName);
+    }
+
     private TornadoInstalledCode compilePreBuiltTask(SchedulableTask task) {
         final PTXDeviceContext deviceContext = getDeviceContext();
         final PrebuiltTask executable = (PrebuiltTask) task;
@@ -226,6 +259,25 @@ public class PTXTornadoDevice implements TornadoAcceleratorDevice {
         return null;
     }
 
+    @Override
+    public boolean isPeerCopySupported(TornadoAcceleratorDevice source) {
+        return source instanceof PTXTornadoDevice && source != this;
+    }
+
+    @Override
+    public List<Integer> copyFromPeer(Object object, TornadoAcceleratorDevice source, TornadoDeviceObjectState sourceState, TornadoDeviceObjectState objectState, int[] events) {
+        ensureAllocated(object, 0, objectState);
+        final ObjectBuffer sourceBuffer = sourceState.getBuffer();
+
+        // The copy is enqueued in the stream of this device
+        source.sync();
+
+        objectState.setContents(true);
+        List<Integer> listEvents = new ArrayList<>();
+        listEvents.add(getDeviceContext().enqueueCopyFromPeer(objectState.getBuffer().toAbsoluteAddress(), sourceBuffer.toAbsoluteAddress(), sourceBuffer.size(), events));
+        return listEvents;
+    }
+
     @Override
     public boolean isFullJITMode(SchedulableTask task) {
         return true;
@@ -336,7 +388,11 @@ public class PTXTornadoDevice implements TornadoAcceleratorDevice {
             }
 
         } else if (!type.isPrimitive() && !type.isArray()) {
-            result = new PTXObjectWrapper(getDeviceContext(), arg, batchSize);
+            if (ImageFormat.of(arg) != null) {
+                result = new PTXImageWrapper(getDeviceContext(), arg, ImageFormat.of(arg), batchSize);
+            } else {
+                result = new PTXObjectWrapper(getDeviceContext(), arg, batchSize);
+            }
         }
 
         TornadoInternalError.guarantee(result != null, "Unable to create buffer for object: " + type);
@@ -660,6 +716,9 @@ public class PTXTornadoDevice implements TornadoAcceleratorDevice {
     @Override
     public void enableThreadSharing() {
         device.getPTXContext().enablePTXContext();
+        if (TornadoOptions.NUMA_PIN_THREADS) {
+            NumaTopology.getInstance().pinCurrentThread(device.getNumaNode(), PTX::pinCurrentThread);
+        }
     }
 
     @Override
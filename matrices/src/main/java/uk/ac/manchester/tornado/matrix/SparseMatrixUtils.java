@@ -35,6 +35,8 @@ import java.util.ArrayList;
 import java.util.List;
 import java.util.Random;
 
+import uk.ac.manchester.tornado.api.collections.types.SparseMatrixCSRFloat;
+
 public class SparseMatrixUtils {
 
     private static final boolean VERBOSE = false;
@@ -43,6 +45,7 @@ public class SparseMatrixUtils {
 
         public int n;
         public int size;
+        public int numCols;
         public T vals;
         public int[] rows;
         public int[] cols;
@@ -169,6 +172,7 @@ public class SparseMatrixUtils {
             nElements = index;
             mat.n = nElements;
             mat.size = nRows;
+        mat.numCols = nCols;
             mat.vals = new double[nElements];
             mat.cols = new int[nElements];
             mat.rows = new int[nRows + 1];
@@ -196,6 +200,20 @@ public class SparseMatrixUtils {
 
     }
 
+    /**
+     * Converts a matrix loaded from a Matrix Market file into the sparse
+     * collection type, which can be converted to the ELL and SELL-C-sigma
+     * layouts.
+     */
+    public static SparseMatrixCSRFloat toSparseMatrix(CSRMatrix<float[]> mat) {
+        return new SparseMatrixCSRFloat(mat.size, mat.numCols, mat.rows, mat.cols, mat.vals);
+    }
+
+    public static SparseMatrixCSRFloat loadSparseMatrixF(final String path) {
+        final CSRMatrix<float[]> mat = loadMatrixF(path);
+        return (mat == null) ? null : toSparseMatrix(mat);
+    }
+
     public static CSRMatrix<float[]> loadMatrixF(InputStream inStream) {
         try (final BufferedReader br = new BufferedReader(new InputStreamReader(inStream))) {
             return loadMatrixF(br);
@@ -339,6 +357,7 @@ public class SparseMatrixUtils {
 
         mat.n = nElements;
         mat.size = nRows;
+        mat.numCols = nCols;
         mat.vals = new float[nElements];
         mat.cols = new int[nElements];
         mat.rows = new int[nRows + 1];
@@ -359,6 +378,11 @@ public class SparseMatrixUtils {
             mat.cols[i] = c.y;
         }
 
+        // rows after the last non-zero are empty
+        while (r < nRows - 1) {
+            mat.rows[++r] = nElements;
+        }
+
         coords.clear();
         return mat;
     }
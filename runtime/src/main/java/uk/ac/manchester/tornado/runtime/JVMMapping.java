@@ -202,6 +202,17 @@ public class JVMMapping implements TornadoAcceleratorDevice {
         return null;
     }
 
+    @Override
+    public boolean isPeerCopySupported(TornadoAcceleratorDevice source) {
+        return false;
+    }
+
+    @Override
+    public List<Integer> copyFromPeer(Object object, TornadoAcceleratorDevice source, TornadoDeviceObjectState sourceState, TornadoDeviceObjectState objectState, int[] events) {
+        TornadoInternalError.unimplemented();
+        return null;
+    }
+
     @Override
     public boolean isFullJITMode(SchedulableTask task) {
         return false;
@@ -28,11 +28,11 @@ package uk.ac.manchester.tornado.runtime;
 import static uk.ac.manchester.tornado.api.enums.TornadoExecutionStatus.COMPLETE;
 import static uk.ac.manchester.tornado.runtime.common.Tornado.ENABLE_PROFILING;
 import static uk.ac.manchester.tornado.runtime.common.Tornado.USE_VM_FLUSH;
-import static uk.ac.manchester.tornado.runtime.common.Tornado.VM_USE_DEPS;
 import static uk.ac.manchester.tornado.runtime.common.TornadoOptions.VIRTUAL_DEVICE_ENABLED;
 
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
+import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.BitSet;
 import java.util.HashMap;
@@ -54,6 +54,7 @@ import uk.ac.manchester.tornado.api.exceptions.TornadoRuntimeException;
 import uk.ac.manchester.tornado.api.mm.ObjectBuffer;
 import uk.ac.manchester.tornado.api.profiler.ProfilerType;
 import uk.ac.manchester.tornado.api.profiler.TornadoProfiler;
+import uk.ac.manchester.tornado.runtime.common.BailoutCache;
 import uk.ac.manchester.tornado.runtime.common.CallStack;
 import uk.ac.manchester.tornado.runtime.common.DeviceObjectState;
 import uk.ac.manchester.tornado.runtime.common.Tornado;
@@ -63,6 +64,7 @@ import uk.ac.manchester.tornado.runtime.common.TornadoLogger;
 import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
 import uk.ac.manchester.tornado.runtime.graph.TornadoExecutionContext;
 import uk.ac.manchester.tornado.runtime.graph.TornadoGraphAssembler.TornadoVMBytecodes;
+import uk.ac.manchester.tornado.runtime.profiler.ProfilerSampler;
 import uk.ac.manchester.tornado.runtime.profiler.TimeProfiler;
 import uk.ac.manchester.tornado.runtime.tasks.GlobalObjectState;
 import uk.ac.manchester.tornado.runtime.tasks.PrebuiltTask;
@@ -112,13 +114,17 @@ public class TornadoVM extends TornadoLogger {
 
     private GridTask gridTask;
 
+    private final int[][] prologueAllocations;
+    private final int prologueEnd;
+    private boolean allocationsDone;
+
     public TornadoVM(TornadoExecutionContext graphContext, byte[] code, int limit, TornadoProfiler timeProfiler, GridTask gridTask) {
 
         this.graphContext = graphContext;
         this.timeProfiler = timeProfiler;
         this.gridTask = gridTask;
 
-        useDependencies = graphContext.meta().enableOooExecution() | VM_USE_DEPS;
+        useDependencies = graphContext.useDependencies();
         totalTime = 0;
         invocations = 0;
 
@@ -175,9 +181,45 @@ public class TornadoVM extends TornadoLogger {
         debug("%s - vm ready to go", graphContext.getId());
         buffer.mark();
 
+        prologueAllocations = scanAllocationPrologue();
+        prologueEnd = buffer.position();
+        buffer.reset();
+
         mappingAtomics = new ConcurrentHashMap<>();
     }
 
+    /**
+     * Collects the whole-object ALLOCATEs placed at the start of the program by
+     * the byte-code optimiser. Once they have run, later executions skip them
+     * while the device buffers stay valid.
+     */
+    private int[][] scanAllocationPrologue() {
+        final List<int[]> allocations = new ArrayList<>();
+        if (TornadoOptions.TVM_OPTIMISE_BYTECODES) {
+            while (buffer.remaining() >= 17 && buffer.get(buffer.position()) == TornadoVMBytecodes.ALLOCATE.value() && buffer.getLong(buffer.position() + 9) == 0) {
+                buffer.get();
+                final int objectIndex = buffer.getInt();
+                final int contextIndex = buffer.getInt();
+                buffer.getLong();
+                allocations.add(new int[] { objectIndex, contextIndex });
+            }
+        }
+        return allocations.toArray(new int[0][]);
+    }
+
+    private boolean canSkipAllocations() {
+        if (!allocationsDone || prologueAllocations.length == 0) {
+            return false;
+        }
+        for (int[] allocation : prologueAllocations) {
+            final DeviceObjectState objectState = resolveObjectState(allocation[0], allocation[1]);
+            if (!objectState.hasBuffer() || !objectState.isValid()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     public void setCompileUpdate() {
         this.doUpdate = true;
     }
@@ -204,6 +246,7 @@ public class TornadoVM extends TornadoLogger {
         for (GlobalObjectState globalState : globalStates) {
             globalState.invalidate();
         }
+        allocationsDone = false;
     }
 
     public void warmup() {
@@ -242,6 +285,26 @@ public class TornadoVM extends TornadoLogger {
         return device.ensureAllocated(object, sizeBatch, objectState);
     }
 
+    /**
+     * Returns the event that ADD_DEP records for the commands that use an object,
+     * or -1 if the transfer enqueued nothing. A transfer can enqueue several
+     * commands (e.g., the header and the contents of an object), which may run
+     * in any order on an out-of-order queue; a marker over all of them completes
+     * only once the whole transfer has completed.
+     */
+    private int lastEventOf(TornadoAcceleratorDevice device, List<Integer> events) {
+        if (events == null || events.isEmpty()) {
+            return -1;
+        }
+        final int lastEvent = events.get(events.size() - 1);
+        if (!useDependencies || events.size() == 1) {
+            return lastEvent;
+        }
+        final int marker = device.enqueueMarker(events.stream().mapToInt(Integer::intValue).toArray());
+        // Devices without markers on event lists (OpenCL 1.1) return -1
+        return (marker != -1) ? marker : lastEvent;
+    }
+
     private boolean isObjectAtomic(Object object) {
         return object instanceof AtomicInteger;
     }
@@ -258,17 +321,20 @@ public class TornadoVM extends TornadoLogger {
         }
 
         List<Integer> allEvents;
+        final TornadoAcceleratorDevice owner;
         if (sizeBatch > 0) {
             // We need to stream-in when using batches, because the
             // whole data is not copied yet.
             allEvents = device.streamIn(object, sizeBatch, offset, objectState, waitList);
+        } else if ((owner = resolveRemoteOwner(objectIndex, device, objectState)) != null) {
+            allEvents = copyFromOwner(tornadoVMBytecodeList, object, objectIndex, owner, device, objectState, waitList);
         } else {
             allEvents = device.ensurePresent(object, objectState, waitList, sizeBatch, offset);
         }
 
         resetEventIndexes(eventList);
 
-        if (TornadoOptions.isProfilerEnabled() && allEvents != null) {
+        if (ProfilerSampler.isTimed() && allEvents != null) {
             for (Integer e : allEvents) {
                 Event event = device.resolveEvent(e);
                 event.waitForEvents();
@@ -282,7 +348,47 @@ public class TornadoVM extends TornadoLogger {
                 timeProfiler.setTimer(ProfilerType.DISPATCH_TIME, dispatchValue);
             }
         }
-        return 0;
+        return lastEventOf(device, allEvents);
+    }
+
+    /**
+     * Returns the device that holds the only valid copy of an object, when the
+     * object is not present on the target device yet: e.g., after migrating the
+     * task-schedule with setDevice, or when a task running on another device
+     * wrote the object.
+     */
+    private TornadoAcceleratorDevice resolveRemoteOwner(int objectIndex, TornadoAcceleratorDevice device, DeviceObjectState objectState) {
+        if (objectState.hasContents()) {
+            return null;
+        }
+        final GlobalObjectState globalState = resolveGlobalObjectState(objectIndex);
+        final TornadoAcceleratorDevice owner = globalState.getOwner();
+        if (owner == null || owner == device) {
+            return null;
+        }
+        final DeviceObjectState ownerState = globalState.getDeviceState(owner);
+        if (ownerState.isAtomicRegionPresent() || !ownerState.isValid() || !ownerState.hasContents() || !ownerState.isModified()) {
+            return null;
+        }
+        return owner;
+    }
+
+    /**
+     * Copies primitive arrays directly between devices when the driver supports
+     * it. Otherwise, the object is staged through the host.
+     */
+    private List<Integer> copyFromOwner(StringBuilder tornadoVMBytecodeList, Object object, int objectIndex, TornadoAcceleratorDevice owner, TornadoAcceleratorDevice device,
+            DeviceObjectState objectState, int[] waitList) {
+        final DeviceObjectState ownerState = resolveGlobalObjectState(objectIndex).getDeviceState(owner);
+        final boolean isPrimitiveArray = object.getClass().isArray() && object.getClass().getComponentType().isPrimitive();
+        if (TornadoOptions.PEER_COPIES && isPrimitiveArray && device.isPeerCopySupported(owner)) {
+            if (TornadoOptions.printBytecodes) {
+                tornadoVMBytecodeList.append(String.format("vm: COPY_PEER [Object Hash Code=0x%x] %s from %s to %s", object.hashCode(), object, owner, device)).append("\n");
+            }
+            return device.copyFromPeer(object, owner, ownerState, objectState, waitList);
+        }
+        owner.resolveEvent(owner.streamOutBlocking(object, 0, ownerState, null)).waitOn();
+        return device.ensurePresent(object, objectState, waitList, 0, 0);
     }
 
     private int executeStreamIn(StringBuilder tornadoVMBytecodeList, final int objectIndex, final int contextIndex, final long offset, final int eventList, final long sizeBatch,
@@ -300,7 +406,7 @@ public class TornadoVM extends TornadoLogger {
 
         resetEventIndexes(eventList);
 
-        if (TornadoOptions.isProfilerEnabled() && allEvents != null) {
+        if (ProfilerSampler.isTimed() && allEvents != null) {
             for (Integer e : allEvents) {
                 Event event = device.resolveEvent(e);
                 event.waitForEvents();
@@ -314,7 +420,7 @@ public class TornadoVM extends TornadoLogger {
                 timeProfiler.setTimer(ProfilerType.DISPATCH_TIME, dispatchValue);
             }
         }
-        return 0;
+        return lastEventOf(device, allEvents);
     }
 
     private int executeStreamOut(StringBuilder tornadoVMBytecodeList, final int objectIndex, final int contextIndex, final long offset, final int eventList, final long sizeBatch,
@@ -333,7 +439,7 @@ public class TornadoVM extends TornadoLogger {
 
         resetEventIndexes(eventList);
 
-        if (TornadoOptions.isProfilerEnabled() && lastEvent != -1) {
+        if (ProfilerSampler.isTimed() && lastEvent != -1) {
             Event event = device.resolveEvent(lastEvent);
             event.waitForEvents();
             long value = timeProfiler.getTimer(ProfilerType.COPY_OUT_TIME);
@@ -359,7 +465,7 @@ public class TornadoVM extends TornadoLogger {
 
         final int tornadoEventID = device.streamOutBlocking(object, offset, objectState, waitList);
 
-        if (TornadoOptions.isProfilerEnabled() && tornadoEventID != -1) {
+        if (ProfilerSampler.isTimed() && tornadoEventID != -1) {
             Event event = device.resolveEvent(tornadoEventID);
             event.waitForEvents();
             long value = timeProfiler.getTimer(ProfilerType.COPY_OUT_TIME);
@@ -427,6 +533,9 @@ public class TornadoVM extends TornadoLogger {
                 profilerUpdateForPreCompiledTask(task);
                 doUpdate = false;
             } catch (Exception e) {
+                if (BailoutCache.isEnabled()) {
+                    BailoutCache.record(BailoutCache.key(task, device));
+                }
                 throw new TornadoBailoutRuntimeException("Unable to compile task " + task.getFullName() + "\n" + Arrays.toString(e.getStackTrace()), e);
             }
         }
@@ -500,6 +609,9 @@ public class TornadoVM extends TornadoLogger {
                 if (isObjectInAtomicRegion(objectState, device, task)) {
                     atomicsArray = device.updateAtomicRegionAndObjectState(task, atomicsArray, i, objects.get(argIndex), objectState);
                     setObjectOwnerShip(globalState, objectState, device);
+                } else if (accesses[i] == Access.WRITE || accesses[i] == Access.READ_WRITE) {
+                    // Every launch writes the object again, also when the call stack is reused
+                    setObjectOwnerShip(globalState, objectState, device);
                 }
             }
 
@@ -517,9 +629,6 @@ public class TornadoVM extends TornadoLogger {
                     final String ERROR_MESSAGE = "object is not valid: %s %s";
                     TornadoInternalError.guarantee(objectState.isValid(), ERROR_MESSAGE, objects.get(argIndex), objectState);
                     stack.push(objects.get(argIndex), objectState);
-                    if (accesses[i] == Access.WRITE || accesses[i] == Access.READ_WRITE) {
-                        setObjectOwnerShip(globalState, objectState, device);
-                    }
                 }
             } else {
                 TornadoInternalError.shouldNotReachHere();
@@ -536,7 +645,7 @@ public class TornadoVM extends TornadoLogger {
         if (atomicsArray != null) {
             bufferAtomics = device.createOrReuseBuffer(atomicsArray);
             List<Integer> allEvents = bufferAtomics.enqueueWrite(null, 0, 0, null, false);
-            if (TornadoOptions.isProfilerEnabled()) {
+            if (ProfilerSampler.isTimed()) {
                 for (Integer e : allEvents) {
                     Event event = device.resolveEvent(e);
                     event.waitForEvents();
@@ -598,7 +707,8 @@ public class TornadoVM extends TornadoLogger {
 
         if (contexts.size() == 1) {
             final TornadoAcceleratorDevice device = contexts.get(0);
-            lastEvent = device.enqueueMarker(waitList);
+            // A marker does not hold back later commands on an out-of-order queue
+            lastEvent = TornadoOptions.DAG_SCHEDULER ? device.enqueueBarrier(waitList) : device.enqueueMarker(waitList);
         } else if (contexts.size() > 1) {
             TornadoInternalError.shouldNotReachHere("unimplemented multi-context barrier");
         }
@@ -627,6 +737,10 @@ public class TornadoVM extends TornadoLogger {
             tornadoVMBytecodeList = new StringBuilder();
         }
 
+        if (!isWarmup && canSkipAllocations()) {
+            buffer.position(prologueEnd);
+        }
+
         while (buffer.hasRemaining()) {
             final byte op = buffer.get();
             if (op == TornadoVMBytecodes.ALLOCATE.value()) {
@@ -647,7 +761,7 @@ public class TornadoVM extends TornadoLogger {
                 if (isWarmup) {
                     continue;
                 }
-                executeCopyIn(tornadoVMBytecodeList, objectIndex, contextIndex, offset, eventList, sizeBatch, waitList);
+                lastEvent = executeCopyIn(tornadoVMBytecodeList, objectIndex, contextIndex, offset, eventList, sizeBatch, waitList);
             } else if (op == TornadoVMBytecodes.STREAM_IN.value()) {
                 final int objectIndex = buffer.getInt();
                 final int contextIndex = buffer.getInt();
@@ -658,7 +772,7 @@ public class TornadoVM extends TornadoLogger {
                 if (isWarmup) {
                     continue;
                 }
-                executeStreamIn(tornadoVMBytecodeList, objectIndex, contextIndex, offset, eventList, sizeBatch, waitList);
+                lastEvent = executeStreamIn(tornadoVMBytecodeList, objectIndex, contextIndex, offset, eventList, sizeBatch, waitList);
             } else if (op == TornadoVMBytecodes.STREAM_OUT.value()) {
                 final int objectIndex = buffer.getInt();
                 final int contextIndex = buffer.getInt();
@@ -724,7 +838,8 @@ public class TornadoVM extends TornadoLogger {
         if (!isWarmup) {
             for (TornadoAcceleratorDevice dev : contexts) {
                 if (useDependencies) {
-                    final int event = dev.enqueueMarker();
+                    // The next execution must not overtake the commands of this one
+                    final int event = TornadoOptions.DAG_SCHEDULER ? dev.enqueueBarrier() : dev.enqueueMarker();
                     barrier = dev.resolveEvent(event);
                 }
 
@@ -739,6 +854,7 @@ public class TornadoVM extends TornadoLogger {
         if (!isWarmup) {
             totalTime += elapsed;
             invocations++;
+            allocationsDone = true;
         }
 
         if (graphContext.meta().isDebug()) {
@@ -0,0 +1,187 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.runtime.common;
+
+import static uk.ac.manchester.tornado.runtime.TornadoCoreRuntime.getTornadoRuntime;
+import static uk.ac.manchester.tornado.runtime.common.Tornado.debug;
+import static uk.ac.manchester.tornado.runtime.common.Tornado.warn;
+
+import java.io.IOException;
+import java.lang.reflect.Array;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.nio.file.StandardOpenOption;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.Set;
+import java.util.TreeMap;
+import java.util.concurrent.ConcurrentHashMap;
+
+import jdk.vm.ci.meta.ResolvedJavaMethod;
+import uk.ac.manchester.tornado.api.common.SchedulableTask;
+import uk.ac.manchester.tornado.api.common.TornadoDevice;
+import uk.ac.manchester.tornado.runtime.tasks.CompilableTask;
+
+/**
+ * Negative cache of compilations that bailed out. A task whose method,
+ * device and specialisation failed to compile before runs the sequential Java
+ * code straight away, instead of paying for the same failed compilation on
+ * every execution.
+ *
+ * Records are kept for the lifetime of the JVM, and also appended to
+ * {@link TornadoOptions#BAILOUT_CACHE_FILE} when it is set. A record is
+ * ignored as soon as the bytecode of the method or any tornado.* option
+ * changes. The options are read once, when the cache is first used.
+ */
+public final class BailoutCache {
+
+    private static final Set<String> bailouts = loadRecords();
+
+    // Compiler options may avoid the bailout
+    private static final int OPTIONS_HASH = hashOptions();
+
+    private BailoutCache() {
+    }
+
+    public static boolean isEnabled() {
+        return TornadoOptions.BAILOUT_CACHE && TornadoOptions.RECOVER_BAILOUT;
+    }
+
+    /**
+     * Computes the key of a task on a device. Scalar arguments are part of the
+     * key because kernels are specialised on their values, as are the types and
+     * lengths of arrays.
+     *
+     * @return the key, or null if the task is not compiled by TornadoVM
+     */
+    public static String key(SchedulableTask task, TornadoDevice device) {
+        if (!(task instanceof CompilableTask)) {
+            return null;
+        }
+        final ResolvedJavaMethod method = getTornadoRuntime().resolveMethod(((CompilableTask) task).getMethod());
+        final StringBuilder key = new StringBuilder();
+        key.append(method.format("%H.%n(%P)")).append('|').append(Arrays.hashCode(method.getCode()));
+        key.append('|').append(device.getPlatformName()).append('|').append(device.getDeviceName());
+        for (Object arg : task.getArguments()) {
+            if (arg == null) {
+                key.append("|null");
+            } else if (arg.getClass().isArray()) {
+                key.append('|').append(arg.getClass().getName()).append('[').append(Array.getLength(arg)).append(']');
+            } else if (RuntimeUtilities.isBoxedPrimitiveClass(arg.getClass())) {
+                key.append('|').append(arg.getClass().getName()).append('=').append(arg);
+            } else {
+                key.append('|').append(arg.getClass().getName());
+            }
+        }
+        key.append('|').append(OPTIONS_HASH);
+        return key.toString();
+    }
+
+    private static int hashOptions() {
+        final StringBuilder options = new StringBuilder();
+        new TreeMap<>(System.getProperties()).forEach((name, value) -> {
+            if (name.toString().startsWith("tornado.")) {
+                options.append(name).append('=').append(value).append(';');
+            }
+        });
+        return options.toString().hashCode();
+    }
+
+    public static boolean isEmpty() {
+        return bailouts.isEmpty();
+    }
+
+    public static boolean contains(String key) {
+        return key != null && bailouts.contains(key);
+    }
+
+    public static void record(String key) {
+        if (key == null || !bailouts.add(key)) {
+            return;
+        }
+        debug("bailout recorded for %s", key);
+        if (!TornadoOptions.BAILOUT_CACHE_FILE.isEmpty()) {
+            synchronized (bailouts) {
+                try {
+                    Files.write(recordsFile(), Collections.singletonList(key), StandardCharsets.UTF_8, StandardOpenOption.CREATE, StandardOpenOption.APPEND);
+                } catch (IOException e) {
+                    warn("bailout cache: unable to write %s (%s)", TornadoOptions.BAILOUT_CACHE_FILE, e.getMessage());
+                }
+            }
+        }
+    }
+
+    /**
+     * Drops the record of a key, so the next execution compiles it again.
+     */
+    public static void invalidate(String key) {
+        if (key != null && bailouts.remove(key)) {
+            storeRecords();
+        }
+    }
+
+    /**
+     * Drops all records.
+     */
+    public static void invalidateAll() {
+        bailouts.clear();
+        storeRecords();
+    }
+
+    private static Path recordsFile() {
+        return Paths.get(TornadoOptions.BAILOUT_CACHE_FILE);
+    }
+
+    private static Set<String> loadRecords() {
+        final Set<String> records = ConcurrentHashMap.newKeySet();
+        if (!TornadoOptions.BAILOUT_CACHE_FILE.isEmpty() && Files.isRegularFile(recordsFile())) {
+            try {
+                for (String line : Files.readAllLines(recordsFile(), StandardCharsets.UTF_8)) {
+                    if (!line.isEmpty()) {
+                        records.add(line);
+                    }
+                }
+            } catch (IOException e) {
+                warn("bailout cache: unable to read %s (%s)", TornadoOptions.BAILOUT_CACHE_FILE, e.getMessage());
+            }
+        }
+        return records;
+    }
+
+    private static void storeRecords() {
+        if (TornadoOptions.BAILOUT_CACHE_FILE.isEmpty()) {
+            return;
+        }
+        synchronized (bailouts) {
+            try {
+                Files.write(recordsFile(), new ArrayList<>(bailouts), StandardCharsets.UTF_8);
+            } catch (IOException e) {
+                warn("bailout cache: unable to write %s (%s)", TornadoOptions.BAILOUT_CACHE_FILE, e.getMessage());
+            }
+        }
+    }
+}
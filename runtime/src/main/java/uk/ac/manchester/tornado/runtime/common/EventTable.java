@@ -0,0 +1,237 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.runtime.common;
+
+import java.util.Arrays;
+import java.util.BitSet;
+
+/**
+ * Growable table that maps TornadoVM local event ids to driver events.
+ * <p>
+ * Local ids are slot indices, so they stay small enough to be kept in
+ * {@link BitSet}s. Every slot has a generation that is bumped when the slot is
+ * reclaimed, so holders of an old entry can find out it was recycled through
+ * {@link #isCurrent(int, int)}.
+ * <p>
+ * Slots that are not retained are reclaimed in registration order, once at
+ * least {@code window} newer events have been registered and the driver
+ * reports the event as complete or failed. Old events that are still running
+ * are moved to the back of the queue, so they do not hold back the rest. When
+ * no slot can be reclaimed the table grows, so registration and lookup are O(1)
+ * (amortised) and never fail.
+ *
+ * @param <T>
+ *            driver event entry.
+ */
+public class EventTable<T> {
+
+    /**
+     * Driver callbacks used to reclaim a slot.
+     */
+    public interface Reclaimer<T> {
+
+        /**
+         * @return true once the driver no longer uses the event, i.e., it has
+         *         completed or failed.
+         */
+        boolean isComplete(T entry);
+
+        void release(T entry);
+    }
+
+    /**
+     * Number of old events still running that are skipped, per registration,
+     * before giving up and growing the table.
+     */
+    private static final int MAX_SKIPPED_CANDIDATES = 4;
+
+    private final Reclaimer<T> reclaimer;
+    private final int window;
+
+    private Object[] entries;
+    private int[] generations;
+    private long[] sequence;
+    private final BitSet retained;
+
+    // FIFO (ring buffer) of slots that are candidates to be reclaimed
+    private int[] candidates;
+    private final BitSet queued;
+    private int candidatesHead;
+    private int candidatesSize;
+
+    private int used;
+    private long registrations;
+
+    public EventTable(int initialCapacity, int window, Reclaimer<T> reclaimer) {
+        final int capacity = Math.max(initialCapacity, 16);
+        this.reclaimer = reclaimer;
+        this.window = window;
+        this.entries = new Object[capacity];
+        this.generations = new int[capacity];
+        this.sequence = new long[capacity];
+        this.candidates = new int[capacity];
+        this.retained = new BitSet(capacity);
+        this.queued = new BitSet(capacity);
+    }
+
+    /**
+     * Registers a driver event.
+     *
+     * @return the local event id.
+     */
+    public int register(T entry) {
+        int slot = reclaimSlot();
+        if (slot == -1) {
+            slot = used++;
+            ensureCapacity(used);
+        }
+        entries[slot] = entry;
+        sequence[slot] = registrations++;
+        enqueueCandidate(slot);
+        return slot;
+    }
+
+    @SuppressWarnings("unchecked")
+    public T get(int localId) {
+        return (localId >= 0 && localId < used) ? (T) entries[localId] : null;
+    }
+
+    public int getGeneration(int localId) {
+        return generations[localId];
+    }
+
+    /**
+     * @return true if the slot still holds the entry registered at the given
+     *         generation.
+     */
+    public boolean isCurrent(int localId, int generation) {
+        return localId >= 0 && localId < used && generations[localId] == generation;
+    }
+
+    public void retain(int localId) {
+        retained.set(localId);
+    }
+
+    public void release(int localId) {
+        retained.clear(localId);
+        if (entries[localId] != null) {
+            enqueueCandidate(localId);
+        }
+    }
+
+    public boolean isRetained(int localId) {
+        return retained.get(localId);
+    }
+
+    /**
+     * @return number of slots allocated so far.
+     */
+    public int size() {
+        return used;
+    }
+
+    public int capacity() {
+        return entries.length;
+    }
+
+    /**
+     * Releases every entry and empties the table.
+     */
+    @SuppressWarnings("unchecked")
+    public void clear() {
+        for (int i = 0; i < used; i++) {
+            if (entries[i] != null) {
+                reclaimer.release((T) entries[i]);
+                entries[i] = null;
+                generations[i]++;
+            }
+        }
+        retained.clear();
+        queued.clear();
+        candidatesHead = 0;
+        candidatesSize = 0;
+        used = 0;
+    }
+
+    @SuppressWarnings("unchecked")
+    private int reclaimSlot() {
+        int skipped = 0;
+        while (candidatesSize > 0 && skipped < MAX_SKIPPED_CANDIDATES) {
+            final int slot = candidates[candidatesHead];
+            if (retained.get(slot) || entries[slot] == null) {
+                // Re-enqueued by release()
+                dequeueCandidate();
+                continue;
+            }
+            if (registrations - sequence[slot] < window) {
+                return -1;
+            }
+            dequeueCandidate();
+            if (!reclaimer.isComplete((T) entries[slot])) {
+                // Stuck event: retry it after the next candidates
+                enqueueCandidate(slot);
+                skipped++;
+                continue;
+            }
+            reclaimer.release((T) entries[slot]);
+            entries[slot] = null;
+            generations[slot]++;
+            return slot;
+        }
+        return -1;
+    }
+
+    private void enqueueCandidate(int slot) {
+        if (queued.get(slot)) {
+            return;
+        }
+        if (candidatesSize == candidates.length) {
+            int[] grown = new int[candidates.length << 1];
+            for (int i = 0; i < candidatesSize; i++) {
+                grown[i] = candidates[(candidatesHead + i) % candidates.length];
+            }
+            candidates = grown;
+            candidatesHead = 0;
+        }
+        candidates[(candidatesHead + candidatesSize) % candidates.length] = slot;
+        candidatesSize++;
+        queued.set(slot);
+    }
+
+    private void dequeueCandidate() {
+        queued.clear(candidates[candidatesHead]);
+        candidatesHead = (candidatesHead + 1) % candidates.length;
+        candidatesSize--;
+    }
+
+    private void ensureCapacity(int required) {
+        if (required <= entries.length) {
+            return;
+        }
+        final int capacity = Math.max(required, entries.length << 1);
+        entries = Arrays.copyOf(entries, capacity);
+        generations = Arrays.copyOf(generations, capacity);
+        sequence = Arrays.copyOf(sequence, capacity);
+    }
+}
@@ -0,0 +1,182 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.runtime.common;
+
+import java.util.ArrayList;
+import java.util.List;
+
+import jdk.vm.ci.meta.JavaKind;
+import jdk.vm.ci.meta.ResolvedJavaMethod;
+import jdk.vm.ci.meta.ResolvedJavaType;
+import uk.ac.manchester.tornado.api.collections.types.ImageByte3;
+import uk.ac.manchester.tornado.api.collections.types.ImageByte4;
+import uk.ac.manchester.tornado.api.collections.types.ImageFloat;
+import uk.ac.manchester.tornado.api.collections.types.ImageFloat3;
+import uk.ac.manchester.tornado.api.collections.types.ImageFloat4;
+
+/**
+ * Layout of the image types that can be backed by device images (OpenCL
+ * images or CUDA texture objects) when {@link TornadoOptions#USE_IMAGES} is
+ * enabled.
+ *
+ * A pixel has {@link #getPixelChannels()} elements in the storage array of the
+ * image. Devices have no 3-channel formats for float or 8-bit data, so 3-channel
+ * types are backed by a single-channel image three times as wide: channel c of
+ * pixel (x, y) is the texel (3x + c, y).
+ */
+public enum ImageFormat {
+
+    // @formatter:off
+    FLOAT(ImageFloat.class, JavaKind.Float, 1, 1),
+    FLOAT3(ImageFloat3.class, JavaKind.Float, 3, 1),
+    FLOAT4(ImageFloat4.class, JavaKind.Float, 4, 4),
+    BYTE3(ImageByte3.class, JavaKind.Byte, 3, 1),
+    BYTE4(ImageByte4.class, JavaKind.Byte, 4, 4);
+    // @formatter:on
+
+    public static final String STORAGE_FIELD = "storage";
+    public static final String WIDTH_FIELD = "X";
+
+    private final Class<?> javaClass;
+    private final JavaKind elementKind;
+    private final int pixelChannels;
+    private final int texelChannels;
+
+    ImageFormat(Class<?> javaClass, JavaKind elementKind, int pixelChannels, int texelChannels) {
+        this.javaClass = javaClass;
+        this.elementKind = elementKind;
+        this.pixelChannels = pixelChannels;
+        this.texelChannels = texelChannels;
+    }
+
+    public Class<?> getJavaClass() {
+        return javaClass;
+    }
+
+    public JavaKind getElementKind() {
+        return elementKind;
+    }
+
+    public int getPixelChannels() {
+        return pixelChannels;
+    }
+
+    /**
+     * Number of channels of each texel of the device image: 1 or 4.
+     */
+    public int getTexelChannels() {
+        return texelChannels;
+    }
+
+    /**
+     * Whether the channels of a pixel are spread over consecutive texels of a
+     * single-channel image.
+     */
+    public boolean isSplitPixel() {
+        return pixelChannels != texelChannels;
+    }
+
+    /**
+     * Width of the device image, in texels, for an image X pixels wide.
+     */
+    public int getTexelWidth(int width) {
+        return width * pixelChannels / texelChannels;
+    }
+
+    public static ImageFormat fromClass(Class<?> klass) {
+        for (ImageFormat format : values()) {
+            if (format.javaClass == klass) {
+                return format;
+            }
+        }
+        return null;
+    }
+
+    public static ImageFormat fromJavaName(String name) {
+        for (ImageFormat format : values()) {
+            if (format.javaClass.getName().equals(name)) {
+                return format;
+            }
+        }
+        return null;
+    }
+
+    /**
+     * @return the format of the object, or null if it is not bound to a device
+     *         image.
+     */
+    public static ImageFormat of(Object object) {
+        return TornadoOptions.USE_IMAGES && object != null ? fromClass(object.getClass()) : null;
+    }
+
+    public static int getWidth(Object image) {
+        switch (fromClass(image.getClass())) {
+            case FLOAT:
+                return ((ImageFloat) image).X();
+            case FLOAT3:
+                return ((ImageFloat3) image).X();
+            case FLOAT4:
+                return ((ImageFloat4) image).X();
+            case BYTE3:
+                return ((ImageByte3) image).X();
+            default:
+                return ((ImageByte4) image).X();
+        }
+    }
+
+    public static int getHeight(Object image) {
+        switch (fromClass(image.getClass())) {
+            case FLOAT:
+                return ((ImageFloat) image).Y();
+            case FLOAT3:
+                return ((ImageFloat3) image).Y();
+            case FLOAT4:
+                return ((ImageFloat4) image).Y();
+            case BYTE3:
+                return ((ImageByte3) image).Y();
+            default:
+                return ((ImageByte4) image).Y();
+        }
+    }
+
+    /**
+     * Returns the argument indexes (the receiver counts as argument zero) of
+     * the parameters of a kernel that are bound to device images. Kernels take
+     * one extra image argument for each of them, in this order.
+     */
+    public static List<Integer> getImageParameterIndexes(ResolvedJavaMethod method) {
+        final List<Integer> indexes = new ArrayList<>();
+        if (!TornadoOptions.USE_IMAGES) {
+            return indexes;
+        }
+        final int offset = method.isStatic() ? 0 : 1;
+        final ResolvedJavaType declaringClass = method.getDeclaringClass();
+        for (int i = 0; i < method.getSignature().getParameterCount(false); i++) {
+            if (fromJavaName(method.getSignature().getParameterType(i, declaringClass).toJavaName()) != null) {
+                indexes.add(i + offset);
+            }
+        }
+        return indexes;
+    }
+}
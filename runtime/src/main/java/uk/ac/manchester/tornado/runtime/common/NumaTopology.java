@@ -0,0 +1,161 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.runtime.common;
+
+import static uk.ac.manchester.tornado.runtime.common.Tornado.debug;
+
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.function.Consumer;
+
+/**
+ * NUMA placement of the devices, read from sysfs. The PCI {@code numa_node}
+ * entry of a device gives its closest node, and the {@code cpulist} entry of
+ * that node gives its local cores.
+ * <p>
+ * The root of the sysfs tree is taken from
+ * {@code -Dtornado.numa.sysfs.root=<path>}, so the topology can be emulated
+ * with fake files, e.g., {@code <path>/bus/pci/devices/0000:3b:00.0/numa_node}
+ * and {@code <path>/devices/system/node/node1/cpulist}.
+ */
+public class NumaTopology {
+
+    public static final int UNKNOWN_NODE = -1;
+
+    private static NumaTopology instance;
+
+    private static final ThreadLocal<Integer> pinnedNode = new ThreadLocal<>();
+
+    private final Path root;
+    private final ConcurrentHashMap<Integer, int[]> cpusPerNode;
+
+    public NumaTopology(Path root) {
+        this.root = root;
+        this.cpusPerNode = new ConcurrentHashMap<>();
+    }
+
+    public static synchronized NumaTopology getInstance() {
+        if (instance == null) {
+            instance = new NumaTopology(Paths.get(TornadoOptions.NUMA_SYSFS_ROOT));
+        }
+        return instance;
+    }
+
+    /**
+     * Builds the sysfs name of a PCI device, e.g., {@code 0000:3b:00.0}.
+     */
+    public static String formatPCIBusId(int domain, int bus, int device, int function) {
+        return String.format("%04x:%02x:%02x.%x", domain, bus, device, function);
+    }
+
+    /**
+     * @return the NUMA node of the PCI device, or {@link #UNKNOWN_NODE} if the
+     *         platform does not report it.
+     */
+    public int getNodeOfPCIDevice(String busId) {
+        if (busId == null) {
+            return UNKNOWN_NODE;
+        }
+        final String value = readLine(root.resolve("bus/pci/devices").resolve(busId.toLowerCase()).resolve("numa_node"));
+        if (value == null) {
+            return UNKNOWN_NODE;
+        }
+        try {
+            // Single-socket machines report -1
+            final int node = Integer.parseInt(value);
+            return (node < 0) ? UNKNOWN_NODE : node;
+        } catch (NumberFormatException e) {
+            return UNKNOWN_NODE;
+        }
+    }
+
+    /**
+     * @return the cores of a NUMA node, or an empty array if they are unknown.
+     */
+    public int[] getCpusOfNode(int node) {
+        if (node < 0) {
+            return new int[0];
+        }
+        return cpusPerNode.computeIfAbsent(node, n -> {
+            final String value = readLine(root.resolve("devices/system/node").resolve("node" + n).resolve("cpulist"));
+            return (value == null) ? new int[0] : parseCpuList(value);
+        });
+    }
+
+    /**
+     * Parses the sysfs list format, e.g., {@code 0-7,16-23}.
+     */
+    public static int[] parseCpuList(String cpuList) {
+        List<Integer> cpus = new ArrayList<>();
+        for (String range : cpuList.trim().split(",")) {
+            if (range.isEmpty()) {
+                continue;
+            }
+            try {
+                String[] bounds = range.split("-");
+                int first = Integer.parseInt(bounds[0].trim());
+                int last = (bounds.length > 1) ? Integer.parseInt(bounds[1].trim()) : first;
+                for (int cpu = first; cpu <= last; cpu++) {
+                    cpus.add(cpu);
+                }
+            } catch (NumberFormatException e) {
+                return new int[0];
+            }
+        }
+        return cpus.stream().mapToInt(Integer::intValue).toArray();
+    }
+
+    /**
+     * Pins the calling thread to the cores of a NUMA node, once per thread. The
+     * affinity itself is set natively by the driver through {@code pinner}.
+     */
+    public void pinCurrentThread(int node, Consumer<int[]> pinner) {
+        if (node < 0 || pinnedNode.get() != null) {
+            return;
+        }
+        final int[] cpus = getCpusOfNode(node);
+        if (cpus.length > 0) {
+            debug("Pinning thread %s to NUMA node %d", Thread.currentThread().getName(), node);
+            pinner.accept(cpus);
+        }
+        pinnedNode.set(node);
+    }
+
+    private static String readLine(Path file) {
+        if (!Files.isReadable(file)) {
+            return null;
+        }
+        try {
+            List<String> lines = Files.readAllLines(file);
+            return lines.isEmpty() ? null : lines.get(0).trim();
+        } catch (IOException e) {
+            return null;
+        }
+    }
+}
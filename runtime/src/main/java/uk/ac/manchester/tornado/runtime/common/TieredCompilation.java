@@ -0,0 +1,91 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.runtime.common;
+
+import static uk.ac.manchester.tornado.runtime.common.Tornado.warn;
+
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.atomic.AtomicReference;
+import java.util.function.Supplier;
+
+/**
+ * Tier-up of a kernel compiled by the quick tier. Once the kernel has been
+ * launched {@link TornadoOptions#TIERED_COMPILATION_THRESHOLD} times, the task
+ * is recompiled with the full optimisation pipeline on a background thread.
+ * The installed code polls for the result on each launch and swaps it in.
+ *
+ * @param <T>
+ *            the optimised code produced by the recompilation.
+ */
+public class TieredCompilation<T> {
+
+    private static final ExecutorService COMPILER_THREAD = Executors.newSingleThreadExecutor(runnable -> {
+        Thread thread = new Thread(runnable, "tornado-tier-up");
+        thread.setDaemon(true);
+        return thread;
+    });
+
+    private final Supplier<T> recompilation;
+    private final AtomicReference<T> optimised;
+    private int launchesBeforeRecompilation;
+    private boolean submitted;
+
+    public TieredCompilation(Supplier<T> recompilation) {
+        this(recompilation, TornadoOptions.TIERED_COMPILATION_THRESHOLD);
+    }
+
+    public TieredCompilation(Supplier<T> recompilation, int threshold) {
+        this.recompilation = recompilation;
+        this.optimised = new AtomicReference<>();
+        this.launchesBeforeRecompilation = threshold;
+    }
+
+    public static boolean isEnabled() {
+        return TornadoOptions.TIERED_COMPILATION;
+    }
+
+    /**
+     * Counts a launch of the quick version and submits the recompilation when
+     * the threshold is reached.
+     *
+     * @return the optimised code the first time it is polled after the
+     *         recompilation has finished, null otherwise.
+     */
+    public T onLaunch() {
+        if (!submitted && --launchesBeforeRecompilation <= 0) {
+            submitted = true;
+            COMPILER_THREAD.execute(this::recompile);
+        }
+        return optimised.getAndSet(null);
+    }
+
+    private void recompile() {
+        try {
+            optimised.set(recompilation.get());
+        } catch (RuntimeException e) {
+            warn("tiered recompilation failed, the quick version is kept: %s", e.getMessage());
+        }
+    }
+}
@@ -25,9 +25,12 @@
  */
 package uk.ac.manchester.tornado.runtime.common;
 
+import java.util.List;
+
 import uk.ac.manchester.tornado.api.common.SchedulableTask;
 import uk.ac.manchester.tornado.api.common.TornadoDevice;
 import uk.ac.manchester.tornado.api.mm.ObjectBuffer;
+import uk.ac.manchester.tornado.api.mm.TornadoDeviceObjectState;
 
 public interface TornadoAcceleratorDevice extends TornadoDevice {
 
@@ -63,4 +66,19 @@ public interface TornadoAcceleratorDevice extends TornadoDevice {
     void enableThreadSharing();
 
     void setAtomicRegion(ObjectBuffer bufferAtomics);
+
+    /**
+     * Checks whether the buffers allocated on the {@code source} device can be
+     * copied into this device directly, without staging them through the host.
+     */
+    boolean isPeerCopySupported(TornadoAcceleratorDevice source);
+
+    /**
+     * It copies the device buffer of an object from the {@code source} device into
+     * this device. The copy is enqueued on this device after the pending commands
+     * of the source device have finished.
+     *
+     * @return List of events of the copy.
+     */
+    List<Integer> copyFromPeer(Object object, TornadoAcceleratorDevice source, TornadoDeviceObjectState sourceState, TornadoDeviceObjectState objectState, int[] events);
 }
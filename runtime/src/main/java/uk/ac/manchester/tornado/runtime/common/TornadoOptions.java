@@ -87,6 +87,31 @@ public class TornadoOptions {
      */
     public final static int PTX_CALL_STACK_LIMIT = Integer.parseInt(getProperty("tornado.ptx.callstack.limit", "8192"));
 
+    /**
+     * Optimisation level (0-4) passed to the CUDA JIT compiler when loading PTX
+     * modules. Default is 4.
+     */
+    public static final int PTX_JIT_OPTIMISATION_LEVEL = Integer.parseInt(getProperty("tornado.ptx.jit.opt", "4"));
+
+    /**
+     * Maximum number of registers per thread the CUDA JIT compiler may use. Zero
+     * leaves the decision to the JIT. Default is 0.
+     */
+    public static final int PTX_JIT_MAX_REGISTERS = Integer.parseInt(getProperty("tornado.ptx.jit.maxregisters", "0"));
+
+    /**
+     * Compilation target of the CUDA JIT compiler, e.g. sm_75. Empty selects the
+     * target of the current context. Default is empty.
+     */
+    public static final String PTX_JIT_TARGET = getProperty("tornado.ptx.jit.target", "");
+
+    /**
+     * Comma-separated register caps, e.g. 32,64,128. Each kernel is JIT compiled
+     * once per cap, each variant is timed on its first launches and the fastest
+     * one is kept. Empty disables the search. Default is empty.
+     */
+    public static final String PTX_JIT_REGISTER_VARIANTS = getProperty("tornado.ptx.jit.registers.variants", "");
+
     /**
      * Prints the generated code by the TornadoVM compiler. Default is False.
      */
@@ -98,21 +123,120 @@ public class TornadoOptions {
     public static final String PRINT_SOURCE_DIRECTORY = getProperty("tornado.print.kernel.dir", "");
 
     /**
-     * Once the internal buffers storing events are full, it will start to circulate
-     * old events and overwrite them with new ones. Default is True.
+     * Sets the array memory alignment for PTX devices. Default is 128 bytes.
      */
-    public static final boolean CIRCULAR_EVENTS = Boolean.parseBoolean(getProperty("tornado.circularevents", "True"));
+    public static final int PTX_ARRAY_ALIGNMENT = Integer.parseInt(getProperty("tornado.ptx.array.align", "128"));
 
     /**
-     * Sets the array memory alignment for PTX devices. Default is 128 bytes.
+     * Limits the grid of PTX kernels with parallel loops to the number of blocks
+     * that can be resident on the device, and lets each thread iterate with a
+     * grid-stride loop over the rest of the domain. Default is True.
      */
-    public static final int PTX_ARRAY_ALIGNMENT = Integer.parseInt(getProperty("tornado.ptx.array.align", "128"));
+    public static final boolean PTX_GRID_STRIDE = getBooleanValue("tornado.ptx.gridstride", "True");
 
     /**
      * Sets the array memory alignment for OpenCL devices. Default is 128 bytes.
      */
     public static final int OPENCL_ARRAY_ALIGNMENT = Integer.parseInt(getProperty("tornado.opencl.array.align", "128"));
 
+    /**
+     * Backs {@code ImageFloat}, {@code ImageFloat3/4} and {@code ImageByte3/4}
+     * arguments with read-only 2D images (OpenCL images or CUDA texture
+     * objects), so that {@code get(x, y)} is served through the texture cache.
+     * Default is False.
+     */
+    public static final boolean USE_IMAGES = getBooleanValue("tornado.images", "False");
+
+    /**
+     * Places small read-only array parameters in constant memory: the OpenCL
+     * {@code __constant} region, or the non-coherent read-only path on PTX.
+     * Default is False.
+     */
+    public static final boolean CONSTANT_PARAMETERS = getBooleanValue("tornado.constant.params", "False");
+
+    /**
+     * Upper bound, in bytes, of the read-only parameters placed in constant
+     * memory by a single task. The device limit applies if it is lower. Default
+     * is 65536.
+     */
+    public static final long CONSTANT_PARAMETERS_MAX_SIZE = Long.parseLong(getProperty("tornado.constant.params.maxsize", "65536"));
+
+    /**
+     * Maps the first thread dimension of a parallel loop nest to the loop whose
+     * index has unit stride in the array subscripts, so that neighbouring
+     * threads access neighbouring elements. Default is True.
+     */
+    public static final boolean COALESCING_ANALYSIS = getBooleanValue("tornado.coalescing", "True");
+
+    /**
+     * Compiles kernels first with a quick tier that leaves out the Graal
+     * optimisations, and recompiles them with the full pipeline on a background
+     * thread once they have been launched a few times. The optimised kernel
+     * replaces the quick one on a later launch. Default is False.
+     */
+    public static final boolean TIERED_COMPILATION = getBooleanValue("tornado.tiered", "False");
+
+    /**
+     * Number of launches of a kernel compiled by the quick tier before its
+     * optimised recompilation starts. Default is 10.
+     */
+    public static final int TIERED_COMPILATION_THRESHOLD = Integer.parseInt(getProperty("tornado.tiered.threshold", "10"));
+
+    /**
+     * Runs the peephole and dataflow passes over the TornadoVM byte-code of each
+     * task-schedule: redundant ADD_DEP and BARRIER byte-codes are removed,
+     * ALLOCATEs are hoisted into a prologue that runs once, and copies are issued
+     * ahead of independent launches. Default is True.
+     */
+    public static final boolean TVM_OPTIMISE_BYTECODES = getBooleanValue("tornado.tvm.optimise", "True");
+
+    /**
+     * Launches the tasks of a task-schedule as a dependency graph. The OpenCL
+     * command queues are out-of-order, and each command waits only on the events
+     * of the commands whose data it uses, so independent tasks may run side by
+     * side on the same device. Default is False.
+     */
+    public static final boolean DAG_SCHEDULER = getBooleanValue("tornado.dag.scheduler", "False");
+
+    /**
+     * Builds the generated kernels of all tasks within a task-schedule as a
+     * single OpenCL program, instead of one program per task. Kernels are created
+     * from the shared program on the first launch. Default is False.
+     */
+    public static final boolean OPENCL_SCHEDULE_PROGRAM = getBooleanValue("tornado.opencl.schedule.program", "False");
+
+    /**
+     * Copies arrays directly between devices when the valid copy of an array
+     * lives on another device of the same driver, instead of staging it through
+     * the host. Default is True.
+     */
+    public static final boolean PEER_COPIES = getBooleanValue("tornado.peer.copies", "True");
+
+    /**
+     * Allocates the pinned host buffers used to stage transfers on the NUMA node
+     * of each device, as reported by sysfs. Default is True.
+     */
+    public static final boolean NUMA_AWARE_STAGING = getBooleanValue("tornado.numa.staging", "True");
+
+    /**
+     * Pins the threads that submit commands to a device, and the driver callback
+     * threads, to the cores of the NUMA node of the device. Default is False.
+     */
+    public static final boolean NUMA_PIN_THREADS = getBooleanValue("tornado.numa.pin.threads", "False");
+
+    /**
+     * Root of the sysfs tree used to discover the NUMA topology. It can point to a
+     * directory with fake topology files for testing. Default is /sys.
+     */
+    public static final String NUMA_SYSFS_ROOT = getProperty("tornado.numa.sysfs.root", "/sys");
+
+    /**
+     * Directory of the persistent sketch cache. When set, sketch summaries and
+     * generated kernels are stored there and reused by later runs. Disabled by
+     * default.
+     */
+    public static final String SKETCH_CACHE_DIR = getProperty("tornado.sketch.cache.dir", "");
+
     /**
      * Enables OpenCL code generation based on a virtual device. Default is False.
      */
@@ -133,6 +257,14 @@ public class TornadoOptions {
         return getBooleanValue("tornado.profiler", "False");
     }
 
+    /**
+     * Times one in N executions of each task-schedule when the profiler is
+     * enabled. The other executions do not wait on their commands or create
+     * timing events, and the profiler keeps the timers of the last sample.
+     * Default is 1, i.e., every execution is timed.
+     */
+    public static final int PROFILER_SAMPLING_INTERVAL = Integer.parseInt(getProperty("tornado.profiler.sampling", "1"));
+
     /**
      * Option to redirect profiler output.
      */
@@ -142,6 +274,19 @@ public class TornadoOptions {
 
     public static final boolean RECOVER_BAILOUT = getBooleanValue("tornado.recover.bailout", "True");
 
+    /**
+     * Remembers the tasks whose compilation bailed out, per method, device and
+     * specialisation, so that later executions run the sequential code without
+     * compiling again. Default is True.
+     */
+    public static final boolean BAILOUT_CACHE = getBooleanValue("tornado.bailout.cache", "True");
+
+    /**
+     * File in which the bailout records are kept across runs. Empty keeps them in
+     * memory only. Default is empty.
+     */
+    public static final String BAILOUT_CACHE_FILE = getProperty("tornado.bailout.cache.file", "");
+
     /**
      * Option to log the IP of the current machine on the profiler logs.
      */
@@ -0,0 +1,112 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.runtime.common;
+
+/**
+ * Work-group sizes chosen by the schedulers of the drivers when the user does
+ * not define the local work.
+ */
+public final class WorkGroupSizes {
+
+    private WorkGroupSizes() {
+    }
+
+    /**
+     * Returns the largest divisor of the global size that does not exceed the
+     * maximum block size. Divisors that are a multiple of the preferred
+     * work-group size multiple of the kernel are chosen first, so that no warp or
+     * wavefront runs partially empty.
+     */
+    public static int groupSize(long maxBlockSize, long globalWorkSize, long preferredMultiple) {
+        if (maxBlockSize == globalWorkSize) {
+            maxBlockSize /= 4;
+        }
+
+        int value = (int) Math.min(maxBlockSize, globalWorkSize);
+        if (value == 0) {
+            return 1;
+        }
+        if (preferredMultiple > 1) {
+            for (long candidate = value - (value % preferredMultiple); candidate >= preferredMultiple; candidate -= preferredMultiple) {
+                if (globalWorkSize % candidate == 0) {
+                    return (int) candidate;
+                }
+            }
+        }
+        while (globalWorkSize % value != 0) {
+            value--;
+        }
+        return value;
+    }
+
+    /**
+     * Maximum number of work-items per dimension of a work-group. The work-group
+     * size limit of the kernel may be lower than the device limit, e.g., when the
+     * kernel uses many registers. For 2D and 3D kernels, the limit applies to the
+     * product of the first two dimensions. It is split evenly between them,
+     * except that the first dimension gets at least the preferred multiple when
+     * the limit allows it; the second dimension then gets what is left.
+     *
+     * @param dims
+     *            number of dimensions of the kernel.
+     * @param maxWorkItemSizes
+     *            maximum work-items per dimension of the device.
+     * @param kernelWorkGroupSize
+     *            work-group size limit of the kernel, or a value lower than 1 if
+     *            unknown.
+     * @param preferredMultiple
+     *            preferred work-group size multiple of the kernel.
+     */
+    public static long[] maxWorkItemSizes(int dims, long[] maxWorkItemSizes, long kernelWorkGroupSize, long preferredMultiple) {
+        long[] intermediates = new long[] { 1, 1, 1 };
+        final long limit = kernelWorkGroupSize > 0 ? kernelWorkGroupSize : Long.MAX_VALUE;
+
+        switch (dims) {
+            case 3:
+                intermediates[2] = (long) Math.sqrt(maxWorkItemSizes[2]);
+                splitLimit(intermediates, maxWorkItemSizes, limit, preferredMultiple);
+                break;
+            case 2:
+                splitLimit(intermediates, maxWorkItemSizes, limit, preferredMultiple);
+                break;
+            case 1:
+                intermediates[0] = Math.min(maxWorkItemSizes[0], limit);
+                break;
+            default:
+                break;
+        }
+        return intermediates;
+    }
+
+    private static void splitLimit(long[] intermediates, long[] maxWorkItemSizes, long limit, long preferredMultiple) {
+        intermediates[1] = (long) Math.sqrt(Math.min(maxWorkItemSizes[1], limit));
+        intermediates[0] = (long) Math.sqrt(Math.min(maxWorkItemSizes[0], limit));
+
+        final long minimumX = Math.min(Math.min(preferredMultiple, maxWorkItemSizes[0]), limit);
+        if (intermediates[0] < minimumX) {
+            intermediates[0] = minimumX;
+            intermediates[1] = Math.max(1, Math.min(intermediates[1], limit / minimumX));
+        }
+    }
+}
@@ -56,6 +56,10 @@ public class IntDomain implements Domain {
         return offset;
     }
 
+    public int getStep() {
+        return step;
+    }
+
     public void setOffset(int offset) {
         this.offset = offset;
     }
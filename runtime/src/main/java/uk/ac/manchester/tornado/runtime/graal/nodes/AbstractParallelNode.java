@@ -54,6 +54,10 @@ public abstract class AbstractParallelNode extends FloatingNode implements Compa
         return index;
     }
 
+    public void setIndex(int index) {
+        this.index = index;
+    }
+
     @Override
     public int compareTo(AbstractParallelNode o) {
         return Integer.compare(index, o.index);
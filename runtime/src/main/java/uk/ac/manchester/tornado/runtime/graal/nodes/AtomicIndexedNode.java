@@ -23,31 +23,70 @@
  * Authors: James Clarkson
  *
  */
-package uk.ac.manchester.tornado.drivers.opencl.graal.nodes;
+package uk.ac.manchester.tornado.runtime.graal.nodes;
 
 import org.graalvm.compiler.core.common.type.StampFactory;
 import org.graalvm.compiler.graph.NodeClass;
+import org.graalvm.compiler.nodeinfo.InputType;
 import org.graalvm.compiler.nodeinfo.NodeInfo;
+import org.graalvm.compiler.nodes.FrameState;
+import org.graalvm.compiler.nodes.StateSplit;
 import org.graalvm.compiler.nodes.ValueNode;
 import org.graalvm.compiler.nodes.java.AccessIndexedNode;
 import org.graalvm.compiler.nodes.spi.Lowerable;
 
 import jdk.vm.ci.meta.JavaKind;
 
-@NodeInfo(shortName = "Atomic Add")
-public class AtomicAddNode extends AccessIndexedNode implements Lowerable {
+/**
+ * Atomic read-modify-write of an array element, introduced by the invocation
+ * plugins of {@link uk.ac.manchester.tornado.api.atomics.TornadoAtomics}.
+ * Each backend lowers it to its own atomic write.
+ */
+@NodeInfo(shortName = "Atomic Indexed")
+public class AtomicIndexedNode extends AccessIndexedNode implements StateSplit, Lowerable {
+
+    public static final NodeClass<AtomicIndexedNode> TYPE = NodeClass.create(AtomicIndexedNode.class);
 
-    public static final NodeClass<AtomicAddNode> TYPE = NodeClass.create(AtomicAddNode.class);
+    public enum AtomicOperation {
+        ADD,
+        MIN,
+        MAX;
+    }
 
     @Input ValueNode value;
+    @OptionalInput(InputType.State) FrameState stateAfter;
 
-    public AtomicAddNode(ValueNode array, ValueNode index, JavaKind elementKind, ValueNode value) {
+    private final AtomicOperation operation;
+
+    public AtomicIndexedNode(ValueNode array, ValueNode index, JavaKind elementKind, ValueNode value, AtomicOperation operation) {
         super(TYPE, StampFactory.forVoid(), array, index, null, elementKind);
         this.value = value;
+        this.operation = operation;
     }
 
     public ValueNode value() {
         return value;
     }
 
+    public AtomicOperation getOperation() {
+        return operation;
+    }
+
+    @Override
+    public FrameState stateAfter() {
+        return stateAfter;
+    }
+
+    @Override
+    public void setStateAfter(FrameState x) {
+        assert x == null || x.isAlive() : "frame state must be in a graph";
+        updateUsages(stateAfter, x);
+        stateAfter = x;
+    }
+
+    @Override
+    public boolean hasSideEffect() {
+        return true;
+    }
+
 }
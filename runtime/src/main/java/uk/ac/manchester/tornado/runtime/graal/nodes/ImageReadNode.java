@@ -0,0 +1,95 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.runtime.graal.nodes;
+
+import org.graalvm.compiler.core.common.type.StampFactory;
+import org.graalvm.compiler.graph.NodeClass;
+import org.graalvm.compiler.nodeinfo.NodeInfo;
+import org.graalvm.compiler.nodes.FixedWithNextNode;
+import org.graalvm.compiler.nodes.ParameterNode;
+import org.graalvm.compiler.nodes.ValueNode;
+import org.graalvm.compiler.nodes.spi.Lowerable;
+
+import uk.ac.manchester.tornado.runtime.common.ImageFormat;
+import uk.ac.manchester.tornado.runtime.graal.phases.MarkImageRead;
+import uk.ac.manchester.tornado.runtime.graal.phases.TornadoImageReadSelection;
+
+/**
+ * Reads one channel of the pixel (x, y) of an image kernel parameter. It is
+ * introduced by the invocation plugins of the image types when
+ * {@link uk.ac.manchester.tornado.runtime.common.TornadoOptions#USE_IMAGES} is
+ * enabled. {@link TornadoImageReadSelection} turns it back into a load from the
+ * storage array where the image cannot be used, and each backend lowers the
+ * remaining ones to a sampled read of the device image.
+ */
+@NodeInfo(shortName = "ImageRead")
+public class ImageReadNode extends FixedWithNextNode implements Lowerable, MarkImageRead {
+
+    public static final NodeClass<ImageReadNode> TYPE = NodeClass.create(ImageReadNode.class);
+
+    @Input ValueNode image;
+    @Input ValueNode x;
+    @Input ValueNode y;
+
+    private final ImageFormat format;
+    private final int channel;
+
+    public ImageReadNode(ValueNode image, ImageFormat format, int channel, ValueNode x, ValueNode y) {
+        super(TYPE, StampFactory.forKind(format.getElementKind()));
+        this.image = image;
+        this.format = format;
+        this.channel = channel;
+        this.x = x;
+        this.y = y;
+    }
+
+    public ValueNode image() {
+        return image;
+    }
+
+    public ValueNode x() {
+        return x;
+    }
+
+    public ValueNode y() {
+        return y;
+    }
+
+    /**
+     * Index of the kernel parameter that holds the image. Only valid once
+     * {@link TornadoImageReadSelection} has kept the read, which requires the
+     * image to be a parameter of the kernel after inlining.
+     */
+    public int getImageIndex() {
+        return ((ParameterNode) image).index();
+    }
+
+    public ImageFormat getFormat() {
+        return format;
+    }
+
+    public int getChannel() {
+        return channel;
+    }
+}
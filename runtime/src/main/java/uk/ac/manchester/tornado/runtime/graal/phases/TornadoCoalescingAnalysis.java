@@ -0,0 +1,186 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.runtime.graal.phases;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+import org.graalvm.compiler.loop.LoopEx;
+import org.graalvm.compiler.loop.LoopsData;
+import org.graalvm.compiler.nodes.LoopBeginNode;
+import org.graalvm.compiler.nodes.PiNode;
+import org.graalvm.compiler.nodes.StructuredGraph;
+import org.graalvm.compiler.nodes.ValueNode;
+import org.graalvm.compiler.nodes.ValuePhiNode;
+import org.graalvm.compiler.nodes.calc.AddNode;
+import org.graalvm.compiler.nodes.calc.BinaryNode;
+import org.graalvm.compiler.nodes.calc.LeftShiftNode;
+import org.graalvm.compiler.nodes.calc.MulNode;
+import org.graalvm.compiler.nodes.calc.SignExtendNode;
+import org.graalvm.compiler.nodes.calc.SubNode;
+import org.graalvm.compiler.nodes.calc.ZeroExtendNode;
+import org.graalvm.compiler.nodes.java.AccessIndexedNode;
+import org.graalvm.compiler.phases.BasePhase;
+
+import uk.ac.manchester.tornado.runtime.common.Tornado;
+import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
+import uk.ac.manchester.tornado.runtime.graal.nodes.ParallelRangeNode;
+import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
+
+/**
+ * It reorders the thread dimensions of a parallel loop nest, so that the
+ * first dimension, whose neighbouring threads run together, is given to the
+ * loop with the most unit-stride array subscripts.
+ *
+ * Each array subscript is split into its additive terms. The induction
+ * variable of a parallel loop has unit stride in a subscript when it appears
+ * as a term on its own, and a larger stride when it appears scaled by a
+ * multiplication or a shift. The dimensions are renumbered before
+ * {@link TornadoShapeAnalysis}, so the domain of the task follows the new
+ * order. Each loop keeps its own thread id, so no code motion is needed to
+ * interchange the loops.
+ */
+public class TornadoCoalescingAnalysis extends BasePhase<TornadoHighTierContext> {
+
+    private static final int MAX_SUBSCRIPT_DEPTH = 8;
+
+    private static boolean isThreadMappingFixed(TaskMetaData meta) {
+        return meta.isWorkerGridAvailable() || meta.isGlobalWorkDefined() || meta.isLocalWorkDefined() || meta.enableThreadCoarsener();
+    }
+
+    @Override
+    protected void run(StructuredGraph graph, TornadoHighTierContext context) {
+        if (!TornadoOptions.COALESCING_ANALYSIS || !context.hasMeta() || isThreadMappingFixed(context.getMeta())) {
+            return;
+        }
+
+        final List<ParallelRangeNode> ranges = graph.getNodes().filter(ParallelRangeNode.class).snapshot();
+        if (ranges.size() < 2) {
+            return;
+        }
+        Collections.sort(ranges);
+
+        final Map<ValueNode, Integer> inductionVariables = new HashMap<>();
+        final List<LoopBeginNode> loopBegins = new ArrayList<>();
+        for (int i = 0; i < ranges.size(); i++) {
+            final List<ValuePhiNode> phis = ranges.get(i).offset().usages().filter(ValuePhiNode.class).snapshot();
+            if (phis.size() != 1 || !(phis.get(0).merge() instanceof LoopBeginNode)) {
+                return;
+            }
+            inductionVariables.put(phis.get(0), i);
+            loopBegins.add((LoopBeginNode) phis.get(0).merge());
+        }
+        if (!isNested(graph, loopBegins)) {
+            return;
+        }
+
+        final int[] scores = new int[ranges.size()];
+        for (AccessIndexedNode access : graph.getNodes().filter(AccessIndexedNode.class)) {
+            final boolean[] unitStride = new boolean[ranges.size()];
+            final boolean[] strided = new boolean[ranges.size()];
+            visitSubscript(access.index(), false, inductionVariables, unitStride, strided, 0);
+            for (int i = 0; i < ranges.size(); i++) {
+                if (unitStride[i] && !strided[i]) {
+                    scores[i]++;
+                } else if (strided[i]) {
+                    scores[i]--;
+                }
+            }
+        }
+
+        int best = 0;
+        for (int i = 1; i < ranges.size(); i++) {
+            if (scores[i] > scores[best]) {
+                best = i;
+            }
+        }
+        if (best == 0) {
+            return;
+        }
+
+        final List<ParallelRangeNode> order = new ArrayList<>(ranges);
+        order.remove(best);
+        order.add(0, ranges.get(best));
+        final int[] indexes = ranges.stream().mapToInt(ParallelRangeNode::index).toArray();
+        for (int i = 0; i < order.size(); i++) {
+            final ParallelRangeNode range = order.get(i);
+            range.setIndex(indexes[i]);
+            range.offset().setIndex(indexes[i]);
+            range.stride().setIndex(indexes[i]);
+        }
+        Tornado.debug("coalescing: parallel loop %d mapped to the first thread dimension", best);
+    }
+
+    /**
+     * Only the dimensions of a single loop nest can be reordered. Parallel loops
+     * that follow each other are left as they are.
+     */
+    private static boolean isNested(StructuredGraph graph, List<LoopBeginNode> loopBegins) {
+        final LoopsData data = new LoopsData(graph);
+        for (int i = 0; i < loopBegins.size(); i++) {
+            for (int j = i + 1; j < loopBegins.size(); j++) {
+                final LoopEx outer = data.loop(loopBegins.get(i));
+                final LoopEx inner = data.loop(loopBegins.get(j));
+                if (outer == null || inner == null || !(outer.inside().nodes().isMarked(loopBegins.get(j)) || inner.inside().nodes().isMarked(loopBegins.get(i)))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    private static void visitSubscript(ValueNode node, boolean scaled, Map<ValueNode, Integer> inductionVariables, boolean[] unitStride, boolean[] strided, int depth) {
+        if (node == null || depth > MAX_SUBSCRIPT_DEPTH) {
+            return;
+        }
+
+        final Integer dimension = inductionVariables.get(node);
+        if (dimension != null) {
+            if (scaled) {
+                strided[dimension] = true;
+            } else {
+                unitStride[dimension] = true;
+            }
+        } else if (node instanceof AddNode || node instanceof SubNode) {
+            final BinaryNode binary = (BinaryNode) node;
+            visitSubscript(binary.getX(), scaled, inductionVariables, unitStride, strided, depth + 1);
+            visitSubscript(binary.getY(), scaled, inductionVariables, unitStride, strided, depth + 1);
+        } else if (node instanceof MulNode) {
+            final MulNode mul = (MulNode) node;
+            visitSubscript(mul.getX(), true, inductionVariables, unitStride, strided, depth + 1);
+            visitSubscript(mul.getY(), true, inductionVariables, unitStride, strided, depth + 1);
+        } else if (node instanceof LeftShiftNode) {
+            visitSubscript(((LeftShiftNode) node).getX(), true, inductionVariables, unitStride, strided, depth + 1);
+        } else if (node instanceof SignExtendNode) {
+            visitSubscript(((SignExtendNode) node).getValue(), scaled, inductionVariables, unitStride, strided, depth + 1);
+        } else if (node instanceof ZeroExtendNode) {
+            visitSubscript(((ZeroExtendNode) node).getValue(), scaled, inductionVariables, unitStride, strided, depth + 1);
+        } else if (node instanceof PiNode) {
+            visitSubscript(((PiNode) node).getOriginalNode(), scaled, inductionVariables, unitStride, strided, depth + 1);
+        }
+    }
+}
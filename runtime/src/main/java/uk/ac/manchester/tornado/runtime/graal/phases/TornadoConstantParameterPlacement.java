@@ -0,0 +1,163 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.runtime.graal.phases;
+
+import static uk.ac.manchester.tornado.runtime.TornadoCoreRuntime.getVMConfig;
+import static uk.ac.manchester.tornado.runtime.common.Tornado.debug;
+
+import java.lang.reflect.Array;
+import java.util.ArrayList;
+import java.util.List;
+
+import org.graalvm.compiler.graph.Node;
+import org.graalvm.compiler.nodes.ParameterNode;
+import org.graalvm.compiler.nodes.PiNode;
+import org.graalvm.compiler.nodes.StructuredGraph;
+import org.graalvm.compiler.nodes.ValueNode;
+import org.graalvm.compiler.nodes.memory.address.AddressNode;
+import org.graalvm.compiler.phases.BasePhase;
+
+import jdk.vm.ci.meta.JavaKind;
+import uk.ac.manchester.tornado.api.common.Access;
+import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
+import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
+
+/**
+ * Moves the accesses of small read-only array parameters to constant memory.
+ *
+ * A parameter is placed when {@link TornadoDataflowAnalysis} has proven it
+ * read-only, it is a primitive array and all the placed parameters of the task
+ * fit in the capacity reported by the backend. The phase runs on the low-tier
+ * graph, once the backend addresses have been built, and records the chosen
+ * parameters in the {@link TaskMetaData} when the runtime has to upload them.
+ */
+public abstract class TornadoConstantParameterPlacement extends BasePhase<TornadoMidTierContext> {
+
+    /**
+     * @return the number of bytes of constant memory available to the task.
+     */
+    protected abstract long getCapacity(TornadoMidTierContext context);
+
+    /**
+     * @return the number of bytes a parameter of the given size takes in
+     *         constant memory, including any padding added by the runtime.
+     */
+    protected long getPlacedSize(long bytes) {
+        return bytes;
+    }
+
+    /**
+     * Moves the given backend address to constant memory.
+     */
+    protected abstract void place(AddressNode address);
+
+    /**
+     * @return true if the placed parameters are read from a separate region,
+     *         so the runtime has to upload them and pass their offsets in the
+     *         frame. Backends that keep reading them in place return false.
+     */
+    protected boolean usesConstantRegion() {
+        return true;
+    }
+
+    @Override
+    protected void run(StructuredGraph graph, TornadoMidTierContext context) {
+        if (!TornadoOptions.CONSTANT_PARAMETERS || context.getMeta() == null || !context.hasArgs()) {
+            return;
+        }
+
+        final TaskMetaData meta = context.getMeta();
+        final Access[] accesses = meta.getArgumentsAccess();
+        final long capacity = Math.min(getCapacity(context), TornadoOptions.CONSTANT_PARAMETERS_MAX_SIZE);
+
+        final List<Integer> placed = new ArrayList<>();
+        long used = 0;
+        for (int i = 0; i < accesses.length && i < context.getNumArgs(); i++) {
+            final ParameterNode param = graph.getParameter(i);
+            if (accesses[i] != Access.READ || param == null) {
+                continue;
+            }
+            final long bytes = getArraySize(context.getArg(i));
+            if (bytes < 0 || used + getPlacedSize(bytes) > capacity || isAliased(context.getArgs(), i)) {
+                continue;
+            }
+            final List<AddressNode> addresses = new ArrayList<>();
+            if (collectAddresses(param, addresses) && !addresses.isEmpty()) {
+                addresses.forEach(this::place);
+                used += getPlacedSize(bytes);
+                placed.add(i);
+                debug("constant placement: parameter %d (%d bytes)", i, bytes);
+            }
+        }
+
+        if (usesConstantRegion()) {
+            meta.setConstantParameters(placed.stream().mapToInt(Integer::intValue).toArray());
+        }
+    }
+
+    /**
+     * @return the size in bytes of the heap copy of a one-dimensional primitive
+     *         array, or -1 for any other object.
+     */
+    private static long getArraySize(Object arg) {
+        if (arg == null || !arg.getClass().isArray() || !arg.getClass().getComponentType().isPrimitive()) {
+            return -1;
+        }
+        final JavaKind kind = JavaKind.fromJavaClass(arg.getClass().getComponentType());
+        return getVMConfig().getArrayBaseOffset(kind) + (long) Array.getLength(arg) * kind.getByteCount();
+    }
+
+    /**
+     * A parameter that is also passed as another argument may be written
+     * through it, so it is not read-only.
+     */
+    private static boolean isAliased(Object[] args, int index) {
+        for (int i = 0; i < args.length; i++) {
+            if (i != index && args[i] == args[index]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Collects the addresses built on top of the parameter. Returns false when
+     * the parameter escapes through any other usage, as the runtime swaps its
+     * frame value for an offset into the constant region.
+     */
+    private static boolean collectAddresses(ValueNode node, List<AddressNode> addresses) {
+        for (Node usage : node.usages()) {
+            if (usage instanceof PiNode) {
+                if (!collectAddresses((PiNode) usage, addresses)) {
+                    return false;
+                }
+            } else if (usage instanceof AddressNode && ((AddressNode) usage).getBase() == node) {
+                addresses.add((AddressNode) usage);
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+}
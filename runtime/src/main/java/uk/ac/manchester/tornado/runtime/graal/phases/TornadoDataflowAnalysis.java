@@ -50,6 +50,7 @@ import org.graalvm.compiler.phases.BasePhase;
 import jdk.vm.ci.meta.Constant;
 import jdk.vm.ci.meta.MetaAccessProvider;
 import uk.ac.manchester.tornado.api.common.Access;
+import uk.ac.manchester.tornado.runtime.graal.nodes.AtomicIndexedNode;
 import uk.ac.manchester.tornado.runtime.graal.nodes.ParallelRangeNode;
 import uk.ac.manchester.tornado.runtime.graal.nodes.StoreAtomicIndexedNode;
 import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
@@ -221,6 +222,12 @@ public class TornadoDataflowAnalysis extends BasePhase<TornadoSketchTierContext>
                 isWrittenTrueCondition = meta.isWrittenTrueCondition();
                 isWrittenFalseCondition = meta.isWrittenFalseCondition();
                 isStored = true;
+            } else if (currentNode instanceof AtomicIndexedNode) {
+                // Atomic updates read the current value of the element
+                isRead = true;
+                isStored = true;
+            } else if (currentNode instanceof MarkImageRead) {
+                isRead = true;
             } else if (isNodeFromKnownObject(currentNode)) {
                 // All objects are passed by reference -> R/W
                 isRead = true;
@@ -0,0 +1,119 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.runtime.graal.phases;
+
+import org.graalvm.compiler.core.common.type.ObjectStamp;
+import org.graalvm.compiler.graph.Node;
+import org.graalvm.compiler.graph.NodeBitMap;
+import org.graalvm.compiler.nodes.CallTargetNode;
+import org.graalvm.compiler.nodes.ConstantNode;
+import org.graalvm.compiler.nodes.Invoke;
+import org.graalvm.compiler.nodes.NodeView;
+import org.graalvm.compiler.nodes.ParameterNode;
+import org.graalvm.compiler.nodes.StructuredGraph;
+import org.graalvm.compiler.nodes.ValueNode;
+import org.graalvm.compiler.nodes.calc.AddNode;
+import org.graalvm.compiler.nodes.calc.MulNode;
+import org.graalvm.compiler.nodes.java.LoadFieldNode;
+import org.graalvm.compiler.nodes.java.LoadIndexedNode;
+import org.graalvm.compiler.nodes.java.StoreFieldNode;
+import org.graalvm.compiler.nodes.java.StoreIndexedNode;
+import org.graalvm.compiler.phases.BasePhase;
+
+import jdk.vm.ci.meta.ResolvedJavaField;
+import jdk.vm.ci.meta.ResolvedJavaType;
+import uk.ac.manchester.tornado.api.exceptions.TornadoInternalError;
+import uk.ac.manchester.tornado.runtime.common.ImageFormat;
+import uk.ac.manchester.tornado.runtime.graal.nodes.AtomicIndexedNode;
+import uk.ac.manchester.tornado.runtime.graal.nodes.ImageReadNode;
+
+/**
+ * Decides which {@link ImageReadNode}s are served by the device image. The
+ * image is a read-only copy of the storage array taken before the launch, so a
+ * kernel that also writes the image, or passes it to a call, would read stale
+ * values through it. Only parameters of the kernel itself are bound to images,
+ * so reads in functions that are not kernels, or through an image that is not
+ * a kernel parameter after inlining, have no image to read from. In these
+ * cases the reads are turned back into loads from the storage array.
+ */
+public class TornadoImageReadSelection extends BasePhase<TornadoHighTierContext> {
+
+    @Override
+    protected void run(StructuredGraph graph, TornadoHighTierContext context) {
+        for (ImageReadNode read : graph.getNodes().filter(ImageReadNode.class).snapshot()) {
+            if (!context.isKernel() || !(read.image() instanceof ParameterNode) || isWritten(read.image(), graph.createNodeBitMap())) {
+                replaceWithArrayLoad(graph, read, context.getMetaAccess().lookupJavaType(read.getFormat().getJavaClass()));
+            }
+        }
+    }
+
+    /**
+     * Conservatively checks whether the object, or any object reached from it,
+     * is written or escapes to a call.
+     */
+    private static boolean isWritten(ValueNode value, NodeBitMap visited) {
+        for (Node usage : value.usages()) {
+            if (visited.isMarked(usage)) {
+                continue;
+            }
+            visited.mark(usage);
+            if (usage instanceof StoreIndexedNode || usage instanceof StoreFieldNode || usage instanceof AtomicIndexedNode || usage instanceof CallTargetNode || usage instanceof Invoke) {
+                return true;
+            }
+            if (usage instanceof ValueNode && ((ValueNode) usage).stamp(NodeView.DEFAULT) instanceof ObjectStamp && isWritten((ValueNode) usage, visited)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    private static ResolvedJavaField lookupField(ResolvedJavaType type, String name) {
+        for (ResolvedJavaField field : type.getInstanceFields(true)) {
+            if (field.getName().equals(name)) {
+                return field;
+            }
+        }
+        throw TornadoInternalError.shouldNotReachHere("field %s not found in %s", name, type.toJavaName());
+    }
+
+    /**
+     * Replaces the read with {@code storage[(y * X + x) * channels + channel]}.
+     */
+    private static void replaceWithArrayLoad(StructuredGraph graph, ImageReadNode read, ResolvedJavaType imageType) {
+        final ImageFormat format = read.getFormat();
+        LoadFieldNode storage = graph.add(LoadFieldNode.create(graph.getAssumptions(), read.image(), lookupField(imageType, ImageFormat.STORAGE_FIELD)));
+        LoadFieldNode width = graph.add(LoadFieldNode.create(graph.getAssumptions(), read.image(), lookupField(imageType, ImageFormat.WIDTH_FIELD)));
+        graph.addBeforeFixed(read, storage);
+        graph.addBeforeFixed(read, width);
+
+        ValueNode index = graph.addOrUnique(new AddNode(graph.addOrUnique(new MulNode(read.y(), width)), read.x()));
+        if (format.getPixelChannels() > 1) {
+            index = graph.addOrUnique(new MulNode(index, ConstantNode.forInt(format.getPixelChannels(), graph)));
+            index = graph.addOrUnique(new AddNode(index, ConstantNode.forInt(read.getChannel(), graph)));
+        }
+
+        LoadIndexedNode load = graph.add(new LoadIndexedNode(graph.getAssumptions(), storage, index, null, format.getElementKind()));
+        graph.replaceFixedWithFixed(read, load);
+    }
+}
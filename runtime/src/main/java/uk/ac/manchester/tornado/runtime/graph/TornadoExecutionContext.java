@@ -25,6 +25,7 @@
  */
 package uk.ac.manchester.tornado.runtime.graph;
 
+import static uk.ac.manchester.tornado.runtime.common.Tornado.VM_USE_DEPS;
 import static uk.ac.manchester.tornado.runtime.common.Tornado.info;
 
 import java.util.ArrayList;
@@ -41,6 +42,7 @@ import uk.ac.manchester.tornado.api.exceptions.TornadoRuntimeException;
 import uk.ac.manchester.tornado.runtime.common.CallStack;
 import uk.ac.manchester.tornado.runtime.common.RuntimeUtilities;
 import uk.ac.manchester.tornado.runtime.common.TornadoAcceleratorDevice;
+import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
 import uk.ac.manchester.tornado.runtime.tasks.LocalObjectState;
 import uk.ac.manchester.tornado.runtime.tasks.meta.ScheduleMetaData;
 
@@ -343,4 +345,12 @@ public class TornadoExecutionContext {
     public boolean useDefaultThreadScheduler() {
         return defaultScheduler;
     }
+
+    /**
+     * Whether the commands of the task-schedule wait on the events of the
+     * commands they depend on, instead of relying on an in-order queue.
+     */
+    public boolean useDependencies() {
+        return meta().enableOooExecution() || VM_USE_DEPS || TornadoOptions.DAG_SCHEDULER;
+    }
 }
@@ -76,6 +76,10 @@ public class TornadoGraphAssembler {
         return buffer.position();
     }
 
+    void position(int position) {
+        buffer.position(position);
+    }
+
     void begin() {
         buffer.put(TornadoVMBytecodes.BEGIN.value);
     }
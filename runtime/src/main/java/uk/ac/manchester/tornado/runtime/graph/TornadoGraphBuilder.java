@@ -25,6 +25,8 @@
  */
 package uk.ac.manchester.tornado.runtime.graph;
 
+import static uk.ac.manchester.tornado.runtime.common.Tornado.warn;
+
 import java.nio.ByteBuffer;
 import java.util.List;
 import java.util.Objects;
@@ -80,6 +82,15 @@ public class TornadoGraphBuilder {
         return ((ContextOpNode) arg).getContext().getUses().size() != 1 && contextNode.getDeviceIndex() != ((ContextOpNode) arg).getContext().getDeviceIndex();
     }
 
+    /**
+     * Data transfers follow the access of each parameter, as computed by the
+     * dataflow analysis of the tasks, so a transfer requested by the user may
+     * be skipped.
+     */
+    private static void warnMisdeclared(TornadoExecutionContext graphContext, Object object, String transfer, String reason) {
+        warn("%s() of %s in schedule %s is skipped: %s", transfer, object.getClass().getSimpleName(), graphContext.getId(), reason);
+    }
+
     public static TornadoGraph buildGraph(TornadoExecutionContext graphContext, ByteBuffer buffer) {
         TornadoGraph graph = new TornadoGraph();
         Access[] accesses = null;
@@ -122,6 +133,9 @@ public class TornadoGraphBuilder {
                 final AbstractNode arg = objectNodes[variableIndex];
                 if (!(arg instanceof ContextOpNode)) {
                     if (Objects.requireNonNull(accesses)[argIndex] == Access.WRITE) {
+                        if (states.get(variableIndex).isStreamIn()) {
+                            warnMisdeclared(graphContext, objects.get(variableIndex), "streamIn", "the first task that uses it only writes it");
+                        }
                         createAllocateNode(context, graph, arg, args, argIndex);
                     } else {
                         final ObjectNode objectNode = (ObjectNode) arg;
@@ -205,6 +219,8 @@ public class TornadoGraphBuilder {
                     copyOutNode.setValue(readNode);
                     graph.add(copyOutNode);
                     context.addUse(copyOutNode);
+                } else {
+                    warnMisdeclared(graphContext, objects.get(i), "streamOut", "no task writes it");
                 }
             } else if (states.get(i).isStreamIn() && objectNodes[i] instanceof ObjectNode) {
                 final StreamInNode streamInNode = new StreamInNode(context);
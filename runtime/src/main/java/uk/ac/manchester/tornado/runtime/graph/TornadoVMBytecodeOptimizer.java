@@ -0,0 +1,386 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.runtime.graph;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.ArrayList;
+import java.util.BitSet;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.Iterator;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+
+import uk.ac.manchester.tornado.api.exceptions.TornadoInternalError;
+import uk.ac.manchester.tornado.runtime.graph.TornadoGraphAssembler.TornadoVMBytecodes;
+
+/**
+ * Peephole and dataflow passes over the TornadoVM byte-code emitted by
+ * {@link TornadoVMGraphCompiler}. The passes follow the semantics of the
+ * interpreter in {@link uk.ac.manchester.tornado.runtime.TornadoVM}:
+ * <ul>
+ * <li>ADD_DEP records the event of the last ALLOCATE, COPY_IN, STREAM_IN,
+ * STREAM_OUT or LAUNCH.</li>
+ * <li>Every byte-code that waits on an event list resets it.</li>
+ * </ul>
+ * The passes are:
+ * <ul>
+ * <li>ADD_DEPs that record no event, record the same event twice, or feed an
+ * event list that is never waited on are removed.</li>
+ * <li>A BARRIER right before END, or right after another BARRIER on the same
+ * list, is removed. The interpreter already enqueues a marker at END.</li>
+ * <li>Identical adjacent transfers of the same object are merged.</li>
+ * <li>ALLOCATEs are hoisted to the start of the program, so that the
+ * interpreter can run them once as a prologue.</li>
+ * <li>COPY_IN and STREAM_IN without dependencies are moved, with their
+ * ADD_DEPs, ahead of the launches that do not use the object, so that the
+ * transfers are enqueued earlier.</li>
+ * </ul>
+ */
+public final class TornadoVMBytecodeOptimizer {
+
+    private static final int SETUP_SIZE = 13;
+    private static final int CONTEXT_SIZE = 5;
+    private static final int ALLOCATE_SIZE = 17;
+    private static final int TRANSFER_SIZE = 29;
+    private static final int LAUNCH_SIZE = 37;
+    private static final int ARGUMENT_SIZE = 5;
+    private static final int EVENT_LIST_SIZE = 5;
+
+    private static final class Instruction {
+        private final byte op;
+        private final byte[] bytes;
+        private final int object;
+        private final int context;
+        private final int eventList;
+        private final long offset;
+        private final long size;
+        private final BitSet references;
+
+        private Instruction(byte op, byte[] bytes, int object, int context, int eventList, long offset, long size, BitSet references) {
+            this.op = op;
+            this.bytes = bytes;
+            this.object = object;
+            this.context = context;
+            this.eventList = eventList;
+            this.offset = offset;
+            this.size = size;
+            this.references = references;
+        }
+
+        private boolean is(TornadoVMBytecodes bytecode) {
+            return op == bytecode.value();
+        }
+
+        private boolean isCopy() {
+            return is(TornadoVMBytecodes.COPY_IN) || is(TornadoVMBytecodes.STREAM_IN);
+        }
+
+        private boolean isTransfer() {
+            return isCopy() || is(TornadoVMBytecodes.STREAM_OUT) || is(TornadoVMBytecodes.STREAM_OUT_BLOCKING);
+        }
+
+        private boolean usesObject(int index) {
+            if (is(TornadoVMBytecodes.LAUNCH)) {
+                return references.get(index);
+            }
+            return object == index;
+        }
+
+        private boolean sameTransfer(Instruction other) {
+            return object == other.object && context == other.context && eventList == other.eventList && offset == other.offset && size == other.size;
+        }
+    }
+
+    private TornadoVMBytecodeOptimizer() {
+    }
+
+    /**
+     * Optimises the program held in {@code code} in place.
+     *
+     * @param code
+     *            TornadoVM byte-code, from SETUP to END.
+     * @param codeSize
+     *            number of bytes in use.
+     * @return the number of bytes in use after the optimisation.
+     */
+    static int optimise(byte[] code, int codeSize) {
+        final ByteBuffer buffer = ByteBuffer.wrap(code, 0, codeSize);
+        buffer.order(ByteOrder.LITTLE_ENDIAN);
+
+        final int prologueSize = skipPrologue(buffer);
+        final List<Instruction> body = decodeBody(buffer);
+
+        removeRedundantBarriers(body);
+        mergeAdjacentTransfers(body);
+        removeRedundantDependencies(body);
+        hoistAllocations(body);
+        scheduleCopiesEarly(body);
+
+        buffer.clear();
+        buffer.position(prologueSize);
+        for (Instruction instruction : body) {
+            buffer.put(instruction.bytes);
+        }
+        buffer.put(TornadoVMBytecodes.END.value());
+        return buffer.position();
+    }
+
+    private static int skipPrologue(ByteBuffer buffer) {
+        TornadoInternalError.guarantee(buffer.get(0) == TornadoVMBytecodes.SETUP.value(), "invalid code");
+        int position = SETUP_SIZE;
+        while (buffer.get(position) == TornadoVMBytecodes.CONTEXT.value()) {
+            position += CONTEXT_SIZE;
+        }
+        TornadoInternalError.guarantee(buffer.get(position) == TornadoVMBytecodes.BEGIN.value(), "invalid code: 0x%x", buffer.get(position));
+        position++;
+        buffer.position(position);
+        return position;
+    }
+
+    private static List<Instruction> decodeBody(ByteBuffer buffer) {
+        final List<Instruction> body = new ArrayList<>();
+        while (buffer.hasRemaining()) {
+            final int start = buffer.position();
+            final byte op = buffer.get();
+            if (op == TornadoVMBytecodes.END.value()) {
+                break;
+            }
+            int object = -1;
+            int context = -1;
+            int eventList = -1;
+            long offset = 0;
+            long size = 0;
+            BitSet references = null;
+            int length;
+            if (op == TornadoVMBytecodes.ALLOCATE.value()) {
+                object = buffer.getInt();
+                context = buffer.getInt();
+                size = buffer.getLong();
+                length = ALLOCATE_SIZE;
+            } else if (op == TornadoVMBytecodes.COPY_IN.value() || op == TornadoVMBytecodes.STREAM_IN.value() || op == TornadoVMBytecodes.STREAM_OUT.value()
+                    || op == TornadoVMBytecodes.STREAM_OUT_BLOCKING.value()) {
+                object = buffer.getInt();
+                context = buffer.getInt();
+                eventList = buffer.getInt();
+                offset = buffer.getLong();
+                size = buffer.getLong();
+                length = TRANSFER_SIZE;
+            } else if (op == TornadoVMBytecodes.LAUNCH.value()) {
+                buffer.getInt();
+                context = buffer.getInt();
+                buffer.getInt();
+                final int numArgs = buffer.getInt();
+                eventList = buffer.getInt();
+                offset = buffer.getLong();
+                size = buffer.getLong();
+                references = new BitSet();
+                for (int i = 0; i < numArgs; i++) {
+                    final byte argType = buffer.get();
+                    final int argIndex = buffer.getInt();
+                    if (argType == TornadoVMBytecodes.REFERENCE_ARGUMENT.value()) {
+                        references.set(argIndex);
+                    }
+                }
+                length = LAUNCH_SIZE + numArgs * ARGUMENT_SIZE;
+            } else if (op == TornadoVMBytecodes.ADD_DEP.value() || op == TornadoVMBytecodes.BARRIER.value()) {
+                eventList = buffer.getInt();
+                length = EVENT_LIST_SIZE;
+            } else {
+                throw TornadoInternalError.shouldNotReachHere("invalid TornadoVM byte-code: 0x%x", op);
+            }
+            final byte[] bytes = new byte[length];
+            buffer.position(start);
+            buffer.get(bytes);
+            body.add(new Instruction(op, bytes, object, context, eventList, offset, size, references));
+        }
+        return body;
+    }
+
+    private static boolean waitsOn(Instruction instruction, int eventList) {
+        return !instruction.is(TornadoVMBytecodes.ADD_DEP) && !instruction.is(TornadoVMBytecodes.ALLOCATE) && instruction.eventList == eventList;
+    }
+
+    private static boolean isEventWaitedOn(List<Instruction> body, int from, int eventList) {
+        for (int i = from; i < body.size(); i++) {
+            if (waitsOn(body.get(i), eventList)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Replays the event lists of the interpreter and drops the ADD_DEPs that do
+     * not add a new event to a list that is waited on later.
+     */
+    private static void removeRedundantDependencies(List<Instruction> body) {
+        final Map<Integer, Set<Instruction>> pending = new HashMap<>();
+        Instruction lastEvent = null;
+        for (int i = 0; i < body.size(); i++) {
+            final Instruction instruction = body.get(i);
+            if (instruction.is(TornadoVMBytecodes.ADD_DEP)) {
+                final Set<Instruction> events = pending.computeIfAbsent(instruction.eventList, k -> new HashSet<>());
+                if (lastEvent == null || events.contains(lastEvent) || !isEventWaitedOn(body, i + 1, instruction.eventList)) {
+                    body.remove(i--);
+                } else {
+                    events.add(lastEvent);
+                }
+                continue;
+            }
+            if (instruction.eventList != -1 && !instruction.is(TornadoVMBytecodes.ALLOCATE)) {
+                pending.remove(instruction.eventList);
+            }
+            if (instruction.is(TornadoVMBytecodes.ALLOCATE)) {
+                // ALLOCATE does not produce an event
+                lastEvent = null;
+            } else if (instruction.isCopy() || instruction.is(TornadoVMBytecodes.LAUNCH) || instruction.is(TornadoVMBytecodes.STREAM_OUT)) {
+                lastEvent = instruction;
+            }
+        }
+    }
+
+    private static void removeRedundantBarriers(List<Instruction> body) {
+        for (int i = body.size() - 1; i >= 0; i--) {
+            final Instruction instruction = body.get(i);
+            if (!instruction.is(TornadoVMBytecodes.BARRIER)) {
+                continue;
+            }
+            final boolean beforeEnd = i == body.size() - 1;
+            final boolean repeated = i > 0 && body.get(i - 1).is(TornadoVMBytecodes.BARRIER) && body.get(i - 1).eventList == instruction.eventList;
+            if (beforeEnd || repeated) {
+                body.remove(i);
+            }
+        }
+    }
+
+    /**
+     * A repeated input transfer finds the object already on the device, and a
+     * repeated output transfer copies the same data back. For inputs, the first
+     * transfer is kept, since the second one waits on an empty list. For outputs,
+     * the last one is kept, since its event is the one seen by the next ADD_DEP.
+     */
+    private static void mergeAdjacentTransfers(List<Instruction> body) {
+        for (int i = 1; i < body.size(); i++) {
+            final Instruction previous = body.get(i - 1);
+            final Instruction current = body.get(i);
+            if (!current.isTransfer() || current.op != previous.op || !previous.sameTransfer(current)) {
+                continue;
+            }
+            if (current.isCopy()) {
+                body.remove(i--);
+            } else {
+                body.remove(--i);
+            }
+        }
+    }
+
+    /**
+     * Moves the ALLOCATEs to the start of the program, with the whole-object
+     * allocations first. Objects allocated with different sizes (batches) keep
+     * their ALLOCATEs in place.
+     */
+    private static void hoistAllocations(List<Instruction> body) {
+        final Map<Integer, Instruction> allocations = new HashMap<>();
+        final Set<Integer> resized = new HashSet<>();
+        for (Instruction instruction : body) {
+            if (instruction.is(TornadoVMBytecodes.ALLOCATE)) {
+                final Instruction first = allocations.putIfAbsent(instruction.object, instruction);
+                if (first != null && (first.context != instruction.context || first.size != instruction.size)) {
+                    resized.add(instruction.object);
+                }
+            }
+        }
+
+        final List<Instruction> wholeObjects = new ArrayList<>();
+        final List<Instruction> batches = new ArrayList<>();
+        final Set<Integer> hoisted = new HashSet<>();
+        for (Iterator<Instruction> it = body.iterator(); it.hasNext();) {
+            final Instruction instruction = it.next();
+            if (!instruction.is(TornadoVMBytecodes.ALLOCATE) || resized.contains(instruction.object)) {
+                continue;
+            }
+            it.remove();
+            if (hoisted.add(instruction.object)) {
+                (instruction.size == 0 ? wholeObjects : batches).add(instruction);
+            }
+        }
+        body.addAll(0, batches);
+        body.addAll(0, wholeObjects);
+    }
+
+    /**
+     * Moves each COPY_IN and STREAM_IN that does not wait on an event list, with
+     * the ADD_DEPs that record its event, ahead of the preceding LAUNCH and
+     * STREAM_OUT byte-codes that do not use the same object. Each of those moves
+     * with its own ADD_DEPs, so every ADD_DEP still follows the byte-code whose
+     * event it records.
+     */
+    private static void scheduleCopiesEarly(List<Instruction> body) {
+        for (int i = 1; i < body.size(); i++) {
+            final Instruction copy = body.get(i);
+            if (!copy.isCopy() || copy.eventList != -1) {
+                continue;
+            }
+            int end = i + 1;
+            final BitSet eventLists = new BitSet();
+            while (end < body.size() && body.get(end).is(TornadoVMBytecodes.ADD_DEP)) {
+                eventLists.set(body.get(end).eventList);
+                end++;
+            }
+
+            int target = i;
+            while (target > 0) {
+                int start = target - 1;
+                while (start >= 0 && body.get(start).is(TornadoVMBytecodes.ADD_DEP)) {
+                    start--;
+                }
+                if (start < 0 || !canMoveAbove(copy, eventLists, body.get(start))) {
+                    break;
+                }
+                target = start;
+            }
+
+            if (target != i) {
+                final List<Instruction> group = new ArrayList<>(body.subList(i, end));
+                body.subList(i, end).clear();
+                body.addAll(target, group);
+            }
+            i = end - 1;
+        }
+    }
+
+    private static boolean canMoveAbove(Instruction copy, BitSet eventLists, Instruction previous) {
+        if (!previous.is(TornadoVMBytecodes.LAUNCH) && !previous.is(TornadoVMBytecodes.STREAM_OUT)) {
+            return false;
+        }
+        if (previous.eventList != -1 && eventLists.get(previous.eventList)) {
+            // the copy must not feed an event list that is consumed before its old position
+            return false;
+        }
+        return previous.context == copy.context && !previous.usesObject(copy.object);
+    }
+}
@@ -115,6 +115,11 @@ public class TornadoVMGraphCompilationResult {
         bitcodeASM.addDependency(dep);
     }
 
+    void optimise() {
+        final int codeSize = TornadoVMBytecodeOptimizer.optimise(code, getCodeSize());
+        bitcodeASM.position(codeSize);
+    }
+
     public void dump() {
         bitcodeASM.dump();
     }
@@ -41,11 +41,15 @@ import org.graalvm.compiler.nodes.StructuredGraph;
 
 import uk.ac.manchester.tornado.api.exceptions.TornadoRuntimeException;
 import uk.ac.manchester.tornado.runtime.common.Tornado;
+import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
 import uk.ac.manchester.tornado.runtime.graal.nodes.ParallelRangeNode;
 import uk.ac.manchester.tornado.runtime.graph.TornadoGraphAssembler.TornadoVMBytecodes;
 import uk.ac.manchester.tornado.runtime.graph.nodes.AbstractNode;
+import uk.ac.manchester.tornado.runtime.graph.nodes.AllocateNode;
 import uk.ac.manchester.tornado.runtime.graph.nodes.ContextOpNode;
+import uk.ac.manchester.tornado.runtime.graph.nodes.CopyInNode;
 import uk.ac.manchester.tornado.runtime.graph.nodes.DependentReadNode;
+import uk.ac.manchester.tornado.runtime.graph.nodes.StreamInNode;
 import uk.ac.manchester.tornado.runtime.graph.nodes.TaskNode;
 
 public class TornadoVMGraphCompiler {
@@ -152,17 +156,25 @@ public class TornadoVMGraphCompiler {
         final BitSet tasks = new BitSet(asyncNodes.cardinality());
         final int[] nodeIds = new int[asyncNodes.cardinality()];
         int index = 0;
-        int numDepLists = 0;
         for (int i = asyncNodes.nextSetBit(0); i != -1 && i < asyncNodes.length(); i = asyncNodes.nextSetBit(i + 1)) {
             dependencies[index] = calculateDeps(graph, i);
             nodeIds[index] = i;
             if (graph.getNode(i) instanceof TaskNode) {
                 tasks.set(index);
             }
-            if (!dependencies[index].isEmpty()) {
+            index++;
+        }
+
+        final boolean useDependencies = context.useDependencies();
+        if (useDependencies) {
+            addAntiDependencies(graph, nodeIds, dependencies, tasks);
+        }
+
+        int numDepLists = 0;
+        for (BitSet dependency : dependencies) {
+            if (!dependency.isEmpty()) {
                 numDepLists++;
             }
-            index++;
         }
 
         // Generate BEGIN bytecode
@@ -179,10 +191,17 @@ public class TornadoVMGraphCompiler {
             long nthreads = batchSize / sizeBatch.getNumBytesType();
             for (int i = 0; i < sizeBatch.getTotalChunks(); i++) {
                 offset = (batchSize * i);
+                if (useDependencies && i > 0) {
+                    // Chunks reuse the same device buffers
+                    result.barrier(numDepLists);
+                }
                 scheduleAndEmitTornadoVMBytecodes(result, graph, nodeIds, dependencies, offset, batchSize, nthreads);
             }
             // Last chunk
             if (sizeBatch.getRemainingChunkSize() != 0) {
+                if (useDependencies && sizeBatch.getTotalChunks() > 0) {
+                    result.barrier(numDepLists);
+                }
                 offset += (batchSize);
                 nthreads = sizeBatch.getRemainingChunkSize() / sizeBatch.getNumBytesType();
                 long realBatchSize = sizeBatch.getTotalChunks() == 0 ? 0 : sizeBatch.getRemainingChunkSize();
@@ -201,6 +220,10 @@ public class TornadoVMGraphCompiler {
         // Generate END bytecode
         result.end();
 
+        if (TornadoOptions.TVM_OPTIMISE_BYTECODES) {
+            result.optimise();
+        }
+
         return result;
     }
 
@@ -318,6 +341,51 @@ public class TornadoVMGraphCompiler {
         }
     }
 
+    /**
+     * The graph only links a task to the tasks that produce its inputs. When the
+     * commands run out of order, a task that writes an object must also wait for
+     * the earlier tasks that read the previous version of it.
+     */
+    private static void addAntiDependencies(TornadoGraph graph, int[] nodeIds, BitSet[] dependencies, BitSet tasks) {
+        final HashMap<TaskNode, BitSet> writes = new HashMap<>();
+        final BitSet dependentReads = graph.filter(DependentReadNode.class);
+        for (int i = dependentReads.nextSetBit(0); i != -1; i = dependentReads.nextSetBit(i + 1)) {
+            final DependentReadNode readNode = (DependentReadNode) graph.getNode(i);
+            if (readNode.getValue() != null) {
+                writes.computeIfAbsent(readNode.getDependent(), k -> new BitSet()).set(readNode.getValue().getIndex());
+            }
+        }
+
+        for (int j = tasks.nextSetBit(0); j != -1; j = tasks.nextSetBit(j + 1)) {
+            final BitSet written = writes.get(graph.getNode(nodeIds[j]));
+            if (written == null) {
+                continue;
+            }
+            for (int i = tasks.nextSetBit(0); i != -1 && i < j; i = tasks.nextSetBit(i + 1)) {
+                if (referencedObjects((TaskNode) graph.getNode(nodeIds[i])).intersects(written)) {
+                    dependencies[j].set(nodeIds[i]);
+                }
+            }
+        }
+    }
+
+    private static BitSet referencedObjects(TaskNode taskNode) {
+        final BitSet objects = new BitSet();
+        for (int i = 0; i < taskNode.getNumArgs(); i++) {
+            final AbstractNode argNode = taskNode.getArg(i);
+            if (argNode instanceof CopyInNode) {
+                objects.set(((CopyInNode) argNode).getValue().getIndex());
+            } else if (argNode instanceof StreamInNode) {
+                objects.set(((StreamInNode) argNode).getValue().getIndex());
+            } else if (argNode instanceof AllocateNode) {
+                objects.set(((AllocateNode) argNode).getValue().getIndex());
+            } else if (argNode instanceof DependentReadNode && ((DependentReadNode) argNode).getValue() != null) {
+                objects.set(((DependentReadNode) argNode).getValue().getIndex());
+            }
+        }
+        return objects;
+    }
+
     private static BitSet calculateDeps(TornadoGraph graph, int i) {
         final BitSet deps = new BitSet(graph.getValid().length());
         final AbstractNode node = graph.getNode(i);
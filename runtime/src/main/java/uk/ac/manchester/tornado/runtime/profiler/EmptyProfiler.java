@@ -36,6 +36,10 @@ public class EmptyProfiler implements TornadoProfiler {
     public void addValueToMetric(ProfilerType type, String taskName, long value) {
     }
 
+    @Override
+    public void setMetric(ProfilerType type, String taskName, long value) {
+    }
+
     @Override
     public void start(ProfilerType type) {
     }
@@ -57,6 +61,10 @@ public class EmptyProfiler implements TornadoProfiler {
     public void registerMethodHandle(ProfilerType type, String taskName, String methodName) {
     }
 
+    @Override
+    public void registerMetaData(ProfilerType type, String value) {
+    }
+
     @Override
     public void stop(ProfilerType type) {
     }
@@ -0,0 +1,82 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.runtime.profiler;
+
+import java.util.function.Function;
+
+import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
+
+/**
+ * Selects the executions of a task-schedule that the profiler times. Only one
+ * in {@link TornadoOptions#PROFILER_SAMPLING_INTERVAL} executions waits on the
+ * events of its commands and reads their timestamps; the others run without
+ * the profiling overhead. The drivers check {@link #isTimed()} before creating
+ * timing events or reading profiling information.
+ */
+public final class ProfilerSampler {
+
+    private static final ThreadLocal<Boolean> TIMED = ThreadLocal.withInitial(() -> Boolean.TRUE);
+
+    private final int interval;
+    private long executions;
+
+    public ProfilerSampler(int interval) {
+        this.interval = Math.max(interval, 1);
+    }
+
+    /**
+     * Whether the commands enqueued by the current thread are timed.
+     */
+    public static boolean isTimed() {
+        return TornadoOptions.isProfilerEnabled() && TIMED.get();
+    }
+
+    /**
+     * Runs an execution of the task-schedule on the current thread. The
+     * execution is told whether it is sampled. The commands that the thread
+     * enqueues afterwards are timed again, also when the execution throws.
+     */
+    public <T> T execute(Function<Boolean, T> execution) {
+        final boolean sampled = executions % interval == 0;
+        executions++;
+        TIMED.set(sampled);
+        try {
+            return execution.apply(sampled);
+        } finally {
+            TIMED.set(Boolean.TRUE);
+        }
+    }
+
+    /**
+     * Number of executions that each sample stands for. The timers of a sample
+     * multiplied by this value estimate the totals over all executions.
+     */
+    public int getWeight() {
+        return interval;
+    }
+
+    public boolean isSampling() {
+        return interval > 1;
+    }
+}
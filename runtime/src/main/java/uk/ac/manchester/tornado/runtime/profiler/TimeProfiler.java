@@ -37,6 +37,7 @@ public class TimeProfiler implements TornadoProfiler {
     private HashMap<String, HashMap<ProfilerType, Long>> taskThroughputMetrics;
     private HashMap<String, HashMap<ProfilerType, String>> taskDeviceIdentifiers;
     private HashMap<String, HashMap<ProfilerType, String>> taskMethodNames;
+    private HashMap<ProfilerType, String> metaData;
 
     private StringBuffer indent;
 
@@ -46,6 +47,7 @@ public class TimeProfiler implements TornadoProfiler {
         taskDeviceIdentifiers = new HashMap<>();
         taskMethodNames = new HashMap<>();
         taskThroughputMetrics = new HashMap<>();
+        metaData = new HashMap<>();
         indent = new StringBuffer("");
     }
 
@@ -59,6 +61,14 @@ public class TimeProfiler implements TornadoProfiler {
         taskThroughputMetrics.put(taskName, profilerType);
     }
 
+    @Override
+    public void setMetric(ProfilerType type, String taskName, long value) {
+        if (!taskThroughputMetrics.containsKey(taskName)) {
+            taskThroughputMetrics.put(taskName, new HashMap<>());
+        }
+        taskThroughputMetrics.get(taskName).put(type, value);
+    }
+
     @Override
     public void start(ProfilerType type) {
         long start = System.nanoTime();
@@ -106,6 +116,11 @@ public class TimeProfiler implements TornadoProfiler {
         taskDeviceIdentifiers.put(taskName, profilerType);
     }
 
+    @Override
+    public void registerMetaData(ProfilerType type, String value) {
+        metaData.put(type, value);
+    }
+
     @Override
     public void stop(ProfilerType type) {
         long end = System.nanoTime();
@@ -154,6 +169,10 @@ public class TimeProfiler implements TornadoProfiler {
             System.out.println("[PROFILER] " + p.getDescription() + ": " + profilerTime.get(p));
         }
 
+        for (ProfilerType p : metaData.keySet()) {
+            System.out.println("[PROFILER] " + p.getDescription() + ": " + metaData.get(p));
+        }
+
         for (String p : taskTimers.keySet()) {
             System.out.println("[PROFILER-TASK] " + p + ": " + taskTimers.get(p));
 
@@ -185,6 +204,9 @@ public class TimeProfiler implements TornadoProfiler {
         for (ProfilerType p : profilerTime.keySet()) {
             json.append(indent.toString() + "\"" + p + "\"" + ": " + "\"" + profilerTime.get(p) + "\",\n");
         }
+        for (ProfilerType p : metaData.keySet()) {
+            json.append(indent.toString() + "\"" + p + "\"" + ": " + "\"" + metaData.get(p) + "\",\n");
+        }
 
         final int size = taskTimers.keySet().size();
         int counter = 0;
@@ -234,6 +256,7 @@ public class TimeProfiler implements TornadoProfiler {
         taskThroughputMetrics.clear();
         profilerTime.clear();
         taskTimers.clear();
+        metaData.clear();
         indent = new StringBuffer("");
     }
 
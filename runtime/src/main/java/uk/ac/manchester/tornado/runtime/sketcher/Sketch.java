@@ -25,22 +25,38 @@
  */
 package uk.ac.manchester.tornado.runtime.sketcher;
 
+import java.util.function.Supplier;
+
 import org.graalvm.compiler.graph.CachedGraph;
 
-import org.graalvm.compiler.nodes.StructuredGraph;
 import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
 
 public class Sketch {
 
-    private final CachedGraph<?> graph;
+    private CachedGraph<?> graph;
+    private final Supplier<CachedGraph<?>> graphBuilder;
     private final TaskMetaData meta;
 
     Sketch(CachedGraph<?> graph, TaskMetaData meta) {
         this.graph = graph;
+        this.graphBuilder = null;
+        this.meta = meta;
+    }
+
+    /**
+     * Sketch restored from the disk cache: the meta-data is already available
+     * and the graph is only built the first time a backend asks for it.
+     */
+    Sketch(Supplier<CachedGraph<?>> graphBuilder, TaskMetaData meta) {
+        this.graph = null;
+        this.graphBuilder = graphBuilder;
         this.meta = meta;
     }
 
-    public CachedGraph<?> getGraph() {
+    public synchronized CachedGraph<?> getGraph() {
+        if (graph == null && graphBuilder != null) {
+            graph = graphBuilder.get();
+        }
         return graph;
     }
 
@@ -0,0 +1,378 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+package uk.ac.manchester.tornado.runtime.sketcher;
+
+import static uk.ac.manchester.tornado.runtime.TornadoCoreRuntime.getTornadoRuntime;
+import static uk.ac.manchester.tornado.runtime.common.Tornado.debug;
+import static uk.ac.manchester.tornado.runtime.common.Tornado.warn;
+
+import java.io.File;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.lang.reflect.Array;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.nio.file.StandardCopyOption;
+import java.security.CodeSource;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.util.ArrayList;
+import java.util.Collection;
+import java.util.LinkedHashSet;
+import java.util.List;
+import java.util.Properties;
+import java.util.Set;
+import java.util.TreeMap;
+
+import jdk.vm.ci.meta.ResolvedJavaMethod;
+import jdk.vm.ci.meta.ResolvedJavaType;
+import uk.ac.manchester.tornado.api.common.Access;
+import uk.ac.manchester.tornado.api.common.SchedulableTask;
+import uk.ac.manchester.tornado.runtime.TornadoCoreRuntime;
+import uk.ac.manchester.tornado.runtime.common.RuntimeUtilities;
+import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
+import uk.ac.manchester.tornado.runtime.domain.DomainTree;
+import uk.ac.manchester.tornado.runtime.domain.IntDomain;
+import uk.ac.manchester.tornado.runtime.tasks.meta.TaskMetaData;
+
+/**
+ * Persistent cache for the work done by the sketcher and the backends, enabled
+ * with {@code -Dtornado.sketch.cache.dir=<dir>}.
+ *
+ * Graal graphs cannot be serialised across JVM instances, so the cache stores
+ * what the graphs are used for instead:
+ * <ul>
+ * <li>A sketch summary per method: the argument accesses computed by the
+ * sketch tier. With a valid summary, the sketch graph is only built if a
+ * backend has to compile it.</li>
+ * <li>The generated kernel per device and specialisation, together with the
+ * parallel domain discovered during compilation and the parameters placed in
+ * constant memory.</li>
+ * </ul>
+ *
+ * Entries record every method they were derived from with a hash of its
+ * bytecode, plus the identity of the TornadoVM build. An entry is ignored as
+ * soon as any of them changes.
+ */
+public final class SketchDiskCache {
+
+    private static final String FORMAT_VERSION = "2";
+    private static final String SUMMARY_SUFFIX = ".sketch";
+    private static final String KERNEL_SUFFIX = ".kernel";
+
+    private static final String KEY_FORMAT = "format";
+    private static final String KEY_BUILD = "build";
+    private static final String KEY_METHODS = "methods";
+    private static final String KEY_DIGESTS = "digests";
+    private static final String KEY_ACCESSES = "accesses";
+    private static final String KEY_DOMAIN = "domain";
+    private static final String KEY_CONSTANTS = "constants";
+    private static final String KEY_SOURCE = "source";
+
+    private SketchDiskCache() {
+    }
+
+    public static boolean isEnabled() {
+        return !TornadoOptions.SKETCH_CACHE_DIR.isEmpty();
+    }
+
+    /**
+     * Restores the argument accesses of a sketch into {@code meta}.
+     *
+     * @return true if a valid summary was found
+     */
+    static boolean loadSummary(ResolvedJavaMethod method, TaskMetaData meta) {
+        final Properties entry = readEntry(summaryKey(method), SUMMARY_SUFFIX);
+        if (entry == null || !isValid(entry, buildIdentity())) {
+            return false;
+        }
+
+        final String[] accesses = entry.getProperty(KEY_ACCESSES, "").split(",");
+        final Access[] metaAccesses = meta.getArgumentsAccess();
+        if (accesses.length != metaAccesses.length) {
+            return false;
+        }
+        for (int i = 0; i < accesses.length; i++) {
+            metaAccesses[i] = Access.valueOf(accesses[i]);
+        }
+        debug("loaded sketch summary of %s from the disk cache", method.getName());
+        return true;
+    }
+
+    static void storeSummary(ResolvedJavaMethod method, Collection<ResolvedJavaMethod> inlinedMethods, TaskMetaData meta) {
+        final Properties entry = createEntry(method, inlinedMethods, buildIdentity());
+        final List<String> accesses = new ArrayList<>();
+        for (Access access : meta.getArgumentsAccess()) {
+            accesses.add(access.name());
+        }
+        entry.setProperty(KEY_ACCESSES, String.join(",", accesses));
+        writeEntry(summaryKey(method), SUMMARY_SUFFIX, entry);
+    }
+
+    /**
+     * Computes the key of the kernel generated for a task on a given device.
+     * Kernels are specialised on the values of scalar arguments and on the
+     * lengths of arrays, which are therefore part of the key. Tasks with any
+     * other argument (e.g. objects whose fields are folded) are not cached.
+     *
+     * @return the key, or null if the task cannot be cached
+     */
+    public static String kernelKey(SchedulableTask task, ResolvedJavaMethod method, String deviceDescription, long batchThreads) {
+        final StringBuilder key = new StringBuilder();
+        key.append(summaryKey(method)).append('|').append(deviceDescription).append('|').append(batchThreads);
+        key.append('|').append(((TaskMetaData) task.meta()).isFastMathEnabled());
+        for (Object arg : task.getArguments()) {
+            if (arg == null) {
+                key.append("|null");
+            } else if (arg.getClass().isArray()) {
+                key.append('|').append(arg.getClass().getName()).append('[').append(Array.getLength(arg)).append(']');
+            } else if (RuntimeUtilities.isBoxedPrimitiveClass(arg.getClass())) {
+                key.append('|').append(arg.getClass().getName()).append('=').append(arg);
+            } else {
+                return null;
+            }
+        }
+        // Compiler options change the generated code
+        new TreeMap<>(System.getProperties()).forEach((name, value) -> {
+            if (name.toString().startsWith("tornado.")) {
+                key.append('|').append(name).append('=').append(value);
+            }
+        });
+        return digest(key.toString().getBytes(StandardCharsets.UTF_8));
+    }
+
+    /**
+     * Loads a kernel and restores the parallel domain and the constant
+     * parameters of the task.
+     *
+     * @return the kernel source, or null on a miss
+     */
+    public static byte[] loadKernel(String key, TaskMetaData meta, Class<?> backendClass) {
+        final Properties entry = readEntry(key, KERNEL_SUFFIX);
+        if (entry == null || !isValid(entry, buildIdentity(backendClass))) {
+            return null;
+        }
+
+        final String domain = entry.getProperty(KEY_DOMAIN, "");
+        if (!domain.isEmpty()) {
+            final String[] dimensions = domain.split(";");
+            final DomainTree domainTree = new DomainTree(dimensions.length);
+            for (int i = 0; i < dimensions.length; i++) {
+                final String[] values = dimensions[i].split(":");
+                domainTree.set(i, new IntDomain(Integer.parseInt(values[0]), Integer.parseInt(values[1]), Integer.parseInt(values[2])));
+            }
+            meta.setDomain(domainTree);
+        }
+
+        final String constants = entry.getProperty(KEY_CONSTANTS, "");
+        if (!constants.isEmpty()) {
+            final String[] indexes = constants.split(",");
+            final int[] constantParameters = new int[indexes.length];
+            for (int i = 0; i < indexes.length; i++) {
+                constantParameters[i] = Integer.parseInt(indexes[i]);
+            }
+            meta.setConstantParameters(constantParameters);
+        } else {
+            meta.setConstantParameters(null);
+        }
+        return entry.getProperty(KEY_SOURCE).getBytes(StandardCharsets.UTF_8);
+    }
+
+    public static void storeKernel(String key, Collection<ResolvedJavaMethod> methods, byte[] source, TaskMetaData meta, Class<?> backendClass) {
+        final Properties entry = createEntry(null, methods, buildIdentity(backendClass));
+        final DomainTree domainTree = meta.getDomain();
+        final List<String> dimensions = new ArrayList<>();
+        if (domainTree != null) {
+            for (int i = 0; i < domainTree.getDepth(); i++) {
+                if (!(domainTree.get(i) instanceof IntDomain)) {
+                    return;
+                }
+                final IntDomain domain = (IntDomain) domainTree.get(i);
+                dimensions.add(domain.getOffset() + ":" + domain.getStep() + ":" + domain.cardinality());
+            }
+        }
+        entry.setProperty(KEY_DOMAIN, String.join(";", dimensions));
+        final List<String> constants = new ArrayList<>();
+        if (meta.hasConstantParameters()) {
+            for (int index : meta.getConstantParameters()) {
+                constants.add(Integer.toString(index));
+            }
+        }
+        entry.setProperty(KEY_CONSTANTS, String.join(",", constants));
+        entry.setProperty(KEY_SOURCE, new String(source, StandardCharsets.UTF_8));
+        writeEntry(key, KERNEL_SUFFIX, entry);
+    }
+
+    private static String summaryKey(ResolvedJavaMethod method) {
+        return digest(methodName(method).getBytes(StandardCharsets.UTF_8));
+    }
+
+    private static Properties createEntry(ResolvedJavaMethod method, Collection<ResolvedJavaMethod> methods, String build) {
+        final Set<ResolvedJavaMethod> allMethods = new LinkedHashSet<>();
+        if (method != null) {
+            allMethods.add(method);
+        }
+        allMethods.addAll(methods);
+
+        final List<String> names = new ArrayList<>();
+        final List<String> digests = new ArrayList<>();
+        for (ResolvedJavaMethod m : allMethods) {
+            names.add(methodName(m));
+            digests.add(bytecodeDigest(m));
+        }
+
+        final Properties entry = new Properties();
+        entry.setProperty(KEY_FORMAT, FORMAT_VERSION);
+        entry.setProperty(KEY_BUILD, build);
+        entry.setProperty(KEY_METHODS, String.join(",", names));
+        entry.setProperty(KEY_DIGESTS, String.join(",", digests));
+        return entry;
+    }
+
+    private static boolean isValid(Properties entry, String build) {
+        if (!FORMAT_VERSION.equals(entry.getProperty(KEY_FORMAT)) || !build.equals(entry.getProperty(KEY_BUILD))) {
+            return false;
+        }
+        final String[] names = entry.getProperty(KEY_METHODS, "").split(",");
+        final String[] digests = entry.getProperty(KEY_DIGESTS, "").split(",");
+        if (names.length != digests.length) {
+            return false;
+        }
+        for (int i = 0; i < names.length; i++) {
+            final ResolvedJavaMethod method = resolveMethod(names[i]);
+            if (method == null || !digests[i].equals(bytecodeDigest(method))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private static String methodName(ResolvedJavaMethod method) {
+        return method.getDeclaringClass().toJavaName() + "#" + method.getName() + method.getSignature().toMethodDescriptor();
+    }
+
+    private static ResolvedJavaMethod resolveMethod(String name) {
+        final int separator = name.indexOf('#');
+        final int descriptor = name.indexOf('(');
+        if (separator < 0 || descriptor < separator) {
+            return null;
+        }
+        final String className = name.substring(0, separator);
+        final String methodName = name.substring(separator + 1, descriptor);
+        final String signature = name.substring(descriptor);
+        try {
+            ClassLoader loader = Thread.currentThread().getContextClassLoader();
+            final Class<?> klass = Class.forName(className, false, (loader != null) ? loader : ClassLoader.getSystemClassLoader());
+            final ResolvedJavaType type = getTornadoRuntime().getMetaAccess().lookupJavaType(klass);
+            for (ResolvedJavaMethod method : type.getDeclaredMethods()) {
+                if (method.getName().equals(methodName) && method.getSignature().toMethodDescriptor().equals(signature)) {
+                    return method;
+                }
+            }
+            for (ResolvedJavaMethod method : type.getDeclaredConstructors()) {
+                if (method.getName().equals(methodName) && method.getSignature().toMethodDescriptor().equals(signature)) {
+                    return method;
+                }
+            }
+        } catch (ClassNotFoundException | LinkageError e) {
+            debug("sketch cache: unable to resolve %s", name);
+        }
+        return null;
+    }
+
+    private static String bytecodeDigest(ResolvedJavaMethod method) {
+        final byte[] code = method.getCode();
+        return digest((code != null) ? code : new byte[0]);
+    }
+
+    /**
+     * Identifies the TornadoVM build by the location, size and timestamp of the
+     * runtime (and backend) jars.
+     */
+    private static String buildIdentity(Class<?>... classes) {
+        final StringBuilder identity = new StringBuilder(codeSourceIdentity(TornadoCoreRuntime.class));
+        for (Class<?> klass : classes) {
+            identity.append('|').append(codeSourceIdentity(klass));
+        }
+        return digest(identity.toString().getBytes(StandardCharsets.UTF_8));
+    }
+
+    private static String codeSourceIdentity(Class<?> klass) {
+        final CodeSource codeSource = klass.getProtectionDomain().getCodeSource();
+        if (codeSource == null || codeSource.getLocation() == null) {
+            return klass.getName();
+        }
+        try {
+            final File file = new File(codeSource.getLocation().toURI());
+            return file.getAbsolutePath() + ":" + file.length() + ":" + file.lastModified();
+        } catch (Exception e) {
+            return codeSource.getLocation().toString();
+        }
+    }
+
+    private static String digest(byte[] data) {
+        try {
+            final StringBuilder hex = new StringBuilder();
+            for (byte b : MessageDigest.getInstance("SHA-256").digest(data)) {
+                hex.append(String.format("%02x", b));
+            }
+            return hex.toString();
+        } catch (NoSuchAlgorithmException e) {
+            throw new IllegalStateException(e);
+        }
+    }
+
+    private static Properties readEntry(String key, String suffix) {
+        final Path path = Paths.get(TornadoOptions.SKETCH_CACHE_DIR, key + suffix);
+        if (!Files.isRegularFile(path)) {
+            return null;
+        }
+        final Properties entry = new Properties();
+        try (InputStream in = Files.newInputStream(path)) {
+            entry.load(in);
+        } catch (IOException | IllegalArgumentException e) {
+            warn("sketch cache: unable to read %s (%s)", path, e.getMessage());
+            return null;
+        }
+        return entry;
+    }
+
+    private static void writeEntry(String key, String suffix, Properties entry) {
+        final Path directory = Paths.get(TornadoOptions.SKETCH_CACHE_DIR);
+        try {
+            Files.createDirectories(directory);
+            // Write to a temporary file first, so concurrent processes never read a partial entry
+            final Path temporary = Files.createTempFile(directory, key, suffix + ".tmp");
+            try (OutputStream out = Files.newOutputStream(temporary)) {
+                entry.store(out, null);
+            }
+            Files.move(temporary, directory.resolve(key + suffix), StandardCopyOption.REPLACE_EXISTING, StandardCopyOption.ATOMIC_MOVE);
+        } catch (IOException e) {
+            warn("sketch cache: unable to write %s%s (%s)", key, suffix, e.getMessage());
+        }
+    }
+}
@@ -35,11 +35,11 @@ import static uk.ac.manchester.tornado.runtime.TornadoCoreRuntime.getTornadoExec
 import static uk.ac.manchester.tornado.runtime.common.Tornado.fatal;
 import static uk.ac.manchester.tornado.runtime.common.Tornado.info;
 
-import java.util.ArrayList;
 import java.util.HashSet;
 import java.util.List;
 import java.util.Map;
 import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.CopyOnWriteArrayList;
 import java.util.concurrent.ExecutionException;
 import java.util.concurrent.Future;
 import java.util.concurrent.atomic.AtomicInteger;
@@ -86,6 +86,10 @@ public class TornadoSketcher {
             return this.driverIndex == driverIndex && this.deviceIndex == deviceIndex;
         }
 
+        public boolean matchesDriver(int driverIndex) {
+            return this.driverIndex == driverIndex;
+        }
+
         public Future<Sketch> getSketchFuture() {
             return sketchFuture;
         }
@@ -120,30 +124,39 @@ public class TornadoSketcher {
         openCLTokens.add("complex");
     }
 
-    private static boolean cacheContainsSketch(ResolvedJavaMethod method, int driverIndex, int deviceIndex) {
+    /**
+     * Sketches only depend on the providers of the driver, so a sketch built
+     * for one device is reused by the other devices of the same driver. An
+     * exact match is still preferred.
+     */
+    private static TornadoSketcherCacheEntry findEntry(ResolvedJavaMethod method, int driverIndex, int deviceIndex) {
         List<TornadoSketcherCacheEntry> entries = cache.get(method);
         if (entries == null) {
-            return false;
+            return null;
         }
 
+        TornadoSketcherCacheEntry sameDriver = null;
         for (TornadoSketcherCacheEntry entry : entries) {
             if (entry.matchesDriverAndDevice(driverIndex, deviceIndex)) {
-                return true;
+                return entry;
+            } else if (sameDriver == null && entry.matchesDriver(driverIndex)) {
+                sameDriver = entry;
             }
         }
-        return false;
+        return sameDriver;
+    }
+
+    private static boolean cacheContainsSketch(ResolvedJavaMethod method, int driverIndex, int deviceIndex) {
+        return findEntry(method, driverIndex, deviceIndex) != null;
     }
 
     public static Sketch lookup(ResolvedJavaMethod resolvedMethod, int driverIndex, int deviceIndex) {
         Sketch sketch = null;
         guarantee(cache.containsKey(resolvedMethod), "cache miss for: %s", resolvedMethod.getName());
         try {
-            List<TornadoSketcherCacheEntry> entries = cache.get(resolvedMethod);
-            for (TornadoSketcherCacheEntry entry : entries) {
-                if (entry.matchesDriverAndDevice(driverIndex, deviceIndex)) {
-                    sketch = entry.getSketchFuture().get();
-                    break;
-                }
+            TornadoSketcherCacheEntry entry = findEntry(resolvedMethod, driverIndex, deviceIndex);
+            if (entry != null) {
+                sketch = entry.getSketchFuture().get();
             }
             guarantee(sketch != null, "No sketch available for %d:%d %s", driverIndex, deviceIndex, resolvedMethod.getName());
         } catch (InterruptedException | ExecutionException e) {
@@ -153,14 +166,43 @@ public class TornadoSketcher {
     }
 
     static void buildSketch(SketchRequest request) {
+        TornadoSketcherCacheEntry entry = registerSketch(request);
+        if (entry != null) {
+            completeSketch(request, entry);
+        }
+    }
+
+    /**
+     * Registers the cache entry in the calling thread, so that a lookup never
+     * misses a sketch that is still being built, and builds it on the Tornado
+     * executor.
+     */
+    private static void submitSketch(SketchRequest request) {
+        TornadoSketcherCacheEntry entry = registerSketch(request);
+        if (entry != null) {
+            getTornadoExecutor().execute(() -> completeSketch(request, entry));
+        }
+    }
+
+    private static synchronized TornadoSketcherCacheEntry registerSketch(SketchRequest request) {
         if (cacheContainsSketch(request.resolvedMethod, request.meta.getDriverIndex(), request.meta.getDeviceIndex())) {
-            return;
+            return null;
         }
-        List<TornadoSketcherCacheEntry> sketches = cache.computeIfAbsent(request.resolvedMethod, k -> new ArrayList<>());
-        sketches.add(new TornadoSketcherCacheEntry(request.meta.getDriverIndex(), request.meta.getDeviceIndex(), request));
+        TornadoSketcherCacheEntry entry = new TornadoSketcherCacheEntry(request.meta.getDriverIndex(), request.meta.getDeviceIndex(), request);
+        cache.computeIfAbsent(request.resolvedMethod, k -> new CopyOnWriteArrayList<>()).add(entry);
+        return entry;
+    }
+
+    private static void completeSketch(SketchRequest request, TornadoSketcherCacheEntry entry) {
         try (DebugContext.Scope ignored = getDebugContext().scope("SketchCompiler")) {
-            request.result = buildSketch(request.meta, request.resolvedMethod, request.providers, request.graphBuilderSuite, request.sketchTier);
+            if (SketchDiskCache.isEnabled() && SketchDiskCache.loadSummary(request.resolvedMethod, request.meta)) {
+                request.result = new Sketch(() -> buildSketch(request.meta, request.resolvedMethod, request.providers, request.graphBuilderSuite, request.sketchTier).getGraph(), request.meta);
+            } else {
+                request.result = buildSketch(request.meta, request.resolvedMethod, request.providers, request.graphBuilderSuite, request.sketchTier);
+            }
         } catch (Throwable e) {
+            // Do not let other devices of the driver wait on a sketch that will never be built
+            cache.get(request.resolvedMethod).remove(entry);
             throw getDebugContext().handle(e);
         }
     }
@@ -198,9 +240,13 @@ public class TornadoSketcher {
                             throw new TornadoRuntimeException(
                                     "[ERROR] Java method name corresponds to an OpenCL Token. Change the Java method's name: " + invoke.callTarget().targetMethod().getName());
                         }
-                        getTornadoExecutor().execute(new SketchRequest(meta, invoke.callTarget().targetMethod(), providers, graphBuilderSuite, sketchTier));
+                        submitSketch(new SketchRequest(meta, invoke.callTarget().targetMethod(), providers, graphBuilderSuite, sketchTier));
                     });
 
+            if (SketchDiskCache.isEnabled()) {
+                SketchDiskCache.storeSummary(resolvedMethod, graph.getMethods(), meta);
+            }
+
             return new Sketch(CachedGraph.fromReadonlyCopy(graph), meta);
 
         } catch (Throwable e) {
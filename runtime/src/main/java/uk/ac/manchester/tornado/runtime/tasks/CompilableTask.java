@@ -57,6 +57,25 @@ public class CompilableTask implements SchedulableTask {
         this.meta = TaskMetaData.create(meta, id, method, false);
     }
 
+    private CompilableTask(CompilableTask task, TaskMetaData meta) {
+        this.method = task.method;
+        this.args = task.args;
+        this.shouldCompile = task.shouldCompile;
+        this.resolvedArgs = task.resolvedArgs;
+        this.meta = meta;
+        this.batchNumThreads = task.batchNumThreads;
+        this.profiler = task.profiler;
+        this.forceCompiler = task.forceCompiler;
+    }
+
+    /**
+     * Returns the same task bound to another meta data, so that it can be
+     * compiled without touching the meta data of this task.
+     */
+    public CompilableTask withMeta(TaskMetaData meta) {
+        return new CompilableTask(this, meta);
+    }
+
     @Override
     public String toString() {
         final StringBuilder buffer = new StringBuilder();
@@ -109,7 +109,7 @@ public class LocalObjectState {
     }
 
     public Event sync(Object object) {
-        if (isModified()) {
+        if (getOwner() != null && isModified()) {
             TornadoAcceleratorDevice owner = getOwner();
             int eventId = owner.streamOutBlocking(object, 0, global.getDeviceState(owner), null);
             setModified(false);
@@ -25,6 +25,7 @@
  */
 package uk.ac.manchester.tornado.runtime.tasks;
 
+import static uk.ac.manchester.tornado.runtime.TornadoCoreRuntime.getTornadoExecutor;
 import static uk.ac.manchester.tornado.runtime.TornadoCoreRuntime.getTornadoRuntime;
 import static uk.ac.manchester.tornado.runtime.common.RuntimeUtilities.humanReadableByteCount;
 import static uk.ac.manchester.tornado.runtime.common.RuntimeUtilities.isBoxedPrimitiveClass;
@@ -34,6 +35,7 @@ import static uk.ac.manchester.tornado.runtime.common.Tornado.warn;
 
 import java.io.IOException;
 import java.lang.reflect.Array;
+import java.lang.reflect.Field;
 import java.lang.reflect.Method;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
@@ -41,17 +43,19 @@ import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.BitSet;
 import java.util.HashSet;
+import java.util.IdentityHashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.Objects;
 import java.util.Set;
 import java.util.TreeMap;
+import java.util.concurrent.CompletableFuture;
 import java.util.concurrent.ConcurrentHashMap;
 import java.util.concurrent.atomic.AtomicInteger;
 import java.util.function.Consumer;
 import java.util.regex.Matcher;
 import java.util.regex.Pattern;
 
-import org.graalvm.compiler.graph.CachedGraph;
 import org.graalvm.compiler.phases.util.Providers;
 
 import jdk.vm.ci.meta.ResolvedJavaMethod;
@@ -60,6 +64,7 @@ import uk.ac.manchester.tornado.api.GridTask;
 import uk.ac.manchester.tornado.api.Policy;
 import uk.ac.manchester.tornado.api.TaskSchedule;
 import uk.ac.manchester.tornado.api.TornadoDriver;
+import uk.ac.manchester.tornado.api.collections.types.PrimitiveStorage;
 import uk.ac.manchester.tornado.api.common.Access;
 import uk.ac.manchester.tornado.api.common.Event;
 import uk.ac.manchester.tornado.api.common.SchedulableTask;
@@ -91,8 +96,8 @@ import uk.ac.manchester.tornado.runtime.TornadoVM;
 import uk.ac.manchester.tornado.runtime.analyzer.MetaReduceCodeAnalysis;
 import uk.ac.manchester.tornado.runtime.analyzer.ReduceCodeAnalysis;
 import uk.ac.manchester.tornado.runtime.analyzer.TaskUtils;
+import uk.ac.manchester.tornado.runtime.common.BailoutCache;
 import uk.ac.manchester.tornado.runtime.common.CallStack;
-import uk.ac.manchester.tornado.runtime.common.DeviceObjectState;
 import uk.ac.manchester.tornado.runtime.common.Tornado;
 import uk.ac.manchester.tornado.runtime.common.TornadoAcceleratorDevice;
 import uk.ac.manchester.tornado.runtime.common.TornadoOptions;
@@ -105,10 +110,9 @@ import uk.ac.manchester.tornado.runtime.graph.TornadoVMGraphCompilationResult;
 import uk.ac.manchester.tornado.runtime.graph.TornadoVMGraphCompiler;
 import uk.ac.manchester.tornado.runtime.graph.nodes.ContextNode;
 import uk.ac.manchester.tornado.runtime.profiler.EmptyProfiler;
+import uk.ac.manchester.tornado.runtime.profiler.ProfilerSampler;
 import uk.ac.manchester.tornado.runtime.profiler.TimeProfiler;
-import uk.ac.manchester.tornado.runtime.sketcher.Sketch;
 import uk.ac.manchester.tornado.runtime.sketcher.SketchRequest;
-import uk.ac.manchester.tornado.runtime.sketcher.TornadoSketcher;
 import uk.ac.manchester.tornado.runtime.tasks.meta.ScheduleMetaData;
 
 /**
@@ -136,13 +140,14 @@ public class TornadoTaskSchedule implements AbstractTaskGraph {
     private ConcurrentHashMap<Integer, ArrayList<Object>> multiHeapManagerOutputs = new ConcurrentHashMap<>();
     private ConcurrentHashMap<Integer, ArrayList<Object>> multiHeapManagerInputs = new ConcurrentHashMap<>();
     private ConcurrentHashMap<Integer, TaskSchedule> taskScheduleIndex = new ConcurrentHashMap<>();
+    private ConcurrentHashMap<TornadoDevice, CompletableFuture<Void>> precompilations = new ConcurrentHashMap<>();
+    private IdentityHashMap<SchedulableTask, BailoutKey> bailoutKeys = new IdentityHashMap<>();
 
     private static ConcurrentHashMap<Integer, TaskSchedule> globalTaskScheduleIndex = new ConcurrentHashMap<>();
     private static int baseGlobalIndex = 0;
     private static AtomicInteger offsetGlobalIndex = new AtomicInteger(0);
 
     private StringBuffer bufferLogProfiler = new StringBuffer();
-    private CachedGraph<?> graph;
 
     /**
      * Options for Dynamic Reconfiguration
@@ -164,7 +169,15 @@ public class TornadoTaskSchedule implements AbstractTaskGraph {
     private boolean reduceAnalysis = false;
     MetaReduceCodeAnalysis analysisTaskSchedule;
 
+    /**
+     * Fast-math mode that is still to be checked against the sequential result
+     */
+    private boolean fastMathPendingValidation;
+    private double fastMathMaxRelativeError;
+
     private TornadoProfiler timeProfiler;
+    private final ProfilerSampler profilerSampler = new ProfilerSampler(TornadoOptions.PROFILER_SAMPLING_INTERVAL);
+    private boolean sampledExecution = true;
     private boolean updateData;
     private boolean isFinished;
     private GridTask gridTask;
@@ -240,6 +253,14 @@ public class TornadoTaskSchedule implements AbstractTaskGraph {
         executionContext.setDefaultThreadScheduler(use);
     }
 
+    @Override
+    public void useFastMath(double maxRelativeError) {
+        meta().setFastMath(true);
+        fastMathMaxRelativeError = maxRelativeError;
+        fastMathPendingValidation = !Double.isInfinite(maxRelativeError);
+        triggerRecompile();
+    }
+
     @Override
     public boolean isFinished() {
         return this.isFinished;
@@ -273,6 +294,7 @@ public class TornadoTaskSchedule implements AbstractTaskGraph {
 
     @Override
     public void setDevice(TornadoDevice device) {
+        waitForPrecompilation(device);
         meta().setDevice(device);
 
         // Make sure that a sketch is available for the device.
@@ -312,9 +334,6 @@ public class TornadoTaskSchedule implements AbstractTaskGraph {
             CompilableTask compilableTask = (CompilableTask) task;
             final ResolvedJavaMethod resolvedMethod = getTornadoRuntime().resolveMethod(compilableTask.getMethod());
             new SketchRequest(compilableTask.meta(), resolvedMethod, providers, suites.getGraphBuilderSuite(), suites.getSketchTier()).run();
-
-            Sketch lookup = TornadoSketcher.lookup(resolvedMethod, compilableTask.meta().getDriverIndex(), compilableTask.meta().getDeviceIndex());
-            this.graph = lookup.getGraph();
         }
     }
 
@@ -332,9 +351,6 @@ public class TornadoTaskSchedule implements AbstractTaskGraph {
             CompilableTask compilableTask = (CompilableTask) task;
             final ResolvedJavaMethod resolvedMethod = getTornadoRuntime().resolveMethod(compilableTask.getMethod());
             new SketchRequest(compilableTask.meta(), resolvedMethod, providers, suites.getGraphBuilderSuite(), suites.getSketchTier()).run();
-
-            Sketch lookup = TornadoSketcher.lookup(resolvedMethod, compilableTask.meta().getDriverIndex(), compilableTask.meta().getDeviceIndex());
-            this.graph = lookup.getGraph();
         }
 
         // Prepare Initial Graph before the TornadoVM bytecode generation
@@ -470,6 +486,7 @@ public class TornadoTaskSchedule implements AbstractTaskGraph {
     }
 
     private boolean compileToTornadoVMBytecode() {
+        waitForPrecompilation(meta().getLogicDevice());
         CompileInfo compileInfo = extractCompileInfo();
         if (compileInfo.compile) {
             timeProfiler.start(ProfilerType.TOTAL_BYTE_CODE_GENERATION);
@@ -554,18 +571,71 @@ public class TornadoTaskSchedule implements AbstractTaskGraph {
         runAllTasksJavaSequential();
     }
 
+    /**
+     * Checks whether the compilation of any task of the schedule bailed out
+     * before, for the same device and specialisation.
+     */
+    private boolean hasRecordedBailout() {
+        if (!BailoutCache.isEnabled() || BailoutCache.isEmpty()) {
+            return false;
+        }
+        for (SchedulableTask task : executionContext.getTasks()) {
+            if (BailoutCache.contains(bailoutKey(task))) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    private static class BailoutKey {
+
+        private final TornadoDevice device;
+        private final String key;
+
+        private BailoutKey(TornadoDevice device, String key) {
+            this.device = device;
+            this.key = key;
+        }
+    }
+
+    /**
+     * Key of a task in the bailout cache. It is computed once per task and
+     * device, since the arguments of a task do not change between executions.
+     */
+    private String bailoutKey(SchedulableTask task) {
+        final TornadoDevice device = task.getDevice();
+        BailoutKey cached = bailoutKeys.get(task);
+        if (cached == null || cached.device != device) {
+            cached = new BailoutKey(device, BailoutCache.key(task, device));
+            bailoutKeys.put(task, cached);
+        }
+        return cached.key;
+    }
+
     @Override
     public void scheduleInner() {
         boolean compile = compileToTornadoVMBytecode();
+        if (hasRecordedBailout()) {
+            // Later executions go straight to the sequential code
+            bailout = true;
+            dumpDeoptReason(new TornadoBailoutRuntimeException("[Bailout] The compilation of a task of " + getId() + " bailed out before on this device"));
+            runAllTasksJavaSequential();
+            return;
+        }
         TornadoAcceleratorDevice deviceForTask = executionContext.getDeviceForTask(0);
         if (compile && deviceForTask.getDeviceContext().isPlatformFPGA()) {
             preCompilationForFPGA();
+        } else if (compile && TornadoOptions.OPENCL_SCHEDULE_PROGRAM) {
+            // Generate the code of all tasks before the first launch, so they are built as a single program
+            compileTaskToOpenCL();
         }
 
         try {
             event = vm.execute();
-            timeProfiler.stop(ProfilerType.TOTAL_TASK_SCHEDULE_TIME);
-            updateProfiler();
+            if (sampledExecution) {
+                timeProfiler.stop(ProfilerType.TOTAL_TASK_SCHEDULE_TIME);
+                updateProfiler();
+            }
         } catch (TornadoBailoutRuntimeException e) {
             if (TornadoOptions.RECOVER_BAILOUT) {
                 deoptimizeToSequentialJava(e);
@@ -684,6 +754,65 @@ public class TornadoTaskSchedule implements AbstractTaskGraph {
         timeProfiler.dumpJson(new StringBuffer(), this.getId());
     }
 
+    /**
+     * Compiles every task for each device on the Tornado executor. The sketches
+     * are shared by all devices of the same driver, so only the backend
+     * compilation and the driver build run per device. The installed code is
+     * kept in the code cache of each device, under the same task ids used by
+     * this task-schedule.
+     */
+    @Override
+    public void precompileFor(TornadoDevice... devices) {
+        for (TornadoDevice device : devices) {
+            if (!(device instanceof TornadoAcceleratorDevice) || precompilations.containsKey(device)) {
+                continue;
+            }
+            final List<CompilableTask> variants = new ArrayList<>();
+            for (int i = 0; i < executionContext.getTaskCount(); i++) {
+                SchedulableTask task = executionContext.getTask(i);
+                if (task instanceof CompilableTask) {
+                    variants.add(createTaskVariant((CompilableTask) task, device));
+                }
+            }
+            precompilations.put(device, CompletableFuture.runAsync(() -> {
+                for (CompilableTask variant : variants) {
+                    precompileTask(variant, (TornadoAcceleratorDevice) device);
+                }
+            }, getTornadoExecutor()));
+        }
+    }
+
+    private CompilableTask createTaskVariant(CompilableTask task, TornadoDevice device) {
+        final String taskId = task.getId().substring(meta().getId().length() + 1);
+        CompilableTask variant = new CompilableTask(meta(), taskId, task.getMethod(), task.getArguments());
+        variant.mapTo(device);
+        variant.setBatchThreads(task.getBatchThreads());
+        variant.setGridScheduler(task.isGridSchedulerEnabled());
+        variant.attachProfiler(new EmptyProfiler());
+        return variant;
+    }
+
+    private void precompileTask(CompilableTask variant, TornadoAcceleratorDevice device) {
+        int driverIndex = variant.meta().getDriverIndex();
+        Providers providers = getTornadoRuntime().getDriver(driverIndex).getProviders();
+        TornadoSuitesProvider suites = getTornadoRuntime().getDriver(driverIndex).getSuitesProvider();
+        try {
+            final ResolvedJavaMethod resolvedMethod = getTornadoRuntime().resolveMethod(variant.getMethod());
+            new SketchRequest(variant.meta(), resolvedMethod, providers, suites.getGraphBuilderSuite(), suites.getSketchTier()).run();
+            device.installCode(variant);
+        } catch (TornadoBailoutRuntimeException e) {
+            // The task is compiled again, and the bailout reported, if the device is selected
+            warn("Precompilation of %s for %s failed: %s", variant.getId(), device, e.getMessage());
+        }
+    }
+
+    private void waitForPrecompilation(TornadoDevice device) {
+        CompletableFuture<Void> precompilation = precompilations.get(device);
+        if (precompilation != null) {
+            precompilation.join();
+        }
+    }
+
     @Override
     public void invalidateObjects() {
         if (vm != null) {
@@ -691,20 +820,28 @@ public class TornadoTaskSchedule implements AbstractTaskGraph {
         }
     }
 
+    @Override
+    public void invalidateBailouts() {
+        for (SchedulableTask task : executionContext.getTasks()) {
+            BailoutCache.invalidate(bailoutKey(task));
+        }
+        bailout = false;
+    }
+
     @Override
     public void syncObject(Object object) {
         if (vm == null) {
             return;
         }
-        executionContext.sync();
+        syncObjectInner(object).waitOn();
     }
 
+    /**
+     * Copies the object back to the host only if a task has written it since
+     * the last transfer. Objects that tasks only read are already up to date.
+     */
     private Event syncObjectInner(Object object) {
-        final LocalObjectState localState = executionContext.getObjectState(object);
-        final GlobalObjectState globalState = localState.getGlobalState();
-        final DeviceObjectState deviceState = globalState.getDeviceState();
-        final TornadoAcceleratorDevice device = globalState.getOwner();
-        return device.resolveEvent(device.streamOutBlocking(object, 0, deviceState, null));
+        return executionContext.getObjectState(object).sync(object);
     }
 
     @Override
@@ -797,8 +934,26 @@ public class TornadoTaskSchedule implements AbstractTaskGraph {
             }
         }
 
-        timeProfiler.clean();
-        timeProfiler.start(ProfilerType.TOTAL_TASK_SCHEDULE_TIME);
+        if (fastMathPendingValidation) {
+            return scheduleWithFastMathValidation();
+        }
+        return executeSchedule();
+    }
+
+    private AbstractTaskGraph executeSchedule() {
+        return profilerSampler.execute(this::executeSampledSchedule);
+    }
+
+    private AbstractTaskGraph executeSampledSchedule(boolean sampled) {
+        // Executions outside the sample keep the timers of the last sampled one
+        sampledExecution = sampled;
+        if (sampledExecution) {
+            timeProfiler.clean();
+            timeProfiler.start(ProfilerType.TOTAL_TASK_SCHEDULE_TIME);
+            if (profilerSampler.isSampling()) {
+                timeProfiler.registerMetaData(ProfilerType.SAMPLING_WEIGHT, Integer.toString(profilerSampler.getWeight()));
+            }
+        }
 
         AbstractTaskGraph executionGraph = null;
         if (TornadoOptions.EXPERIMENTAL_REDUCE && !(getId().startsWith(TASK_SCHEDULE_PREFIX))) {
@@ -814,6 +969,123 @@ public class TornadoTaskSchedule implements AbstractTaskGraph {
         return this;
     }
 
+    /**
+     * Runs the schedule in fast-math mode and checks its outputs against the
+     * sequential Java execution. Falls back to the default mode when the error
+     * is above the threshold given in {@link #useFastMath(double)}.
+     */
+    private AbstractTaskGraph scheduleWithFastMathValidation() {
+        fastMathPendingValidation = false;
+        IdentityHashMap<Object, Object> inputs = copyTaskArrays();
+        for (Object output : streamOutObjects) {
+            if (!inputs.containsKey(getStorageArray(output))) {
+                // The result cannot be compared against the sequential run
+                if (Tornado.DEBUG) {
+                    System.out.println("[TornadoVM] Fast-math disabled for " + getId() + ": output of type " + output.getClass().getSimpleName() + " cannot be validated");
+                }
+                meta().setFastMath(false);
+                triggerRecompile();
+                return executeSchedule();
+            }
+        }
+
+        runAllTasksJavaSequential();
+        IdentityHashMap<Object, Object> reference = new IdentityHashMap<>();
+        for (Object output : streamOutObjects) {
+            Object storage = getStorageArray(output);
+            reference.put(storage, copyArray(storage));
+        }
+        restoreArrays(inputs);
+
+        AbstractTaskGraph executionGraph = executeSchedule();
+        executionGraph.waitOn();
+        double error = computeMaxRelativeError(reference);
+        if (error > fastMathMaxRelativeError) {
+            if (Tornado.DEBUG) {
+                System.out.println("[TornadoVM] Fast-math disabled for " + getId() + ": relative error " + error + " > " + fastMathMaxRelativeError);
+            }
+            meta().setFastMath(false);
+            triggerRecompile();
+            restoreArrays(inputs);
+            invalidateObjects();
+            executionGraph = executeSchedule();
+        }
+        return executionGraph;
+    }
+
+    private IdentityHashMap<Object, Object> copyTaskArrays() {
+        IdentityHashMap<Object, Object> copies = new IdentityHashMap<>();
+        for (TaskPackage taskPackage : taskPackages) {
+            Object[] parameters = taskPackage.getTaskParameters();
+            for (int i = 1; i < parameters.length; i++) {
+                Object storage = getStorageArray(parameters[i]);
+                if (storage != null) {
+                    copies.put(storage, copyArray(storage));
+                }
+            }
+        }
+        return copies;
+    }
+
+    /**
+     * Returns the primitive array that holds the data of a task parameter: the
+     * parameter itself for primitive arrays, and the backing {@code storage}
+     * array for the {@link PrimitiveStorage} collection types (vectors,
+     * matrices, images and volumes). Returns null for any other object.
+     */
+    private static Object getStorageArray(Object parameter) {
+        if (parameter == null) {
+            return null;
+        }
+        if (parameter.getClass().isArray()) {
+            return (parameter.getClass().getComponentType().isPrimitive() && parameter.getClass().getComponentType() != boolean.class) ? parameter : null;
+        }
+        if (!(parameter instanceof PrimitiveStorage)) {
+            return null;
+        }
+        for (Class<?> klass = parameter.getClass(); klass != null; klass = klass.getSuperclass()) {
+            try {
+                Field field = klass.getDeclaredField("storage");
+                field.setAccessible(true);
+                Object storage = field.get(parameter);
+                return (storage != null && storage.getClass().isArray() && storage.getClass().getComponentType().isPrimitive()) ? storage : null;
+            } catch (NoSuchFieldException e) {
+                // Look in the superclass
+            } catch (IllegalAccessException e) {
+                return null;
+            }
+        }
+        return null;
+    }
+
+    private static Object copyArray(Object array) {
+        int length = Array.getLength(array);
+        Object copy = Array.newInstance(array.getClass().getComponentType(), length);
+        System.arraycopy(array, 0, copy, 0, length);
+        return copy;
+    }
+
+    private static void restoreArrays(IdentityHashMap<Object, Object> copies) {
+        copies.forEach((array, copy) -> System.arraycopy(copy, 0, array, 0, Array.getLength(copy)));
+    }
+
+    private static double computeMaxRelativeError(IdentityHashMap<Object, Object> reference) {
+        double maxError = 0;
+        for (Map.Entry<Object, Object> entry : reference.entrySet()) {
+            Object result = entry.getKey();
+            for (int i = 0; i < Array.getLength(result); i++) {
+                double expected = Array.getDouble(entry.getValue(), i);
+                double actual = Array.getDouble(result, i);
+                if (expected == actual || (Double.isNaN(expected) && Double.isNaN(actual))) {
+                    continue;
+                }
+                double error = Math.abs(actual - expected) / Math.max(Math.abs(expected), 1.0);
+                maxError = Double.isNaN(error) ? Double.POSITIVE_INFINITY : Math.max(maxError, error);
+            }
+        }
+        return maxError;
+    }
+
     @Override
     public AbstractTaskGraph schedule(GridTask gridTask) {
         this.gridTask = gridTask;
@@ -58,6 +58,7 @@ public abstract class AbstractMetaData implements TaskMetaDataInterface {
     private long numThreads;
     private final HashSet<String> openCLBuiltOptions = new HashSet<>(Arrays.asList("-cl-single-precision-constant", "-cl-denorms-are-zero", "-cl-opt-disable", "-cl-strict-aliasing", "-cl-mad-enable",
             "-cl-no-signed-zeros", "-cl-unsafe-math-optimizations", "-cl-finite-math-only", "-cl-fast-relaxed-math", "-w", "-cl-std=CL2.0"));
+    private static final String[] FAST_MATH_COMPILER_FLAGS = { "-cl-fast-relaxed-math", "-cl-mad-enable", "-cl-denorms-are-zero" };
     private TornadoProfiler profiler;
     private GridTask gridTask;
     private long[] ptxBlockDim;
@@ -176,7 +177,49 @@ public abstract class AbstractMetaData implements TaskMetaDataInterface {
     }
 
     public String getCompilerFlags() {
-        return composeBuiltOptions(openclCompilerOptions);
+        return composeCompilerFlags(openclCompilerOptions, isOpenclCompilerFlagsDefined, isFastMathEnabled());
+    }
+
+    String getRawCompilerFlags() {
+        return openclCompilerOptions;
+    }
+
+    /**
+     * Builds the OpenCL build options. Explicit options (task, schedule or
+     * global) take precedence over the profile of the target device, which is
+     * read from {@code tornado.opencl.compiler.options.<driver>:<device>}. The
+     * fast-math options are appended when fast-math is enabled.
+     */
+    protected String composeCompilerFlags(String flags, boolean flagsDefined, boolean fastMath) {
+        String rawFlags = flags;
+        if (!flagsDefined) {
+            String deviceFlags = getProperty("tornado.opencl.compiler.options." + getDriverIndex() + ":" + getDeviceIndex());
+            if (deviceFlags != null) {
+                rawFlags = deviceFlags;
+            }
+        }
+        String options = composeBuiltOptions(rawFlags);
+        if (fastMath) {
+            for (String flag : FAST_MATH_COMPILER_FLAGS) {
+                if (!options.contains(flag)) {
+                    options = options.trim() + " " + flag;
+                }
+            }
+        }
+        return options;
+    }
+
+    public boolean isFastMathEnabled() {
+        return fastMath;
+    }
+
+    boolean isFastMathDefined() {
+        return isFastMathDefined;
+    }
+
+    public void setFastMath(boolean enable) {
+        fastMath = enable;
+        isFastMathDefined = true;
     }
 
     public int getOpenCLGpuBlockX() {
@@ -272,6 +315,8 @@ public abstract class AbstractMetaData implements TaskMetaDataInterface {
     private final boolean openclUseRelativeAddresses;
     private final boolean openclEnableBifs;
     private String openclCompilerOptions;
+    private boolean fastMath;
+    private boolean isFastMathDefined;
 
     /*
      * Allows the OpenCL driver to select the size of local work groups
@@ -433,8 +478,11 @@ public abstract class AbstractMetaData implements TaskMetaDataInterface {
         dumpProfiles = parseBoolean(getDefault("profiles.print", id, "False"));
         dumpTaskSchedule = parseBoolean(getDefault("schedule.dump", id, "False"));
 
-        openclCompilerOptions = (getProperty("tornado.opencl.compiler.options") == null) ? "-w" : getProperty("tornado.opencl.compiler.options");
-        isOpenclCompilerFlagsDefined = getProperty("tornado.opencl.compiler.options") != null;
+        openclCompilerOptions = getDefault("opencl.compiler.options", id, "-w");
+        isOpenclCompilerFlagsDefined = getProperty(id + ".opencl.compiler.options") != null || getProperty("tornado.opencl.compiler.options") != null;
+
+        fastMath = parseBoolean(getDefault("fastmath", id, "False"));
+        isFastMathDefined = getProperty(id + ".fastmath") != null;
 
         openclGpuBlockX = parseInt(getDefault("opencl.gpu.block.x", id, "256"));
         isOpenclGpuBlockXDefined = getProperty(id + ".opencl.gpu.block.x") != null;
@@ -452,6 +500,32 @@ public abstract class AbstractMetaData implements TaskMetaDataInterface {
         vmUseDeps = Boolean.parseBoolean(getDefault("vm.deps", id, "False"));
     }
 
+    /**
+     * Copies the state that is set at run time (device, threads, grid and
+     * compiler flags) from the meta data of the same task. The options read
+     * from the properties are already equal, since they depend only on the id.
+     */
+    protected void copyRuntimeState(AbstractMetaData other) {
+        device = other.device;
+        driverIndex = other.driverIndex;
+        deviceIndex = other.deviceIndex;
+        deviceManuallySet = other.deviceManuallySet;
+        shouldRecompile = other.shouldRecompile;
+        numThreads = other.numThreads;
+        printKernelExecutionTime = other.printKernelExecutionTime;
+        openclCompilerOptions = other.openclCompilerOptions;
+        isOpenclCompilerFlagsDefined = other.isOpenclCompilerFlagsDefined;
+        fastMath = other.fastMath;
+        isFastMathDefined = other.isFastMathDefined;
+        openclUseDriverScheduling = other.openclUseDriverScheduling;
+        profiler = other.profiler;
+        gridTask = other.gridTask;
+        ptxBlockDim = other.ptxBlockDim;
+        ptxGridDim = other.ptxGridDim;
+        graph = other.graph;
+        useGridScheduler = other.useGridScheduler;
+    }
+
     public void attachProfiler(TornadoProfiler profiler) {
         this.profiler = profiler;
     }
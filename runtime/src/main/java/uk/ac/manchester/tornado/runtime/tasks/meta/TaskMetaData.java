@@ -61,6 +61,8 @@ public class TaskMetaData extends AbstractMetaData {
     private boolean localWorkDefined;
     private boolean globalWorkDefined;
     private boolean canAssumeExact;
+    private int[] constantParameters;
+    private final int dynamicSharedMemoryBytes;
 
     public TaskMetaData(ScheduleMetaData scheduleMetaData, String taskID, int numParameters) {
         super(scheduleMetaData.getId() + "." + taskID, scheduleMetaData);
@@ -78,6 +80,7 @@ public class TaskMetaData extends AbstractMetaData {
         inspectGlobalWork();
 
         this.canAssumeExact = Boolean.parseBoolean(getDefault("coarsener.exact", getId(), "False"));
+        this.dynamicSharedMemoryBytes = Integer.parseInt(getDefault("ptx.dynamic.shared", getId(), "0"));
 
         // Set the number of threads to run (subset of the input space)
         setNumThreads(scheduleMetaData.getNumThreads());
@@ -87,10 +90,42 @@ public class TaskMetaData extends AbstractMetaData {
         this(scheduleMetaData, id, 0);
     }
 
+    private TaskMetaData(TaskMetaData other) {
+        super(other.getId(), other.scheduleMetaData);
+        this.scheduleMetaData = other.scheduleMetaData;
+        this.globalSize = other.globalSize;
+        this.constantSize = other.constantSize;
+        this.localSize = other.localSize;
+        this.privateSize = other.privateSize;
+        this.constantData = other.constantData;
+        this.profiles = other.profiles;
+        this.argumentsAccess = other.argumentsAccess.clone();
+        this.domain = other.domain;
+        this.globalOffset = (other.globalOffset == null) ? null : other.globalOffset.clone();
+        this.globalWork = (other.globalWork == null) ? null : other.globalWork.clone();
+        this.localWork = (other.localWork == null) ? null : other.localWork.clone();
+        this.localWorkDefined = other.localWorkDefined;
+        this.globalWorkDefined = other.globalWorkDefined;
+        this.canAssumeExact = other.canAssumeExact;
+        this.constantParameters = (other.constantParameters == null) ? null : other.constantParameters.clone();
+        this.dynamicSharedMemoryBytes = other.dynamicSharedMemoryBytes;
+        copyRuntimeState(other);
+    }
+
     public static TaskMetaData create(ScheduleMetaData scheduleMeta, String id, Method method, boolean readMetaData) {
         return new TaskMetaData(scheduleMeta, id, Modifier.isStatic(method.getModifiers()) ? method.getParameterCount() : method.getParameterCount() + 1);
     }
 
+    /**
+     * Copy of the meta data for a compilation that runs while the task is being
+     * launched, such as a tiered recompilation. The compiler writes the domain
+     * and the argument accesses into the copy, not into the meta data used by
+     * the launches. The profiles are shared with this meta data.
+     */
+    public TaskMetaData copy() {
+        return new TaskMetaData(this);
+    }
+
     private void inspectLocalWork() {
         localWorkDefined = getProperty(getId() + ".local.dims") != null;
         if (localWorkDefined) {
@@ -127,6 +162,16 @@ public class TaskMetaData extends AbstractMetaData {
         return System.getProperty(key);
     }
 
+    /**
+     * Bytes of dynamic shared memory ({@code .extern .shared}) requested for
+     * each block when the task is launched on a PTX device. Only prebuilt
+     * kernels declare dynamic shared memory; generated kernels size their
+     * shared arrays statically.
+     */
+    public int getDynamicSharedMemoryBytes() {
+        return dynamicSharedMemoryBytes;
+    }
+
     public boolean isLocalWorkDefined() {
         return localWorkDefined;
     }
@@ -232,6 +277,22 @@ public class TaskMetaData extends AbstractMetaData {
         return constantSize;
     }
 
+    /**
+     * Indexes of the read-only parameters that the compiled kernel reads from the
+     * constant region instead of the heap.
+     */
+    public int[] getConstantParameters() {
+        return constantParameters;
+    }
+
+    public void setConstantParameters(int[] constantParameters) {
+        this.constantParameters = constantParameters;
+    }
+
+    public boolean hasConstantParameters() {
+        return constantParameters != null && constantParameters.length > 0;
+    }
+
     @Override
     public TornadoAcceleratorDevice getLogicDevice() {
         if (scheduleMetaData.isDeviceManuallySet()) {
@@ -292,7 +353,16 @@ public class TaskMetaData extends AbstractMetaData {
 
     @Override
     public String getCompilerFlags() {
-        return isOpenclCompilerFlagsDefined() ? super.getCompilerFlags() : scheduleMetaData.getCompilerFlags();
+        if (isOpenclCompilerFlagsDefined()) {
+            return super.getCompilerFlags();
+        }
+        // Resolve the device profile against the device of this task
+        return composeCompilerFlags(scheduleMetaData.getRawCompilerFlags(), scheduleMetaData.isOpenclCompilerFlagsDefined(), isFastMathEnabled());
+    }
+
+    @Override
+    public boolean isFastMathEnabled() {
+        return isFastMathDefined() ? super.isFastMathEnabled() : scheduleMetaData.isFastMathEnabled();
     }
 
     @Override
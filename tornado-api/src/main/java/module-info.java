@@ -1,6 +1,7 @@
 module tornado.api {
     exports uk.ac.manchester.tornado.api;
     exports uk.ac.manchester.tornado.api.annotations;
+    exports uk.ac.manchester.tornado.api.atomics;
     exports uk.ac.manchester.tornado.api.collections.graphics;
     exports uk.ac.manchester.tornado.api.collections.math;
     exports uk.ac.manchester.tornado.api.collections.types;
@@ -94,8 +94,12 @@ public interface AbstractTaskGraph extends ProfileInterface {
 
     void warmup();
 
+    void precompileFor(TornadoDevice... devices);
+
     void invalidateObjects();
 
+    void invalidateBailouts();
+
     void syncObject(Object object);
 
     void syncObjects();
@@ -130,5 +134,7 @@ public interface AbstractTaskGraph extends ProfileInterface {
 
     void useDefaultThreadScheduler(boolean use);
 
+    void useFastMath(double maxRelativeError);
+
     boolean isFinished();
 }
@@ -296,6 +296,18 @@ public class TaskSchedule implements TornadoAPI, ProfileInterface {
         taskScheduleImpl.warmup();
     }
 
+    @Override
+    public TaskSchedule precompileFor(TornadoDevice... devices) {
+        taskScheduleImpl.precompileFor(devices);
+        return this;
+    }
+
+    @Override
+    public TaskSchedule invalidateBailouts() {
+        taskScheduleImpl.invalidateBailouts();
+        return this;
+    }
+
     @Override
     public long getReturnValue(String id) {
         return taskScheduleImpl.getReturnValue(id);
@@ -427,6 +439,18 @@ public class TaskSchedule implements TornadoAPI, ProfileInterface {
         return this;
     }
 
+    @Override
+    public TaskSchedule useFastMath() {
+        taskScheduleImpl.useFastMath(Double.POSITIVE_INFINITY);
+        return this;
+    }
+
+    @Override
+    public TaskSchedule useFastMath(double maxRelativeError) {
+        taskScheduleImpl.useFastMath(maxRelativeError);
+        return this;
+    }
+
     @Override
     public void updateReference(Object oldRef, Object newRef) {
         taskScheduleImpl.updateReference(oldRef, newRef);
@@ -637,6 +637,28 @@ public interface TornadoAPI {
      */
     void warmup();
 
+    /**
+     * It compiles the tasks of the task-schedule for each of the given devices
+     * in background threads. A later {@link #setDevice(TornadoDevice)} to any of
+     * these devices reuses the installed code instead of compiling on the
+     * critical path.
+     *
+     * @param devices
+     *            Target devices
+     * @return {@link TaskSchedule}
+     */
+    TaskSchedule precompileFor(TornadoDevice... devices);
+
+    /**
+     * Forgets the compilation bailouts recorded for the tasks of the
+     * task-schedule on their current devices. Tasks whose compilation failed
+     * before are compiled again on the next execution, instead of running the
+     * sequential code straight away.
+     *
+     * @return {@link TaskSchedule}
+     */
+    TaskSchedule invalidateBailouts();
+
     long getReturnValue(String id);
 
     void dumpEvents();
@@ -665,6 +687,31 @@ public interface TornadoAPI {
 
     TaskSchedule useDefaultThreadScheduler(boolean use);
 
+    /**
+     * Compiles the tasks of the schedule in fast-math mode: OpenCL kernels are
+     * built with -cl-fast-relaxed-math, -cl-mad-enable and -cl-denorms-are-zero,
+     * and single-precision math functions use the native_* builtins.
+     *
+     * @return {@link TaskSchedule}
+     */
+    TaskSchedule useFastMath();
+
+    /**
+     * Enables fast-math mode only if it is accurate enough. On the next
+     * execution, the result of the schedule is compared with the sequential Java
+     * result. If any output element differs by more than the given relative
+     * error, fast-math is disabled and the schedule is executed again in the
+     * default mode. Outputs must be primitive arrays or collection types backed
+     * by one (vectors, matrices, images); fast-math is not enabled for schedules
+     * with any other kind of output, as they cannot be checked.
+     *
+     * @param maxRelativeError
+     *            Maximum relative error, or absolute error for reference values
+     *            whose magnitude is below 1.
+     * @return {@link TaskSchedule}
+     */
+    TaskSchedule useFastMath(double maxRelativeError);
+
     void updateReference(Object oldRef, Object newRef);
 
     boolean isFinished();
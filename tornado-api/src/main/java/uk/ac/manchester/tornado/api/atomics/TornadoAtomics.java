@@ -0,0 +1,96 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework:
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * GNU Classpath is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * GNU Classpath is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Classpath; see the file COPYING.  If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301 USA.
+ *
+ * Linking this library statically or dynamically with other modules is
+ * making a combined work based on this library.  Thus, the terms and
+ * conditions of the GNU General Public License cover the whole
+ * combination.
+ *
+ * As a special exception, the copyright holders of this library give you
+ * permission to link this library with independent modules to produce an
+ * executable, regardless of the license terms of these independent
+ * modules, and to copy and distribute the resulting executable under
+ * terms of your choice, provided that you also meet, for each linked
+ * independent module, the terms and conditions of the license of that
+ * module.  An independent module is a module which is not derived from
+ * or based on this library.  If you modify this library, you may extend
+ * this exception to your version of the library, but you are not
+ * obligated to do so.  If you do not wish to do so, delete this
+ * exception statement from your version.
+ *
+ */
+package uk.ac.manchester.tornado.api.atomics;
+
+/**
+ * Atomic read-modify-write operations over elements of primitive arrays.
+ *
+ * <p>
+ * Each array element behaves as an independent atomic counter that lives in
+ * the device heap together with the rest of the array, so a kernel can use as
+ * many counters as the array holds. On the accelerators, the calls are
+ * replaced by the backend's atomic builtins (or by compare-and-swap loops when
+ * the target has no native instruction for the type). When running on the
+ * JVM, the Java implementation below is used.
+ * </p>
+ */
+public final class TornadoAtomics {
+
+    private TornadoAtomics() {
+    }
+
+    public synchronized static void atomicAdd(int[] array, int index, int value) {
+        array[index] += value;
+    }
+
+    public synchronized static void atomicAdd(long[] array, int index, long value) {
+        array[index] += value;
+    }
+
+    public synchronized static void atomicAdd(float[] array, int index, float value) {
+        array[index] += value;
+    }
+
+    public synchronized static void atomicMin(int[] array, int index, int value) {
+        array[index] = Math.min(array[index], value);
+    }
+
+    public synchronized static void atomicMin(long[] array, int index, long value) {
+        array[index] = Math.min(array[index], value);
+    }
+
+    public synchronized static void atomicMin(float[] array, int index, float value) {
+        array[index] = Math.min(array[index], value);
+    }
+
+    public synchronized static void atomicMax(int[] array, int index, int value) {
+        array[index] = Math.max(array[index], value);
+    }
+
+    public synchronized static void atomicMax(long[] array, int index, long value) {
+        array[index] = Math.max(array[index], value);
+    }
+
+    public synchronized static void atomicMax(float[] array, int index, float value) {
+        array[index] = Math.max(array[index], value);
+    }
+}
@@ -0,0 +1,193 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework: 
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * GNU Classpath is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ * 
+ * GNU Classpath is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Classpath; see the file COPYING.  If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301 USA.
+ *
+ * Linking this library statically or dynamically with other modules is
+ * making a combined work based on this library.  Thus, the terms and
+ * conditions of the GNU General Public License cover the whole
+ * combination.
+ * 
+ * As a special exception, the copyright holders of this library give you
+ * permission to link this library with independent modules to produce an
+ * executable, regardless of the license terms of these independent
+ * modules, and to copy and distribute the resulting executable under
+ * terms of your choice, provided that you also meet, for each linked
+ * independent module, the terms and conditions of the license of that
+ * module.  An independent module is a module which is not derived from
+ * or based on this library.  If you modify this library, you may extend
+ * this exception to your version of the library, but you are not
+ * obligated to do so.  If you do not wish to do so, delete this
+ * exception statement from your version.
+ *
+ */
+package uk.ac.manchester.tornado.api.collections.math;
+
+import uk.ac.manchester.tornado.api.TaskSchedule;
+import uk.ac.manchester.tornado.api.annotations.Parallel;
+import uk.ac.manchester.tornado.api.collections.types.SparseMatrixCSRFloat;
+import uk.ac.manchester.tornado.api.collections.types.SparseMatrixELLFloat;
+import uk.ac.manchester.tornado.api.collections.types.SparseMatrixFormat;
+import uk.ac.manchester.tornado.api.collections.types.SparseMatrixSELLFloat;
+
+/**
+ * Sparse matrix-vector (SpMV) and sparse matrix-dense matrix (SpMM) kernels
+ * for the sparse collection types. Dense matrices are stored row-major.
+ *
+ * The {@code spmv}/{@code spmm} helpers pick the format from the row-length
+ * statistics of the matrix (see {@link SparseMatrixFormat#select}) and add
+ * the matching kernel to a task schedule.
+ */
+public class SparseLinearAlgebra {
+
+    /**
+     * Default SELL chunk height, the warp/wavefront width of most GPUs.
+     */
+    public static final int DEFAULT_CHUNK_HEIGHT = 32;
+
+    /**
+     * Default SELL sorting scope.
+     */
+    public static final int DEFAULT_SIGMA = 32 * DEFAULT_CHUNK_HEIGHT;
+
+    public static void spmvCSR(int[] rowPointers, int[] columnIndexes, float[] values, int numRows, float[] x, float[] y) {
+        for (@Parallel int row = 0; row < numRows; row++) {
+            float sum = 0.0f;
+            for (int i = rowPointers[row]; i < rowPointers[row + 1]; i++) {
+                sum += values[i] * x[columnIndexes[i]];
+            }
+            y[row] = sum;
+        }
+    }
+
+    public static void spmvELL(int[] columnIndexes, float[] values, int numRows, int width, float[] x, float[] y) {
+        for (@Parallel int row = 0; row < numRows; row++) {
+            float sum = 0.0f;
+            for (int j = 0; j < width; j++) {
+                final int index = j * numRows + row;
+                final int column = columnIndexes[index];
+                if (column >= 0) {
+                    sum += values[index] * x[column];
+                }
+            }
+            y[row] = sum;
+        }
+    }
+
+    public static void spmvSELL(int[] chunkPointers, int[] chunkWidths, int[] rowPermutation, int[] columnIndexes, float[] values, int numRows, int chunkHeight, float[] x, float[] y) {
+        for (@Parallel int slot = 0; slot < numRows; slot++) {
+            final int chunk = slot / chunkHeight;
+            final int base = chunkPointers[chunk] + slot - (chunk * chunkHeight);
+            float sum = 0.0f;
+            for (int j = 0; j < chunkWidths[chunk]; j++) {
+                final int index = base + j * chunkHeight;
+                final int column = columnIndexes[index];
+                if (column >= 0) {
+                    sum += values[index] * x[column];
+                }
+            }
+            y[rowPermutation[slot]] = sum;
+        }
+    }
+
+    public static void spmmCSR(int[] rowPointers, int[] columnIndexes, float[] values, int numRows, float[] b, int numColumnsB, float[] c) {
+        for (@Parallel int row = 0; row < numRows; row++) {
+            for (@Parallel int col = 0; col < numColumnsB; col++) {
+                float sum = 0.0f;
+                for (int i = rowPointers[row]; i < rowPointers[row + 1]; i++) {
+                    sum += values[i] * b[columnIndexes[i] * numColumnsB + col];
+                }
+                c[row * numColumnsB + col] = sum;
+            }
+        }
+    }
+
+    public static void spmmELL(int[] columnIndexes, float[] values, int numRows, int width, float[] b, int numColumnsB, float[] c) {
+        for (@Parallel int row = 0; row < numRows; row++) {
+            for (@Parallel int col = 0; col < numColumnsB; col++) {
+                float sum = 0.0f;
+                for (int j = 0; j < width; j++) {
+                    final int index = j * numRows + row;
+                    final int column = columnIndexes[index];
+                    if (column >= 0) {
+                        sum += values[index] * b[column * numColumnsB + col];
+                    }
+                }
+                c[row * numColumnsB + col] = sum;
+            }
+        }
+    }
+
+    public static void spmmSELL(int[] chunkPointers, int[] chunkWidths, int[] rowPermutation, int[] columnIndexes, float[] values, int numRows, int chunkHeight, float[] b, int numColumnsB, float[] c) {
+        for (@Parallel int slot = 0; slot < numRows; slot++) {
+            for (@Parallel int col = 0; col < numColumnsB; col++) {
+                final int chunk = slot / chunkHeight;
+                final int base = chunkPointers[chunk] + slot - (chunk * chunkHeight);
+                float sum = 0.0f;
+                for (int j = 0; j < chunkWidths[chunk]; j++) {
+                    final int index = base + j * chunkHeight;
+                    final int column = columnIndexes[index];
+                    if (column >= 0) {
+                        sum += values[index] * b[column * numColumnsB + col];
+                    }
+                }
+                c[rowPermutation[slot] * numColumnsB + col] = sum;
+            }
+        }
+    }
+
+    /**
+     * Adds a task computing {@code y = A * x} to the schedule, using the format
+     * selected for {@code A}. The converted matrix is only built once, when
+     * the task is added.
+     */
+    public static TaskSchedule spmv(TaskSchedule schedule, String taskName, SparseMatrixCSRFloat matrix, float[] x, float[] y) {
+        switch (SparseMatrixFormat.select(matrix.getRowStatistics())) {
+            case ELL:
+                final SparseMatrixELLFloat ell = matrix.toELL();
+                return schedule.task(taskName, SparseLinearAlgebra::spmvELL, ell.getColumnIndexes(), ell.getValues(), ell.getNumRows(), ell.getWidth(), x, y);
+            case SELL:
+                final SparseMatrixSELLFloat sell = matrix.toSELL(DEFAULT_CHUNK_HEIGHT, DEFAULT_SIGMA);
+                return schedule.task(taskName, SparseLinearAlgebra::spmvSELL, sell.getChunkPointers(), sell.getChunkWidths(), sell.getRowPermutation(), sell.getColumnIndexes(), sell.getValues(),
+                        sell.getNumRows(), sell.getChunkHeight(), x, y);
+            default:
+                return schedule.task(taskName, SparseLinearAlgebra::spmvCSR, matrix.getRowPointers(), matrix.getColumnIndexes(), matrix.getValues(), matrix.getNumRows(), x, y);
+        }
+    }
+
+    /**
+     * Adds a task computing {@code c = A * b} to the schedule, where {@code b}
+     * is a dense row-major matrix with {@code numColumnsB} columns.
+     */
+    public static TaskSchedule spmm(TaskSchedule schedule, String taskName, SparseMatrixCSRFloat matrix, float[] b, int numColumnsB, float[] c) {
+        switch (SparseMatrixFormat.select(matrix.getRowStatistics())) {
+            case ELL:
+                final SparseMatrixELLFloat ell = matrix.toELL();
+                return schedule.task(taskName, SparseLinearAlgebra::spmmELL, ell.getColumnIndexes(), ell.getValues(), ell.getNumRows(), ell.getWidth(), b, numColumnsB, c);
+            case SELL:
+                final SparseMatrixSELLFloat sell = matrix.toSELL(DEFAULT_CHUNK_HEIGHT, DEFAULT_SIGMA);
+                return schedule.task(taskName, SparseLinearAlgebra::spmmSELL, sell.getChunkPointers(), sell.getChunkWidths(), sell.getRowPermutation(), sell.getColumnIndexes(), sell.getValues(),
+                        sell.getNumRows(), sell.getChunkHeight(), b, numColumnsB, c);
+            default:
+                return schedule.task(taskName, SparseLinearAlgebra::spmmCSR, matrix.getRowPointers(), matrix.getColumnIndexes(), matrix.getValues(), matrix.getNumRows(), b, numColumnsB, c);
+        }
+    }
+}
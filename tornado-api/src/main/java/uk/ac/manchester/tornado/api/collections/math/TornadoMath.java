@@ -316,4 +316,35 @@ public class TornadoMath {
         return (float) Math.sqrt(value);
     }
 
+    /**
+     * Fast approximations. On the accelerator these calls lower to the
+     * reduced-precision hardware functions (native_* in OpenCL, *.approx in PTX)
+     * at the call site, regardless of the fast-math mode of the task. In OpenCL
+     * they build the same native_* intrinsic nodes that fast-math mode
+     * substitutes for the exact functions. The Java versions are exact.
+     */
+    public static float fastExp(float value) {
+        return (float) Math.exp(value);
+    }
+
+    public static float fastLog(float value) {
+        return (float) Math.log(value);
+    }
+
+    public static float fastSin(float value) {
+        return (float) Math.sin(value);
+    }
+
+    public static float fastCos(float value) {
+        return (float) Math.cos(value);
+    }
+
+    public static float fastSqrt(float value) {
+        return (float) Math.sqrt(value);
+    }
+
+    public static float fastRsqrt(float value) {
+        return (float) (1.0 / Math.sqrt(value));
+    }
+
 }
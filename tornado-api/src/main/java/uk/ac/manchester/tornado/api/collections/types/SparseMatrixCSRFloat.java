@@ -0,0 +1,290 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework: 
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * GNU Classpath is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ * 
+ * GNU Classpath is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Classpath; see the file COPYING.  If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301 USA.
+ *
+ * Linking this library statically or dynamically with other modules is
+ * making a combined work based on this library.  Thus, the terms and
+ * conditions of the GNU General Public License cover the whole
+ * combination.
+ * 
+ * As a special exception, the copyright holders of this library give you
+ * permission to link this library with independent modules to produce an
+ * executable, regardless of the license terms of these independent
+ * modules, and to copy and distribute the resulting executable under
+ * terms of your choice, provided that you also meet, for each linked
+ * independent module, the terms and conditions of the license of that
+ * module.  An independent module is a module which is not derived from
+ * or based on this library.  If you modify this library, you may extend
+ * this exception to your version of the library, but you are not
+ * obligated to do so.  If you do not wish to do so, delete this
+ * exception statement from your version.
+ *
+ */
+package uk.ac.manchester.tornado.api.collections.types;
+
+import static java.lang.String.format;
+
+import java.util.Arrays;
+
+/**
+ * Sparse matrix stored in Compressed Sparse Row (CSR) format. The non-zeros of
+ * row {@code i} are stored in {@code values[rowPointers[i] .. rowPointers[i +
+ * 1])}, with their columns in the same positions of {@code columnIndexes}.
+ *
+ * CSR is the interchange format of the sparse types: {@link #toELL()} and
+ * {@link #toSELL(int, int)} build the device-friendly layouts from it.
+ */
+public class SparseMatrixCSRFloat {
+
+    /**
+     * Number of rows
+     */
+    private final int numRows;
+
+    /**
+     * Number of columns
+     */
+    private final int numColumns;
+
+    /**
+     * Offsets of the first non-zero of each row (numRows + 1 entries)
+     */
+    private final int[] rowPointers;
+
+    private final int[] columnIndexes;
+
+    private final float[] values;
+
+    public SparseMatrixCSRFloat(int numRows, int numColumns, int[] rowPointers, int[] columnIndexes, float[] values) {
+        if (rowPointers.length != numRows + 1) {
+            throw new IllegalArgumentException(format("expected %d row pointers but found %d", numRows + 1, rowPointers.length));
+        }
+        if (columnIndexes.length != values.length || rowPointers[numRows] != values.length) {
+            throw new IllegalArgumentException(format("inconsistent number of non-zeros: pointers=%d, columns=%d, values=%d", rowPointers[numRows], columnIndexes.length, values.length));
+        }
+        this.numRows = numRows;
+        this.numColumns = numColumns;
+        this.rowPointers = rowPointers;
+        this.columnIndexes = columnIndexes;
+        this.values = values;
+    }
+
+    /**
+     * Builds a CSR matrix from a dense matrix stored in row-major order. Zero
+     * entries are dropped.
+     */
+    public static SparseMatrixCSRFloat fromDense(int numRows, int numColumns, float[] dense) {
+        final int[] rowPointers = new int[numRows + 1];
+        int nnz = 0;
+        for (int i = 0; i < numRows; i++) {
+            for (int j = 0; j < numColumns; j++) {
+                if (dense[i * numColumns + j] != 0f) {
+                    nnz++;
+                }
+            }
+            rowPointers[i + 1] = nnz;
+        }
+
+        final int[] columnIndexes = new int[nnz];
+        final float[] values = new float[nnz];
+        int index = 0;
+        for (int i = 0; i < numRows; i++) {
+            for (int j = 0; j < numColumns; j++) {
+                final float value = dense[i * numColumns + j];
+                if (value != 0f) {
+                    columnIndexes[index] = j;
+                    values[index] = value;
+                    index++;
+                }
+            }
+        }
+        return new SparseMatrixCSRFloat(numRows, numColumns, rowPointers, columnIndexes, values);
+    }
+
+    /**
+     * Builds a CSR matrix from coordinate (COO) triplets in any order. Duplicate
+     * coordinates are kept as separate entries, so they are summed by the
+     * kernels.
+     */
+    public static SparseMatrixCSRFloat fromCoordinates(int numRows, int numColumns, int[] rows, int[] columns, float[] values) {
+        final int nnz = values.length;
+        final int[] rowPointers = new int[numRows + 1];
+        for (int i = 0; i < nnz; i++) {
+            rowPointers[rows[i] + 1]++;
+        }
+        for (int i = 0; i < numRows; i++) {
+            rowPointers[i + 1] += rowPointers[i];
+        }
+
+        final int[] next = Arrays.copyOf(rowPointers, numRows);
+        final int[] sortedColumns = new int[nnz];
+        final float[] sortedValues = new float[nnz];
+        for (int i = 0; i < nnz; i++) {
+            final int index = next[rows[i]]++;
+            sortedColumns[index] = columns[i];
+            sortedValues[index] = values[i];
+        }
+
+        // insertion sort of the columns within each row, rows are short
+        for (int i = 0; i < numRows; i++) {
+            for (int j = rowPointers[i] + 1; j < rowPointers[i + 1]; j++) {
+                final int column = sortedColumns[j];
+                final float value = sortedValues[j];
+                int k = j - 1;
+                while (k >= rowPointers[i] && sortedColumns[k] > column) {
+                    sortedColumns[k + 1] = sortedColumns[k];
+                    sortedValues[k + 1] = sortedValues[k];
+                    k--;
+                }
+                sortedColumns[k + 1] = column;
+                sortedValues[k + 1] = value;
+            }
+        }
+        return new SparseMatrixCSRFloat(numRows, numColumns, rowPointers, sortedColumns, sortedValues);
+    }
+
+    public int getNumRows() {
+        return numRows;
+    }
+
+    public int getNumColumns() {
+        return numColumns;
+    }
+
+    public int getNumNonZeros() {
+        return values.length;
+    }
+
+    public int[] getRowPointers() {
+        return rowPointers;
+    }
+
+    public int[] getColumnIndexes() {
+        return columnIndexes;
+    }
+
+    public float[] getValues() {
+        return values;
+    }
+
+    public int getRowLength(int row) {
+        return rowPointers[row + 1] - rowPointers[row];
+    }
+
+    public float get(int row, int column) {
+        float result = 0f;
+        for (int i = rowPointers[row]; i < rowPointers[row + 1]; i++) {
+            if (columnIndexes[i] == column) {
+                result += values[i];
+            }
+        }
+        return result;
+    }
+
+    public SparseRowStatistics getRowStatistics() {
+        return new SparseRowStatistics(this);
+    }
+
+    /**
+     * Converts the matrix to ELLPACK: every row is padded to the length of the
+     * longest one.
+     */
+    public SparseMatrixELLFloat toELL() {
+        int width = 0;
+        for (int i = 0; i < numRows; i++) {
+            width = Math.max(width, getRowLength(i));
+        }
+
+        final int[] ellColumns = new int[width * numRows];
+        final float[] ellValues = new float[width * numRows];
+        Arrays.fill(ellColumns, SparseMatrixELLFloat.PADDING);
+        for (int i = 0; i < numRows; i++) {
+            for (int j = 0; j < getRowLength(i); j++) {
+                ellColumns[j * numRows + i] = columnIndexes[rowPointers[i] + j];
+                ellValues[j * numRows + i] = values[rowPointers[i] + j];
+            }
+        }
+        return new SparseMatrixELLFloat(numRows, numColumns, width, ellColumns, ellValues);
+    }
+
+    /**
+     * Converts the matrix to SELL-C-sigma: rows are sorted by length inside
+     * windows of {@code sigma} rows and packed into chunks of
+     * {@code chunkHeight} rows, each padded to its own longest row.
+     *
+     * @param chunkHeight
+     *            number of rows per chunk (C), usually the SIMD/warp width
+     * @param sigma
+     *            sorting scope in rows; 1 disables sorting
+     */
+    public SparseMatrixSELLFloat toSELL(int chunkHeight, int sigma) {
+        if (chunkHeight <= 0 || sigma <= 0) {
+            throw new IllegalArgumentException(format("invalid SELL parameters: C=%d, sigma=%d", chunkHeight, sigma));
+        }
+
+        final Integer[] order = new Integer[numRows];
+        for (int i = 0; i < numRows; i++) {
+            order[i] = i;
+        }
+        for (int start = 0; start < numRows; start += sigma) {
+            final int end = Math.min(start + sigma, numRows);
+            Arrays.sort(order, start, end, (a, b) -> getRowLength(b) - getRowLength(a));
+        }
+
+        final int[] rowPermutation = new int[numRows];
+        for (int i = 0; i < numRows; i++) {
+            rowPermutation[i] = order[i];
+        }
+
+        final int numChunks = (numRows + chunkHeight - 1) / chunkHeight;
+        final int[] chunkWidths = new int[numChunks];
+        final int[] chunkPointers = new int[numChunks + 1];
+        for (int chunk = 0; chunk < numChunks; chunk++) {
+            int width = 0;
+            for (int slot = chunk * chunkHeight; slot < Math.min((chunk + 1) * chunkHeight, numRows); slot++) {
+                width = Math.max(width, getRowLength(rowPermutation[slot]));
+            }
+            chunkWidths[chunk] = width;
+            chunkPointers[chunk + 1] = chunkPointers[chunk] + width * chunkHeight;
+        }
+
+        final int[] sellColumns = new int[chunkPointers[numChunks]];
+        final float[] sellValues = new float[chunkPointers[numChunks]];
+        Arrays.fill(sellColumns, SparseMatrixSELLFloat.PADDING);
+        for (int slot = 0; slot < numRows; slot++) {
+            final int chunk = slot / chunkHeight;
+            final int lane = slot % chunkHeight;
+            final int row = rowPermutation[slot];
+            for (int j = 0; j < getRowLength(row); j++) {
+                final int index = chunkPointers[chunk] + j * chunkHeight + lane;
+                sellColumns[index] = columnIndexes[rowPointers[row] + j];
+                sellValues[index] = values[rowPointers[row] + j];
+            }
+        }
+        return new SparseMatrixSELLFloat(numRows, numColumns, chunkHeight, sigma, chunkPointers, chunkWidths, rowPermutation, sellColumns, sellValues);
+    }
+
+    @Override
+    public String toString() {
+        return format("SparseMatrixCSRFloat <%d x %d, nnz=%d>", numRows, numColumns, getNumNonZeros());
+    }
+}
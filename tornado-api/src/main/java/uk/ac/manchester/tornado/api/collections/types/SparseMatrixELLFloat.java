@@ -0,0 +1,109 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework: 
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * GNU Classpath is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ * 
+ * GNU Classpath is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Classpath; see the file COPYING.  If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301 USA.
+ *
+ * Linking this library statically or dynamically with other modules is
+ * making a combined work based on this library.  Thus, the terms and
+ * conditions of the GNU General Public License cover the whole
+ * combination.
+ * 
+ * As a special exception, the copyright holders of this library give you
+ * permission to link this library with independent modules to produce an
+ * executable, regardless of the license terms of these independent
+ * modules, and to copy and distribute the resulting executable under
+ * terms of your choice, provided that you also meet, for each linked
+ * independent module, the terms and conditions of the license of that
+ * module.  An independent module is a module which is not derived from
+ * or based on this library.  If you modify this library, you may extend
+ * this exception to your version of the library, but you are not
+ * obligated to do so.  If you do not wish to do so, delete this
+ * exception statement from your version.
+ *
+ */
+package uk.ac.manchester.tornado.api.collections.types;
+
+import static java.lang.String.format;
+
+/**
+ * Sparse matrix stored in ELLPACK format. Every row holds {@code width}
+ * entries (short rows are padded with zeros whose column is {@link #PADDING},
+ * which kernels must skip) and the entries are stored column-major, so entry
+ * {@code j} of row {@code i} lives at {@code j * numRows + i}. Consecutive
+ * threads therefore read consecutive addresses.
+ */
+public class SparseMatrixELLFloat {
+
+    /**
+     * Column index of padded entries. Padding never reads {@code x}, so an
+     * Inf or NaN in the dense operand cannot leak into short rows.
+     */
+    public static final int PADDING = -1;
+
+    private final int numRows;
+
+    private final int numColumns;
+
+    /**
+     * Number of entries stored per row
+     */
+    private final int width;
+
+    private final int[] columnIndexes;
+
+    private final float[] values;
+
+    public SparseMatrixELLFloat(int numRows, int numColumns, int width, int[] columnIndexes, float[] values) {
+        if (columnIndexes.length != width * numRows || values.length != width * numRows) {
+            throw new IllegalArgumentException(format("expected %d entries but found columns=%d, values=%d", width * numRows, columnIndexes.length, values.length));
+        }
+        this.numRows = numRows;
+        this.numColumns = numColumns;
+        this.width = width;
+        this.columnIndexes = columnIndexes;
+        this.values = values;
+    }
+
+    public int getNumRows() {
+        return numRows;
+    }
+
+    public int getNumColumns() {
+        return numColumns;
+    }
+
+    public int getWidth() {
+        return width;
+    }
+
+    public int[] getColumnIndexes() {
+        return columnIndexes;
+    }
+
+    public float[] getValues() {
+        return values;
+    }
+
+    @Override
+    public String toString() {
+        return format("SparseMatrixELLFloat <%d x %d, width=%d>", numRows, numColumns, width);
+    }
+}
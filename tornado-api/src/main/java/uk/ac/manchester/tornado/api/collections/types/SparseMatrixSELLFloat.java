@@ -0,0 +1,152 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework: 
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * GNU Classpath is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ * 
+ * GNU Classpath is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Classpath; see the file COPYING.  If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301 USA.
+ *
+ * Linking this library statically or dynamically with other modules is
+ * making a combined work based on this library.  Thus, the terms and
+ * conditions of the GNU General Public License cover the whole
+ * combination.
+ * 
+ * As a special exception, the copyright holders of this library give you
+ * permission to link this library with independent modules to produce an
+ * executable, regardless of the license terms of these independent
+ * modules, and to copy and distribute the resulting executable under
+ * terms of your choice, provided that you also meet, for each linked
+ * independent module, the terms and conditions of the license of that
+ * module.  An independent module is a module which is not derived from
+ * or based on this library.  If you modify this library, you may extend
+ * this exception to your version of the library, but you are not
+ * obligated to do so.  If you do not wish to do so, delete this
+ * exception statement from your version.
+ *
+ */
+package uk.ac.manchester.tornado.api.collections.types;
+
+import static java.lang.String.format;
+
+/**
+ * Sparse matrix stored in SELL-C-sigma format. Rows are sorted by length within
+ * windows of {@code sigma} rows and grouped into chunks of {@code chunkHeight}
+ * (C) rows. Each chunk is padded to its own longest row and stored
+ * column-major: entry {@code j} of the row in slot {@code s} lives at
+ * {@code chunkPointers[s / C] + j * C + s % C}. Slot {@code s} holds the
+ * original row {@code rowPermutation[s]}. Padded entries have column
+ * {@link #PADDING} and must be skipped by kernels.
+ *
+ * Compared to ELLPACK, the padding is bounded per chunk, which keeps
+ * matrices with irregular row lengths load-balanced without the memory
+ * overhead.
+ */
+public class SparseMatrixSELLFloat {
+
+    /**
+     * Column index of padded entries.
+     */
+    public static final int PADDING = SparseMatrixELLFloat.PADDING;
+
+    private final int numRows;
+
+    private final int numColumns;
+
+    private final int chunkHeight;
+
+    private final int sigma;
+
+    /**
+     * Offset of the first entry of each chunk (numChunks + 1 entries)
+     */
+    private final int[] chunkPointers;
+
+    /**
+     * Number of entries stored per row of each chunk
+     */
+    private final int[] chunkWidths;
+
+    private final int[] rowPermutation;
+
+    private final int[] columnIndexes;
+
+    private final float[] values;
+
+    public SparseMatrixSELLFloat(int numRows, int numColumns, int chunkHeight, int sigma, int[] chunkPointers, int[] chunkWidths, int[] rowPermutation, int[] columnIndexes, float[] values) {
+        if (chunkPointers.length != chunkWidths.length + 1 || rowPermutation.length != numRows) {
+            throw new IllegalArgumentException(format("inconsistent SELL layout: chunks=%d, pointers=%d, permutation=%d", chunkWidths.length, chunkPointers.length, rowPermutation.length));
+        }
+        if (columnIndexes.length != chunkPointers[chunkWidths.length] || values.length != columnIndexes.length) {
+            throw new IllegalArgumentException(format("expected %d entries but found columns=%d, values=%d", chunkPointers[chunkWidths.length], columnIndexes.length, values.length));
+        }
+        this.numRows = numRows;
+        this.numColumns = numColumns;
+        this.chunkHeight = chunkHeight;
+        this.sigma = sigma;
+        this.chunkPointers = chunkPointers;
+        this.chunkWidths = chunkWidths;
+        this.rowPermutation = rowPermutation;
+        this.columnIndexes = columnIndexes;
+        this.values = values;
+    }
+
+    public int getNumRows() {
+        return numRows;
+    }
+
+    public int getNumColumns() {
+        return numColumns;
+    }
+
+    public int getChunkHeight() {
+        return chunkHeight;
+    }
+
+    public int getSigma() {
+        return sigma;
+    }
+
+    public int getNumChunks() {
+        return chunkWidths.length;
+    }
+
+    public int[] getChunkPointers() {
+        return chunkPointers;
+    }
+
+    public int[] getChunkWidths() {
+        return chunkWidths;
+    }
+
+    public int[] getRowPermutation() {
+        return rowPermutation;
+    }
+
+    public int[] getColumnIndexes() {
+        return columnIndexes;
+    }
+
+    public float[] getValues() {
+        return values;
+    }
+
+    @Override
+    public String toString() {
+        return format("SparseMatrixSELLFloat <%d x %d, C=%d, sigma=%d, stored=%d>", numRows, numColumns, chunkHeight, sigma, values.length);
+    }
+}
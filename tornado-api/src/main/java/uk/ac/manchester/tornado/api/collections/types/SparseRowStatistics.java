@@ -0,0 +1,125 @@
+/*
+ * This file is part of Tornado: A heterogeneous programming framework: 
+ * https://github.com/beehive-lab/tornadovm
+ *
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * GNU Classpath is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ * 
+ * GNU Classpath is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Classpath; see the file COPYING.  If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301 USA.
+ *
+ * Linking this library statically or dynamically with other modules is
+ * making a combined work based on this library.  Thus, the terms and
+ * conditions of the GNU General Public License cover the whole
+ * combination.
+ * 
+ * As a special exception, the copyright holders of this library give you
+ * permission to link this library with independent modules to produce an
+ * executable, regardless of the license terms of these independent
+ * modules, and to copy and distribute the resulting executable under
+ * terms of your choice, provided that you also meet, for each linked
+ * independent module, the terms and conditions of the license of that
+ * module.  An independent module is a module which is not derived from
+ * or based on this library.  If you modify this library, you may extend
+ * this exception to your version of the library, but you are not
+ * obligated to do so.  If you do not wish to do so, delete this
+ * exception statement from your version.
+ *
+ */
+package uk.ac.manchester.tornado.api.collections.types;
+
+import static java.lang.String.format;
+
+/**
+ * Row-length statistics of a sparse matrix, used to pick the storage format
+ * and kernel (see {@link SparseMatrixFormat#select(SparseRowStatistics)}).
+ */
+public class SparseRowStatistics {
+
+    private final int numRows;
+    private final int numNonZeros;
+    private final int minRowLength;
+    private final int maxRowLength;
+    private final double meanRowLength;
+    private final double standardDeviation;
+
+    public SparseRowStatistics(SparseMatrixCSRFloat matrix) {
+        numRows = matrix.getNumRows();
+        numNonZeros = matrix.getNumNonZeros();
+
+        int min = numRows == 0 ? 0 : Integer.MAX_VALUE;
+        int max = 0;
+        for (int i = 0; i < numRows; i++) {
+            final int length = matrix.getRowLength(i);
+            min = Math.min(min, length);
+            max = Math.max(max, length);
+        }
+        minRowLength = min;
+        maxRowLength = max;
+        meanRowLength = numRows == 0 ? 0 : (double) numNonZeros / numRows;
+
+        double sumOfSquares = 0;
+        for (int i = 0; i < numRows; i++) {
+            final double delta = matrix.getRowLength(i) - meanRowLength;
+            sumOfSquares += delta * delta;
+        }
+        standardDeviation = numRows == 0 ? 0 : Math.sqrt(sumOfSquares / numRows);
+    }
+
+    public int getNumRows() {
+        return numRows;
+    }
+
+    public int getNumNonZeros() {
+        return numNonZeros;
+    }
+
+    public int getMinRowLength() {
+        return minRowLength;
+    }
+
+    public int getMaxRowLength() {
+        return maxRowLength;
+    }
+
+    public double getMeanRowLength() {
+        return meanRowLength;
+    }
+
+    public double getStandardDeviation() {
+        return standardDeviation;
+    }
+
+    /**
+     * Standard deviation relative to the mean row length; 0 for perfectly
+     * regular matrices.
+     */
+    public double getCoefficientOfVariation() {
+        return meanRowLength == 0 ? 0 : standardDeviation / meanRowLength;
+    }
+
+    /**
+     * Ratio between the entries stored by ELLPACK and the actual non-zeros.
+     */
+    public double getELLPaddingRatio() {
+        return numNonZeros == 0 ? 1 : ((double) maxRowLength * numRows) / numNonZeros;
+    }
+
+    @Override
+    public String toString() {
+        return format("rows=%d, nnz=%d, min=%d, max=%d, mean=%.2f, stddev=%.2f", numRows, numNonZeros, minRowLength, maxRowLength, meanRowLength, standardDeviation);
+    }
+}
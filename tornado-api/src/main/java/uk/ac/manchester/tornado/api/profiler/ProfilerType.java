@@ -38,6 +38,10 @@ public enum ProfilerType {
     DEVICE("Device"),
     TASK_COPY_IN_SIZE_BYTES("CopyIn-Size (Bytes)"),
     TASK_COPY_OUT_SIZE_BYTES("CopyOut-Size (Bytes)"),
+    TASK_REGISTERS("Registers"),
+    TASK_SPILL_STORES_BYTES("Spill-Stores (Bytes)"),
+    TASK_SPILL_LOADS_BYTES("Spill-Loads (Bytes)"),
+    TASK_SHARED_MEMORY_BYTES("Shared-Memory (Bytes)"),
     TASK_COMPILE_DRIVER_TIME("Task-Compile-Driver-"),
     TASK_COMPILE_GRAAL_TIME("Task-Compile-Graal-"),
     TASK_KERNEL_TIME("Task-Kernel-"),
@@ -45,7 +49,8 @@ public enum ProfilerType {
     TOTAL_DRIVER_COMPILE_TIME("Total-Driver-Compilation-Time"),
     TOTAL_GRAAL_COMPILE_TIME("Total-Graal-Compilation-Time"),
     TOTAL_KERNEL_TIME("Kernel-Time"),
-    TOTAL_TASK_SCHEDULE_TIME("TS-Total-Time");
+    TOTAL_TASK_SCHEDULE_TIME("TS-Total-Time"),
+    SAMPLING_WEIGHT("Sampling-Weight");
     // @formatter:on
 
     String description;
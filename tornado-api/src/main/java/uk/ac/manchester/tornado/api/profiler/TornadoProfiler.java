@@ -27,6 +27,8 @@ public interface TornadoProfiler {
 
     void addValueToMetric(ProfilerType type, String taskName, long value);
 
+    void setMetric(ProfilerType type, String taskName, long value);
+
     void start(ProfilerType type);
 
     void start(ProfilerType type, String taskName);
@@ -37,6 +39,8 @@ public interface TornadoProfiler {
 
     void registerMethodHandle(ProfilerType type, String taskName, String methodName);
 
+    void registerMetaData(ProfilerType type, String value);
+
     void stop(ProfilerType type);
 
     void stop(ProfilerType type, String taskName);
@@ -1,6 +1,7 @@
 open module tornado.unittests {
     requires transitive junit;
     requires transitive tornado.api;
+    requires tornado.runtime;
     requires lucene.core;
 
     exports uk.ac.manchester.tornado.unittests;
@@ -25,6 +26,7 @@ open module tornado.unittests {
     exports uk.ac.manchester.tornado.unittests.prebuilt;
     exports uk.ac.manchester.tornado.unittests.profiler;
     exports uk.ac.manchester.tornado.unittests.reductions;
+    exports uk.ac.manchester.tornado.unittests.runtime;
     exports uk.ac.manchester.tornado.unittests.slam.graphics;
     exports uk.ac.manchester.tornado.unittests.tasks;
     exports uk.ac.manchester.tornado.unittests.tools;
@@ -75,6 +75,35 @@ public class TestAPI extends TornadoTestBase {
         }
     }
 
+    @Test
+    public void testSyncAfterEachExecution() {
+        final int N = 128;
+        int size = 20;
+
+        int[] data = new int[N];
+
+        IntStream.range(0, N).parallel().forEach(idx -> {
+            data[idx] = size;
+        });
+
+        TaskSchedule s0 = new TaskSchedule("s0");
+        assertNotNull(s0);
+
+        s0.task("t0", TestArrays::addAccumulator, data, 1);
+        for (int iteration = 1; iteration <= 3; iteration++) {
+            s0.execute();
+            // The call stack stays on the device, so every launch has to mark data as written
+            if (iteration % 2 == 0) {
+                s0.syncObject(data);
+            } else {
+                s0.syncObjects(data);
+            }
+            for (int i = 0; i < N; i++) {
+                assertEquals(size + iteration, data[i]);
+            }
+        }
+    }
+
     @Test
     public void testWarmUp() {
         final int N = 128;
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020, APT Group, Department of Computer Science,
+ * The University of Manchester.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+package uk.ac.manchester.tornado.unittests.arrays;
+
+import static org.junit.Assert.assertEquals;
+
+import java.util.Random;
+
+import org.junit.Test;
+
+import uk.ac.manchester.tornado.api.TaskSchedule;
+import uk.ac.manchester.tornado.api.annotations.Parallel;
+import uk.ac.manchester.tornado.unittests.common.TornadoTestBase;
+
+/**
+ * Small read-only arrays, such as the filter of a convolution, are read from
+ * constant memory on the device with -Dtornado.constant.params=True.
+ */
+public class TestReadOnlyArrays extends TornadoTestBase {
+
+    private static final int SIZE = 4096;
+    private static final int FILTER_SIZE = 7;
+
+    public static void convolution(float[] input, float[] filter, float[] output) {
+        for (@Parallel int i = 0; i < output.length; i++) {
+            float sum = 0.0f;
+            for (int k = 0; k < filter.length; k++) {
+                int index = Math.min(Math.max(i + k - filter.length / 2, 0), input.length - 1);
+                sum += input[index] * filter[k];
+            }
+            output[i] = sum;
+        }
+    }
+
+    private static void checkConvolution(float[] input, float[] filter, float[] output) {
+        float[] expected = new float[output.length];
+        convolution(input, filter, expected);
+        for (int i = 0; i < output.length; i++) {
+            assertEquals(expected[i], output[i], 0.001f);
+        }
+    }
+
+    @Test
+    public void testConvolutionFilter() {
+        Random random = new Random();
+        float[] input = new float[SIZE];
+        float[] filter = new float[FILTER_SIZE];
+        float[] output = new float[SIZE];
+
+        for (int i = 0; i < SIZE; i++) {
+            input[i] = random.nextFloat();
+        }
+        for (int i = 0; i < FILTER_SIZE; i++) {
+            filter[i] = random.nextFloat();
+        }
+
+        new TaskSchedule("s0") //
+                .task("t0", TestReadOnlyArrays::convolution, input, filter, output) //
+                .streamOut(output) //
+                .execute();
+
+        checkConvolution(input, filter, output);
+    }
+
+    @Test
+    public void testUpdatedFilter() {
+        Random random = new Random();
+        float[] input = new float[SIZE];
+        float[] filter = new float[FILTER_SIZE];
+        float[] output = new float[SIZE];
+
+        for (int i = 0; i < SIZE; i++) {
+            input[i] = random.nextFloat();
+        }
+
+        TaskSchedule ts = new TaskSchedule("s0") //
+                .streamIn(filter) //
+                .task("t0", TestReadOnlyArrays::convolution, input, filter, output) //
+                .streamOut(output);
+
+        for (int run = 0; run < 3; run++) {
+            for (int i = 0; i < FILTER_SIZE; i++) {
+                filter[i] = random.nextFloat();
+            }
+            ts.execute();
+            checkConvolution(input, filter, output);
+        }
+    }
+}
@@ -18,11 +18,13 @@
 
 package uk.ac.manchester.tornado.unittests.atomics;
 
+import static org.junit.Assert.assertArrayEquals;
 import static org.junit.Assert.assertEquals;
 import static org.junit.Assert.assertTrue;
 
 import java.util.Arrays;
 import java.util.HashSet;
+import java.util.Random;
 import java.util.concurrent.atomic.AtomicInteger;
 import java.util.stream.IntStream;
 
@@ -31,6 +33,7 @@ import org.junit.Test;
 import uk.ac.manchester.tornado.api.TaskSchedule;
 import uk.ac.manchester.tornado.api.TornadoVM_Intrinsics;
 import uk.ac.manchester.tornado.api.annotations.Parallel;
+import uk.ac.manchester.tornado.api.atomics.TornadoAtomics;
 import uk.ac.manchester.tornado.api.common.Access;
 import uk.ac.manchester.tornado.api.common.TornadoDevice;
 import uk.ac.manchester.tornado.api.runtime.TornadoRuntime;
@@ -520,4 +523,133 @@ public class TestAtomics extends TornadoTestBase {
         assertEquals(initialValueA + (iterations * size), lastValue);
     }
 
+    public static void atomicHistogram(int[] input, int[] histogram) {
+        for (@Parallel int i = 0; i < input.length; i++) {
+            TornadoAtomics.atomicAdd(histogram, input[i], 1);
+        }
+    }
+
+    @Test
+    public void testAtomicHistogram() {
+        final int size = 2048;
+        final int numBins = 16;
+        int[] input = new int[size];
+        int[] histogram = new int[numBins];
+        int[] sequential = new int[numBins];
+
+        Random r = new Random();
+        IntStream.range(0, size).forEach(i -> input[i] = r.nextInt(numBins));
+
+        new TaskSchedule("s0") //
+                .task("t0", TestAtomics::atomicHistogram, input, histogram) //
+                .streamOut(histogram) //
+                .execute();
+
+        atomicHistogram(input, sequential);
+        assertArrayEquals(sequential, histogram);
+    }
+
+    public static void atomicAddLong(long[] input, long[] result) {
+        for (@Parallel int i = 0; i < input.length; i++) {
+            TornadoAtomics.atomicAdd(result, 0, input[i]);
+        }
+    }
+
+    @Test
+    public void testAtomicAddLong() {
+        final int size = 1024;
+        long[] input = new long[size];
+        long[] result = new long[1];
+
+        IntStream.range(0, size).forEach(i -> input[i] = i + Integer.MAX_VALUE);
+
+        new TaskSchedule("s0") //
+                .task("t0", TestAtomics::atomicAddLong, input, result) //
+                .streamOut(result) //
+                .execute();
+
+        long expected = Arrays.stream(input).sum();
+        assertEquals(expected, result[0]);
+    }
+
+    public static void atomicAddFloat(float[] input, float[] result) {
+        for (@Parallel int i = 0; i < input.length; i++) {
+            TornadoAtomics.atomicAdd(result, 0, input[i]);
+        }
+    }
+
+    @Test
+    public void testAtomicAddFloat() {
+        final int size = 1024;
+        float[] input = new float[size];
+        float[] result = new float[1];
+
+        Arrays.fill(input, 1.0f);
+
+        new TaskSchedule("s0") //
+                .task("t0", TestAtomics::atomicAddFloat, input, result) //
+                .streamOut(result) //
+                .execute();
+
+        assertEquals(size, result[0], 0.01f);
+    }
+
+    public static void atomicMinMaxInt(int[] input, int[] result) {
+        for (@Parallel int i = 0; i < input.length; i++) {
+            TornadoAtomics.atomicMin(result, 0, input[i]);
+            TornadoAtomics.atomicMax(result, 1, input[i]);
+        }
+    }
+
+    @Test
+    public void testAtomicMinMaxInt() {
+        final int size = 1024;
+        int[] input = new int[size];
+        int[] result = new int[] { Integer.MAX_VALUE, Integer.MIN_VALUE };
+
+        Random r = new Random();
+        IntStream.range(0, size).forEach(i -> input[i] = r.nextInt());
+
+        new TaskSchedule("s0") //
+                .streamIn(result) //
+                .task("t0", TestAtomics::atomicMinMaxInt, input, result) //
+                .streamOut(result) //
+                .execute();
+
+        assertEquals(Arrays.stream(input).min().getAsInt(), result[0]);
+        assertEquals(Arrays.stream(input).max().getAsInt(), result[1]);
+    }
+
+    public static void atomicMinMaxFloat(float[] input, float[] result) {
+        for (@Parallel int i = 0; i < input.length; i++) {
+            TornadoAtomics.atomicMin(result, 0, input[i]);
+            TornadoAtomics.atomicMax(result, 1, input[i]);
+        }
+    }
+
+    @Test
+    public void testAtomicMinMaxFloat() {
+        final int size = 1024;
+        float[] input = new float[size];
+        float[] result = new float[] { Float.MAX_VALUE, -Float.MAX_VALUE };
+
+        Random r = new Random();
+        IntStream.range(0, size).forEach(i -> input[i] = r.nextFloat() * 100.0f - 50.0f);
+
+        new TaskSchedule("s0") //
+                .streamIn(result) //
+                .task("t0", TestAtomics::atomicMinMaxFloat, input, result) //
+                .streamOut(result) //
+                .execute();
+
+        float min = Float.MAX_VALUE;
+        float max = -Float.MAX_VALUE;
+        for (float v : input) {
+            min = Math.min(min, v);
+            max = Math.max(max, v);
+        }
+        assertEquals(min, result[0], 0.001f);
+        assertEquals(max, result[1], 0.001f);
+    }
+
 }
@@ -17,6 +17,8 @@
  */
 package uk.ac.manchester.tornado.unittests.fails;
 
+import static org.junit.Assert.assertEquals;
+
 import java.util.Random;
 import java.util.stream.IntStream;
 
@@ -123,4 +125,45 @@ public class CodeFail extends TornadoTestBase {
 
         task.execute();
     }
+
+    public static void baz(float[] a) {
+        Matrix2DFloat f = new Matrix2DFloat(256, 256); // Allocation here
+        for (@Parallel int i = 0; i < a.length; i++) {
+            f.set(i % 256, 0, a[i]);
+            a[i] = 2 * a[i];
+        }
+    }
+
+    /**
+     * After a bailout, later executions of the same task, also from other
+     * task-schedules, run the sequential implementation without compiling again.
+     * The profiler shows that the second task-schedule spends no time in the
+     * compiler.
+     */
+    @Test
+    public void codeFail04() {
+        float[] a = new float[1000];
+        IntStream.range(0, a.length).forEach(i -> a[i] = i);
+
+        TaskSchedule s0 = new TaskSchedule("s0") //
+                .task("t0", CodeFail::baz, a) //
+                .streamOut(a);
+        s0.execute();
+        s0.execute();
+
+        System.setProperty("tornado.profiler", "True");
+        TaskSchedule s1 = new TaskSchedule("s1") //
+                .task("t0", CodeFail::baz, a) //
+                .streamOut(a);
+        s1.execute();
+        System.setProperty("tornado.profiler", "False");
+        assertEquals(0, s1.getTornadoCompilerTime());
+
+        s0.invalidateBailouts();
+        s0.execute();
+
+        for (int i = 0; i < a.length; i++) {
+            assertEquals(16.0f * i, a[i], 0.01f);
+        }
+    }
 }
@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ */
+
+package uk.ac.manchester.tornado.unittests.images;
+
+import static org.junit.Assert.assertEquals;
+
+import org.junit.Test;
+
+import uk.ac.manchester.tornado.api.TaskSchedule;
+import uk.ac.manchester.tornado.api.annotations.Parallel;
+import uk.ac.manchester.tornado.api.collections.types.Byte4;
+import uk.ac.manchester.tornado.api.collections.types.Float3;
+import uk.ac.manchester.tornado.api.collections.types.Float4;
+import uk.ac.manchester.tornado.api.collections.types.ImageByte4;
+import uk.ac.manchester.tornado.api.collections.types.ImageFloat;
+import uk.ac.manchester.tornado.api.collections.types.ImageFloat3;
+import uk.ac.manchester.tornado.api.collections.types.ImageFloat4;
+import uk.ac.manchester.tornado.unittests.common.TornadoTestBase;
+
+/**
+ * Tests for image parameters backed by device images (OpenCL images or CUDA
+ * texture objects). They are meant to run with {@code -Dtornado.images=True},
+ * and produce the same results without it.
+ *
+ * How to run?
+ *
+ * <code>
+ *     tornado-test.py -V -J"-Dtornado.images=True" uk.ac.manchester.tornado.unittests.images.TestDeviceImages
+ * </code>
+ */
+public class TestDeviceImages extends TornadoTestBase {
+
+    private static final int X = 64;
+    private static final int Y = 32;
+
+    public static void copyImageFloat(final ImageFloat a, final ImageFloat b) {
+        for (@Parallel int i = 0; i < a.X(); i++) {
+            for (@Parallel int j = 0; j < a.Y(); j++) {
+                b.set(i, j, a.get(i, j));
+            }
+        }
+    }
+
+    public static void copyImageFloat3(final ImageFloat3 a, final ImageFloat3 b) {
+        for (@Parallel int i = 0; i < a.X(); i++) {
+            for (@Parallel int j = 0; j < a.Y(); j++) {
+                b.set(i, j, a.get(i, j));
+            }
+        }
+    }
+
+    public static void copyImageFloat4(final ImageFloat4 a, final ImageFloat4 b) {
+        for (@Parallel int i = 0; i < a.X(); i++) {
+            for (@Parallel int j = 0; j < a.Y(); j++) {
+                b.set(i, j, a.get(i, j));
+            }
+        }
+    }
+
+    public static void copyImageByte4(final ImageByte4 a, final ImageByte4 b) {
+        for (@Parallel int i = 0; i < a.X(); i++) {
+            for (@Parallel int j = 0; j < a.Y(); j++) {
+                b.set(i, j, a.get(i, j));
+            }
+        }
+    }
+
+    public static void incrementInPlace(final ImageFloat a) {
+        for (@Parallel int i = 0; i < a.X(); i++) {
+            for (@Parallel int j = 0; j < a.Y(); j++) {
+                a.set(i, j, a.get(i, j) + 1f);
+            }
+        }
+    }
+
+    public static void writeCoordinates(final ImageFloat a) {
+        for (@Parallel int i = 0; i < a.X(); i++) {
+            for (@Parallel int j = 0; j < a.Y(); j++) {
+                a.set(i, j, i * 1000 + j);
+            }
+        }
+    }
+
+    private static float readScaled(final ImageFloat a, int i, int j) {
+        return a.get(i, j) * 2f;
+    }
+
+    public static void copyScaledThroughHelper(final ImageFloat a, final ImageFloat b) {
+        for (@Parallel int i = 0; i < a.X(); i++) {
+            for (@Parallel int j = 0; j < a.Y(); j++) {
+                b.set(i, j, readScaled(a, i, j));
+            }
+        }
+    }
+
+    private static ImageFloat createCoordinateImage() {
+        final ImageFloat image = new ImageFloat(X, Y);
+        for (int i = 0; i < X; i++) {
+            for (int j = 0; j < Y; j++) {
+                image.set(i, j, i * 1000 + j);
+            }
+        }
+        return image;
+    }
+
+    @Test
+    public void testReadImageFloat() {
+        final ImageFloat a = createCoordinateImage();
+        final ImageFloat b = new ImageFloat(X, Y);
+
+        new TaskSchedule("s0") //
+                .task("t0", TestDeviceImages::copyImageFloat, a, b) //
+                .streamOut(b) //
+                .execute();
+
+        for (int i = 0; i < X; i++) {
+            for (int j = 0; j < Y; j++) {
+                assertEquals(i * 1000 + j, b.get(i, j), 0.001f);
+            }
+        }
+    }
+
+    @Test
+    public void testReadImageFloat3() {
+        final ImageFloat3 a = new ImageFloat3(X, Y);
+        final ImageFloat3 b = new ImageFloat3(X, Y);
+        for (int i = 0; i < X; i++) {
+            for (int j = 0; j < Y; j++) {
+                a.set(i, j, new Float3(i, j, i + j));
+            }
+        }
+
+        new TaskSchedule("s0") //
+                .task("t0", TestDeviceImages::copyImageFloat3, a, b) //
+                .streamOut(b) //
+                .execute();
+
+        for (int i = 0; i < X; i++) {
+            for (int j = 0; j < Y; j++) {
+                Float3 value = b.get(i, j);
+                assertEquals(i, value.getX(), 0.001f);
+                assertEquals(j, value.getY(), 0.001f);
+                assertEquals(i + j, value.getZ(), 0.001f);
+            }
+        }
+    }
+
+    @Test
+    public void testReadImageFloat4() {
+        final ImageFloat4 a = new ImageFloat4(X, Y);
+        final ImageFloat4 b = new ImageFloat4(X, Y);
+        for (int i = 0; i < X; i++) {
+            for (int j = 0; j < Y; j++) {
+                a.set(i, j, new Float4(i, j, i + j, i - j));
+            }
+        }
+
+        new TaskSchedule("s0") //
+                .task("t0", TestDeviceImages::copyImageFloat4, a, b) //
+                .streamOut(b) //
+                .execute();
+
+        for (int i = 0; i < X; i++) {
+            for (int j = 0; j < Y; j++) {
+                Float4 value = b.get(i, j);
+                assertEquals(i, value.getX(), 0.001f);
+                assertEquals(j, value.getY(), 0.001f);
+                assertEquals(i + j, value.getZ(), 0.001f);
+                assertEquals(i - j, value.getW(), 0.001f);
+            }
+        }
+    }
+
+    @Test
+    public void testReadImageByte4() {
+        final ImageByte4 a = new ImageByte4(X, Y);
+        final ImageByte4 b = new ImageByte4(X, Y);
+        for (int i = 0; i < X; i++) {
+            for (int j = 0; j < Y; j++) {
+                a.set(i, j, new Byte4((byte) i, (byte) j, (byte) -i, (byte) (i ^ j)));
+            }
+        }
+
+        new TaskSchedule("s0") //
+                .task("t0", TestDeviceImages::copyImageByte4, a, b) //
+                .streamOut(b) //
+                .execute();
+
+        for (int i = 0; i < X; i++) {
+            for (int j = 0; j < Y; j++) {
+                Byte4 value = b.get(i, j);
+                assertEquals((byte) i, value.getX());
+                assertEquals((byte) j, value.getY());
+                assertEquals((byte) -i, value.getZ());
+                assertEquals((byte) (i ^ j), value.getW());
+            }
+        }
+    }
+
+    /**
+     * The kernel writes the image it reads, so the reads have to see the heap
+     * copy rather than the image taken before the launch.
+     */
+    @Test
+    public void testReadAndWriteSameImage() {
+        final ImageFloat a = createCoordinateImage();
+
+        final TaskSchedule schedule = new TaskSchedule("s0") //
+                .task("t0", TestDeviceImages::incrementInPlace, a) //
+                .streamOut(a);
+
+        schedule.execute();
+        schedule.execute();
+
+        for (int i = 0; i < X; i++) {
+            for (int j = 0; j < Y; j++) {
+                assertEquals(i * 1000 + j + 2, a.get(i, j), 0.001f);
+            }
+        }
+    }
+
+    /**
+     * The first task writes the image on the device, so the second task has to
+     * read it through a refreshed image.
+     */
+    @Test
+    public void testWriterThenReader() {
+        final ImageFloat a = new ImageFloat(X, Y);
+        final ImageFloat b = new ImageFloat(X, Y);
+
+        new TaskSchedule("s0") //
+                .task("t0", TestDeviceImages::writeCoordinates, a) //
+                .task("t1", TestDeviceImages::copyImageFloat, a, b) //
+                .streamOut(b) //
+                .execute();
+
+        for (int i = 0; i < X; i++) {
+            for (int j = 0; j < Y; j++) {
+                assertEquals(i * 1000 + j, b.get(i, j), 0.001f);
+            }
+        }
+    }
+
+    /**
+     * The image is only refreshed when its heap copy changes: a second
+     * execution after a host update has to see the new values.
+     */
+    @Test
+    public void testHostUpdateBetweenExecutions() {
+        final ImageFloat a = createCoordinateImage();
+        final ImageFloat b = new ImageFloat(X, Y);
+
+        final TaskSchedule schedule = new TaskSchedule("s0") //
+                .streamIn(a) //
+                .task("t0", TestDeviceImages::copyImageFloat, a, b) //
+                .streamOut(b);
+
+        schedule.execute();
+        for (int i = 0; i < X; i++) {
+            for (int j = 0; j < Y; j++) {
+                assertEquals(i * 1000 + j, b.get(i, j), 0.001f);
+            }
+        }
+
+        a.fill(-3f);
+        schedule.execute();
+        for (int i = 0; i < X; i++) {
+            for (int j = 0; j < Y; j++) {
+                assertEquals(-3f, b.get(i, j), 0.001f);
+            }
+        }
+    }
+
+    /**
+     * Reads in a helper method that is compiled on its own rather than inlined
+     * have no image argument, and fall back to loads from the storage array.
+     */
+    @Test
+    public void testReadThroughHelper() {
+        final ImageFloat a = createCoordinateImage();
+        final ImageFloat b = new ImageFloat(X, Y);
+
+        new TaskSchedule("s0") //
+                .task("t0", TestDeviceImages::copyScaledThroughHelper, a, b) //
+                .streamOut(b) //
+                .execute();
+
+        for (int i = 0; i < X; i++) {
+            for (int j = 0; j < Y; j++) {
+                assertEquals((i * 1000 + j) * 2f, b.get(i, j), 0.001f);
+            }
+        }
+    }
+}
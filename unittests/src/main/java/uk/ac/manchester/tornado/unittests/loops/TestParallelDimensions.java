@@ -154,4 +154,43 @@ public class TestParallelDimensions extends TornadoTestBase {
             }
         }
     }
+
+    public static void forLoop2DColumnMajor(float[] a, float[] b, int rows, int columns) {
+        for (@Parallel int j = 0; j < columns; j++) {
+            for (@Parallel int i = 0; i < rows; i++) {
+                a[j * rows + i] = b[j * rows + i] * 2.0f + i;
+            }
+        }
+    }
+
+    /**
+     * The outer loop indexes columns of a column-major matrix, so the inner loop
+     * has unit stride and is mapped to the first thread dimension. The domain is
+     * not square to check that the global work follows the new mapping.
+     */
+    @Test
+    public void test2DParallelColumnMajor() {
+        final int rows = 256;
+        final int columns = 64;
+
+        float[] a = new float[rows * columns];
+        float[] b = new float[rows * columns];
+
+        for (int k = 0; k < b.length; k++) {
+            b[k] = k;
+        }
+
+        //@formatter:off
+        new TaskSchedule("s0")
+                .task("t0", TestParallelDimensions::forLoop2DColumnMajor, a, b, rows, columns)
+                .streamOut(a)
+                .execute();
+        //@formatter:on
+
+        for (int j = 0; j < columns; j++) {
+            for (int i = 0; i < rows; i++) {
+                assertEquals(b[j * rows + i] * 2.0f + i, a[j * rows + i], 0.001f);
+            }
+        }
+    }
 }
@@ -18,6 +18,7 @@
 package uk.ac.manchester.tornado.unittests.math;
 
 import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
 
 import java.util.stream.IntStream;
 
@@ -26,6 +27,7 @@ import org.junit.Test;
 import uk.ac.manchester.tornado.api.TaskSchedule;
 import uk.ac.manchester.tornado.api.annotations.Parallel;
 import uk.ac.manchester.tornado.api.collections.math.TornadoMath;
+import uk.ac.manchester.tornado.api.collections.types.VectorFloat;
 import uk.ac.manchester.tornado.unittests.common.TornadoTestBase;
 
 public class TestTornadoMathCollection extends TornadoTestBase {
@@ -71,6 +73,12 @@ public class TestTornadoMathCollection extends TornadoTestBase {
         }
     }
 
+    public static void testTornadoExp(VectorFloat a) {
+        for (@Parallel int i = 0; i < a.size(); i++) {
+            a.set(i, TornadoMath.exp(a.get(i)));
+        }
+    }
+
     public static void testTornadoClamp(double[] a) {
         for (@Parallel int i = 0; i < a.length; i++) {
             a[i] = TornadoMath.clamp(a[i], 10, 20);
@@ -101,6 +109,24 @@ public class TestTornadoMathCollection extends TornadoTestBase {
         }
     }
 
+    public static void testTornadoFastExp(float[] a) {
+        for (@Parallel int i = 0; i < a.length; i++) {
+            a[i] = TornadoMath.fastExp(a[i]);
+        }
+    }
+
+    public static void testTornadoFastRsqrt(float[] a) {
+        for (@Parallel int i = 0; i < a.length; i++) {
+            a[i] = TornadoMath.fastRsqrt(a[i]);
+        }
+    }
+
+    public static void testTornadoMixedPrecision(float[] a, float[] b) {
+        for (@Parallel int i = 0; i < a.length; i++) {
+            b[i] = TornadoMath.exp(a[i]) + TornadoMath.fastSin(a[i]) * TornadoMath.fastLog(a[i] + 1);
+        }
+    }
+
     public static void testTornadoPI(double[] a) {
         for (@Parallel int i = 0; i < a.length; i++) {
             a[i] = TornadoMath.PI();
@@ -368,4 +394,123 @@ public class TestTornadoMathCollection extends TornadoTestBase {
 
     }
 
+    @Test
+    public void testTornadoSinFastMath() {
+        final int size = 1024;
+        float[] data = new float[size];
+        float[] seq = new float[size];
+
+        IntStream.range(0, size).parallel().forEach(i -> {
+            data[i] = (float) Math.random();
+            seq[i] = data[i];
+        });
+
+        TaskSchedule s0 = new TaskSchedule("s0");
+        s0.useFastMath();
+        s0.task("t0", TestTornadoMathCollection::testTornadoSin, data).streamOut(data).execute();
+
+        testTornadoSin(seq);
+
+        assertArrayEquals(data, seq, 0.01f);
+    }
+
+    @Test
+    public void testTornadoExpFastMathAccuracyCheck() {
+        final int size = 1024;
+        float[] data = new float[size];
+        float[] seq = new float[size];
+
+        IntStream.range(0, size).parallel().forEach(i -> {
+            data[i] = (float) Math.random();
+            seq[i] = data[i];
+        });
+
+        // Either fast-math is accurate enough or the schedule falls back to the default mode
+        TaskSchedule s0 = new TaskSchedule("s0");
+        s0.useFastMath(1e-3);
+        s0.task("t0", TestTornadoMathCollection::testTornadoExp, data).streamOut(data).execute();
+
+        testTornadoExp(seq);
+
+        assertArrayEquals(data, seq, 1e-2f);
+    }
+
+    @Test
+    public void testTornadoExpFastMathAccuracyCheckVector() {
+        final int size = 1024;
+        VectorFloat data = new VectorFloat(size);
+        VectorFloat seq = new VectorFloat(size);
+
+        IntStream.range(0, size).forEach(i -> {
+            data.set(i, (float) Math.random());
+            seq.set(i, data.get(i));
+        });
+
+        // The check must cover collection types too, not only primitive arrays
+        TaskSchedule s0 = new TaskSchedule("s0");
+        s0.useFastMath(1e-3);
+        s0.task("t0", TestTornadoMathCollection::testTornadoExp, data).streamOut(data).execute();
+
+        testTornadoExp(seq);
+
+        for (int i = 0; i < size; i++) {
+            assertEquals(seq.get(i), data.get(i), 1e-2f);
+        }
+    }
+
+    @Test
+    public void testTornadoMathFastExp() {
+        final int size = 1024;
+        float[] data = new float[size];
+        float[] seq = new float[size];
+
+        IntStream.range(0, size).parallel().forEach(i -> {
+            data[i] = (float) Math.random();
+            seq[i] = data[i];
+        });
+
+        TaskSchedule s0 = new TaskSchedule("s0");
+        s0.task("t0", TestTornadoMathCollection::testTornadoFastExp, data).streamOut(data).execute();
+
+        testTornadoFastExp(seq);
+
+        assertArrayEquals(data, seq, 1e-2f);
+    }
+
+    @Test
+    public void testTornadoMathFastRsqrt() {
+        final int size = 1024;
+        float[] data = new float[size];
+        float[] seq = new float[size];
+
+        IntStream.range(0, size).parallel().forEach(i -> {
+            data[i] = (float) Math.random() + 1;
+            seq[i] = data[i];
+        });
+
+        TaskSchedule s0 = new TaskSchedule("s0");
+        s0.task("t0", TestTornadoMathCollection::testTornadoFastRsqrt, data).streamOut(data).execute();
+
+        testTornadoFastRsqrt(seq);
+
+        assertArrayEquals(data, seq, 1e-2f);
+    }
+
+    @Test
+    public void testTornadoMathMixedPrecision() {
+        final int size = 1024;
+        float[] a = new float[size];
+        float[] b = new float[size];
+        float[] seq = new float[size];
+
+        IntStream.range(0, size).parallel().forEach(i -> a[i] = (float) Math.random());
+
+        TaskSchedule s0 = new TaskSchedule("s0");
+        s0.task("t0", TestTornadoMathCollection::testTornadoMixedPrecision, a, b).streamOut(b).execute();
+
+        testTornadoMixedPrecision(a, seq);
+
+        assertArrayEquals(seq, b, 1e-2f);
+    }
+
 }
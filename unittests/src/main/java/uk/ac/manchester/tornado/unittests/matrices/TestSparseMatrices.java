@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ */
+
+
+package uk.ac.manchester.tornado.unittests.matrices;
+
+import static org.junit.Assert.assertEquals;
+
+import java.util.Random;
+
+import org.junit.Test;
+
+import uk.ac.manchester.tornado.api.TaskSchedule;
+import uk.ac.manchester.tornado.api.collections.math.SparseLinearAlgebra;
+import uk.ac.manchester.tornado.api.collections.types.SparseMatrixCSRFloat;
+import uk.ac.manchester.tornado.api.collections.types.SparseMatrixELLFloat;
+import uk.ac.manchester.tornado.api.collections.types.SparseMatrixFormat;
+import uk.ac.manchester.tornado.api.collections.types.SparseMatrixSELLFloat;
+import uk.ac.manchester.tornado.unittests.common.TornadoTestBase;
+
+public class TestSparseMatrices extends TornadoTestBase {
+
+    private static final float DELTA = 0.01f;
+
+    /**
+     * Builds a square matrix whose row lengths grow with the row index when
+     * {@code irregular} is set, and are all equal otherwise.
+     */
+    private static SparseMatrixCSRFloat createMatrix(int size, boolean irregular) {
+        Random r = new Random(31);
+        float[] dense = new float[size * size];
+        for (int i = 0; i < size; i++) {
+            int rowLength = irregular ? 1 + (i % 64) * (i % 3) : 8;
+            for (int j = 0; j < rowLength; j++) {
+                dense[i * size + ((i + j * 7) % size)] = r.nextFloat() + 1.0f;
+            }
+        }
+        return SparseMatrixCSRFloat.fromDense(size, size, dense);
+    }
+
+    private static float[] createVector(int size) {
+        Random r = new Random(17);
+        float[] x = new float[size];
+        for (int i = 0; i < size; i++) {
+            x[i] = r.nextFloat();
+        }
+        return x;
+    }
+
+    private static float[] spmvSequential(SparseMatrixCSRFloat matrix, float[] x) {
+        float[] y = new float[matrix.getNumRows()];
+        SparseLinearAlgebra.spmvCSR(matrix.getRowPointers(), matrix.getColumnIndexes(), matrix.getValues(), matrix.getNumRows(), x, y);
+        return y;
+    }
+
+    @Test
+    public void testConversions() {
+        SparseMatrixCSRFloat csr = createMatrix(200, true);
+        float[] x = createVector(200);
+        float[] expected = spmvSequential(csr, x);
+
+        SparseMatrixELLFloat ell = csr.toELL();
+        float[] ellResult = new float[200];
+        SparseLinearAlgebra.spmvELL(ell.getColumnIndexes(), ell.getValues(), ell.getNumRows(), ell.getWidth(), x, ellResult);
+
+        SparseMatrixSELLFloat sell = csr.toSELL(8, 32);
+        float[] sellResult = new float[200];
+        SparseLinearAlgebra.spmvSELL(sell.getChunkPointers(), sell.getChunkWidths(), sell.getRowPermutation(), sell.getColumnIndexes(), sell.getValues(), sell.getNumRows(), sell.getChunkHeight(), x,
+                sellResult);
+
+        for (int i = 0; i < expected.length; i++) {
+            assertEquals(expected[i], ellResult[i], DELTA);
+            assertEquals(expected[i], sellResult[i], DELTA);
+        }
+    }
+
+    /**
+     * Padded ELL/SELL entries must not read {@code x}: a NaN in a column that
+     * no row references must not poison the rows that were padded.
+     */
+    @Test
+    public void testPaddingSkipsDenseOperand() {
+        int[] rows = new int[] { 0, 0, 1, 2, 3, 3, 3 };
+        int[] cols = new int[] { 1, 2, 3, 1, 1, 2, 3 };
+        float[] vals = new float[] { 1, 2, 3, 4, 5, 6, 7 };
+        SparseMatrixCSRFloat csr = SparseMatrixCSRFloat.fromCoordinates(4, 4, rows, cols, vals);
+        float[] x = new float[] { Float.NaN, 1, 2, 3 };
+        float[] expected = spmvSequential(csr, x);
+
+        SparseMatrixELLFloat ell = csr.toELL();
+        SparseMatrixSELLFloat sell = csr.toSELL(2, 4);
+        float[] ellResult = new float[4];
+        float[] sellResult = new float[4];
+
+        //@formatter:off
+        new TaskSchedule("s0")
+                .task("t0", SparseLinearAlgebra::spmvELL, ell.getColumnIndexes(), ell.getValues(), ell.getNumRows(), ell.getWidth(), x, ellResult)
+                .task("t1", SparseLinearAlgebra::spmvSELL, sell.getChunkPointers(), sell.getChunkWidths(), sell.getRowPermutation(), sell.getColumnIndexes(), sell.getValues(),
+                        sell.getNumRows(), sell.getChunkHeight(), x, sellResult)
+                .streamOut(ellResult, sellResult)
+                .execute();
+        //@formatter:on
+
+        for (int i = 0; i < expected.length; i++) {
+            assertEquals(expected[i], ellResult[i], DELTA);
+            assertEquals(expected[i], sellResult[i], DELTA);
+        }
+    }
+
+    @Test
+    public void testFromCoordinates() {
+        int[] rows = new int[] { 2, 0, 1, 0, 2 };
+        int[] cols = new int[] { 1, 3, 0, 0, 0 };
+        float[] vals = new float[] { 5, 2, 3, 1, 4 };
+        SparseMatrixCSRFloat csr = SparseMatrixCSRFloat.fromCoordinates(3, 4, rows, cols, vals);
+
+        assertEquals(5, csr.getNumNonZeros());
+        assertEquals(1, csr.get(0, 0), DELTA);
+        assertEquals(2, csr.get(0, 3), DELTA);
+        assertEquals(3, csr.get(1, 0), DELTA);
+        assertEquals(4, csr.get(2, 0), DELTA);
+        assertEquals(5, csr.get(2, 1), DELTA);
+        assertEquals(0, csr.get(1, 1), DELTA);
+    }
+
+    @Test
+    public void testFormatSelection() {
+        assertEquals(SparseMatrixFormat.ELL, SparseMatrixFormat.select(createMatrix(256, false).getRowStatistics()));
+        assertEquals(SparseMatrixFormat.SELL, SparseMatrixFormat.select(createMatrix(256, true).getRowStatistics()));
+    }
+
+    @Test
+    public void testSpMVCSR() {
+        SparseMatrixCSRFloat csr = createMatrix(1024, true);
+        float[] x = createVector(1024);
+        float[] y = new float[1024];
+
+        //@formatter:off
+        new TaskSchedule("s0")
+                .task("t0", SparseLinearAlgebra::spmvCSR, csr.getRowPointers(), csr.getColumnIndexes(), csr.getValues(), csr.getNumRows(), x, y)
+                .streamOut(y)
+                .execute();
+        //@formatter:on
+
+        float[] expected = spmvSequential(csr, x);
+        for (int i = 0; i < y.length; i++) {
+            assertEquals(expected[i], y[i], DELTA);
+        }
+    }
+
+    @Test
+    public void testSpMVRegular() {
+        SparseMatrixCSRFloat csr = createMatrix(1024, false);
+        float[] x = createVector(1024);
+        float[] y = new float[1024];
+
+        TaskSchedule s0 = SparseLinearAlgebra.spmv(new TaskSchedule("s0"), "t0", csr, x, y).streamOut(y);
+        s0.execute();
+
+        float[] expected = spmvSequential(csr, x);
+        for (int i = 0; i < y.length; i++) {
+            assertEquals(expected[i], y[i], DELTA);
+        }
+    }
+
+    @Test
+    public void testSpMVIrregular() {
+        SparseMatrixCSRFloat csr = createMatrix(1024, true);
+        float[] x = createVector(1024);
+        float[] y = new float[1024];
+
+        TaskSchedule s0 = SparseLinearAlgebra.spmv(new TaskSchedule("s0"), "t0", csr, x, y).streamOut(y);
+        s0.execute();
+
+        float[] expected = spmvSequential(csr, x);
+        for (int i = 0; i < y.length; i++) {
+            assertEquals(expected[i], y[i], DELTA);
+        }
+    }
+
+    @Test
+    public void testSpMM() {
+        final int size = 256;
+        final int columns = 16;
+        SparseMatrixCSRFloat csr = createMatrix(size, true);
+        float[] b = createVector(size * columns);
+        float[] c = new float[size * columns];
+
+        TaskSchedule s0 = SparseLinearAlgebra.spmm(new TaskSchedule("s0"), "t0", csr, b, columns, c).streamOut(c);
+        s0.execute();
+
+        float[] expected = new float[size * columns];
+        SparseLinearAlgebra.spmmCSR(csr.getRowPointers(), csr.getColumnIndexes(), csr.getValues(), size, b, columns, expected);
+        for (int i = 0; i < c.length; i++) {
+            assertEquals(expected[i], c[i], DELTA);
+        }
+    }
+}
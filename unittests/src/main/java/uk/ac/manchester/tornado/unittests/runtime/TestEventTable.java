@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+package uk.ac.manchester.tornado.unittests.runtime;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.util.ArrayList;
+import java.util.HashSet;
+
+import org.junit.Before;
+import org.junit.Test;
+
+import uk.ac.manchester.tornado.runtime.common.EventTable;
+
+/**
+ * Tests the recycling of the local event ids of the drivers, with events
+ * that complete when the test says so.
+ */
+public class TestEventTable {
+
+    private static final int WINDOW = 4;
+
+    private HashSet<Integer> running;
+    private ArrayList<Integer> released;
+    private EventTable<Integer> table;
+
+    @Before
+    public void createTable() {
+        running = new HashSet<>();
+        released = new ArrayList<>();
+        table = new EventTable<>(16, WINDOW, new EventTable.Reclaimer<Integer>() {
+            @Override
+            public boolean isComplete(Integer entry) {
+                return !running.contains(entry);
+            }
+
+            @Override
+            public void release(Integer entry) {
+                released.add(entry);
+            }
+        });
+    }
+
+    @Test
+    public void testWrapAround() {
+        for (int i = 0; i < 100; i++) {
+            final int id = table.register(i);
+            assertEquals(i % WINDOW, id);
+            assertEquals(Integer.valueOf(i), table.get(id));
+        }
+        assertEquals(WINDOW, table.size());
+        assertEquals(100 - WINDOW, released.size());
+        for (int i = 0; i < released.size(); i++) {
+            assertEquals(Integer.valueOf(i), released.get(i));
+        }
+    }
+
+    @Test
+    public void testGenerations() {
+        final int id = table.register(0);
+        final int generation = table.getGeneration(id);
+        for (int i = 1; i < WINDOW; i++) {
+            table.register(i);
+        }
+        assertTrue(table.isCurrent(id, generation));
+
+        // The next event recycles the slot of the first one
+        assertEquals(id, table.register(WINDOW));
+        assertFalse(table.isCurrent(id, generation));
+        assertTrue(table.isCurrent(id, table.getGeneration(id)));
+        assertEquals(generation + 1, table.getGeneration(id));
+    }
+
+    @Test
+    public void testRetainRelease() {
+        final int id = table.register(0);
+        final int generation = table.getGeneration(id);
+        table.retain(id);
+        assertTrue(table.isRetained(id));
+
+        for (int i = 1; i < 50; i++) {
+            assertTrue(table.register(i) != id);
+        }
+        assertTrue(table.isCurrent(id, generation));
+        assertEquals(Integer.valueOf(0), table.get(id));
+        assertFalse(released.contains(0));
+
+        table.release(id);
+        assertFalse(table.isRetained(id));
+        for (int i = 50; i < 50 + 2 * WINDOW; i++) {
+            table.register(i);
+        }
+        assertFalse(table.isCurrent(id, generation));
+        assertTrue(released.contains(0));
+    }
+
+    @Test
+    public void testGrowth() {
+        for (int i = 0; i < 100; i++) {
+            running.add(i);
+            assertEquals(i, table.register(i));
+        }
+        assertEquals(100, table.size());
+        assertTrue(table.capacity() >= 100);
+        assertTrue(released.isEmpty());
+        for (int i = 0; i < 100; i++) {
+            assertEquals(Integer.valueOf(i), table.get(i));
+        }
+    }
+
+    @Test
+    public void testStuckEventDoesNotBlockReclaim() {
+        running.add(0);
+        final int stuck = table.register(0);
+        for (int i = 1; i < 100; i++) {
+            table.register(i);
+        }
+        // Only the stuck event is kept beyond the window
+        assertTrue(table.size() <= WINDOW + 1);
+        assertEquals(Integer.valueOf(0), table.get(stuck));
+        assertFalse(released.contains(0));
+
+        running.remove(0);
+        for (int i = 100; i < 100 + 2 * WINDOW; i++) {
+            table.register(i);
+        }
+        assertTrue(released.contains(0));
+    }
+
+    @Test
+    public void testClear() {
+        for (int i = 0; i < 10; i++) {
+            running.add(i);
+            table.register(i);
+        }
+        table.clear();
+        assertEquals(0, table.size());
+        assertEquals(10, released.size());
+        assertEquals(0, table.register(10));
+    }
+
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+package uk.ac.manchester.tornado.unittests.runtime;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+
+import org.junit.Before;
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.rules.TemporaryFolder;
+
+import uk.ac.manchester.tornado.runtime.common.NumaTopology;
+
+/**
+ * Tests the NUMA placement of the devices against a fake sysfs tree, as given
+ * with -Dtornado.numa.sysfs.root=<path>.
+ */
+public class TestNumaTopology {
+
+    @Rule
+    public TemporaryFolder sysfs = new TemporaryFolder();
+
+    private NumaTopology topology;
+
+    private void writeEntry(String entry, String value) throws IOException {
+        final Path file = sysfs.getRoot().toPath().resolve(entry);
+        Files.createDirectories(file.getParent());
+        Files.write(file, (value + "\n").getBytes());
+    }
+
+    @Before
+    public void createTree() throws IOException {
+        writeEntry("bus/pci/devices/0000:3b:00.0/numa_node", "1");
+        writeEntry("bus/pci/devices/0000:af:00.0/numa_node", "-1");
+        writeEntry("bus/pci/devices/0000:d8:00.0/numa_node", "unknown");
+        writeEntry("devices/system/node/node1/cpulist", "0-3,8,10-11");
+        topology = new NumaTopology(sysfs.getRoot().toPath());
+    }
+
+    @Test
+    public void testNodeOfPCIDevice() {
+        final String busId = NumaTopology.formatPCIBusId(0, 0x3b, 0, 0);
+        assertEquals("0000:3b:00.0", busId);
+        assertEquals(1, topology.getNodeOfPCIDevice(busId));
+        assertEquals(1, topology.getNodeOfPCIDevice(busId.toUpperCase()));
+    }
+
+    @Test
+    public void testUnknownNodes() {
+        // Single-socket machines report -1
+        assertEquals(NumaTopology.UNKNOWN_NODE, topology.getNodeOfPCIDevice("0000:af:00.0"));
+        assertEquals(NumaTopology.UNKNOWN_NODE, topology.getNodeOfPCIDevice("0000:d8:00.0"));
+        assertEquals(NumaTopology.UNKNOWN_NODE, topology.getNodeOfPCIDevice("0000:00:00.0"));
+        assertEquals(NumaTopology.UNKNOWN_NODE, topology.getNodeOfPCIDevice(null));
+    }
+
+    @Test
+    public void testCpusOfNode() {
+        assertArrayEquals(new int[] { 0, 1, 2, 3, 8, 10, 11 }, topology.getCpusOfNode(1));
+        assertEquals(0, topology.getCpusOfNode(0).length);
+        assertEquals(0, topology.getCpusOfNode(NumaTopology.UNKNOWN_NODE).length);
+        assertEquals(0, NumaTopology.parseCpuList("0-x").length);
+    }
+
+    @Test
+    public void testPinOncePerThread() throws InterruptedException {
+        final ArrayList<int[]> pinned = new ArrayList<>();
+        Thread thread = new Thread(() -> {
+            topology.pinCurrentThread(1, pinned::add);
+            topology.pinCurrentThread(1, pinned::add);
+        });
+        thread.start();
+        thread.join();
+
+        assertEquals(1, pinned.size());
+        assertArrayEquals(new int[] { 0, 1, 2, 3, 8, 10, 11 }, pinned.get(0));
+    }
+
+}
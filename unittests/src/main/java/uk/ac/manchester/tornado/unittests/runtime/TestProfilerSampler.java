@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+package uk.ac.manchester.tornado.unittests.runtime;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+import uk.ac.manchester.tornado.api.profiler.ProfilerType;
+import uk.ac.manchester.tornado.runtime.profiler.ProfilerSampler;
+import uk.ac.manchester.tornado.runtime.profiler.TimeProfiler;
+
+/**
+ * Tests which executions of a task-schedule the profiler times when it only
+ * samples one in N executions.
+ */
+public class TestProfilerSampler {
+
+    private static final String PROFILER = "tornado.profiler";
+
+    private String profiler;
+
+    @Before
+    public void enableProfiler() {
+        profiler = System.getProperty(PROFILER);
+        System.setProperty(PROFILER, "True");
+    }
+
+    @After
+    public void restoreProfiler() {
+        if (profiler == null) {
+            System.clearProperty(PROFILER);
+        } else {
+            System.setProperty(PROFILER, profiler);
+        }
+    }
+
+    @Test
+    public void testEveryNthExecutionIsTimed() {
+        final int interval = 4;
+        final ProfilerSampler sampler = new ProfilerSampler(interval);
+        for (int i = 0; i < 3 * interval; i++) {
+            final String execution = "execution " + i;
+            final boolean expected = i % interval == 0;
+            final boolean timed = sampler.execute(sampled -> {
+                assertEquals(execution, expected, sampled);
+                return ProfilerSampler.isTimed();
+            });
+            assertEquals(execution, expected, timed);
+            assertTrue(ProfilerSampler.isTimed());
+        }
+        assertTrue(sampler.isSampling());
+        assertEquals(interval, sampler.getWeight());
+    }
+
+    @Test
+    public void testWithoutSampling() {
+        final ProfilerSampler sampler = new ProfilerSampler(1);
+        for (int i = 0; i < 4; i++) {
+            assertTrue(sampler.execute(sampled -> sampled && ProfilerSampler.isTimed()));
+        }
+        assertFalse(sampler.isSampling());
+    }
+
+    @Test
+    public void testTimedAfterException() {
+        final ProfilerSampler sampler = new ProfilerSampler(2);
+        // The first execution is sampled, the second one is not
+        sampler.execute(sampled -> sampled);
+        try {
+            sampler.execute(sampled -> {
+                assertFalse(ProfilerSampler.isTimed());
+                throw new IllegalStateException();
+            });
+            fail();
+        } catch (IllegalStateException e) {
+            assertTrue(ProfilerSampler.isTimed());
+        }
+    }
+
+    @Test
+    public void testWeightIsMetaData() {
+        final TimeProfiler timeProfiler = new TimeProfiler();
+        timeProfiler.registerMetaData(ProfilerType.SAMPLING_WEIGHT, "4");
+        assertEquals(0, timeProfiler.getTimer(ProfilerType.SAMPLING_WEIGHT));
+        assertTrue(timeProfiler.createJson(new StringBuffer(), "s0").contains("\"" + ProfilerType.SAMPLING_WEIGHT + "\": \"4\""));
+
+        timeProfiler.clean();
+        assertFalse(timeProfiler.createJson(new StringBuffer(), "s0").contains(ProfilerType.SAMPLING_WEIGHT.toString()));
+    }
+}
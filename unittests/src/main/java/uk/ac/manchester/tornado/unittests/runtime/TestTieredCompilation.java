@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+package uk.ac.manchester.tornado.unittests.runtime;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertNotNull;
+import static org.junit.Assert.assertNull;
+
+import java.util.concurrent.atomic.AtomicInteger;
+
+import org.junit.Test;
+
+import uk.ac.manchester.tornado.runtime.common.TieredCompilation;
+
+/**
+ * Tests the swap of the quick version of a kernel for the optimised one, with
+ * a recompilation that returns a string.
+ */
+public class TestTieredCompilation {
+
+    private static final int THRESHOLD = 3;
+    private static final long TIMEOUT_MILLIS = 10000;
+
+    private static String pollOptimised(TieredCompilation<String> tiered) throws InterruptedException {
+        final long deadline = System.currentTimeMillis() + TIMEOUT_MILLIS;
+        String optimised = tiered.onLaunch();
+        while (optimised == null && System.currentTimeMillis() < deadline) {
+            Thread.sleep(1);
+            optimised = tiered.onLaunch();
+        }
+        return optimised;
+    }
+
+    @Test
+    public void testSwapAfterThreshold() throws InterruptedException {
+        final AtomicInteger recompilations = new AtomicInteger();
+        final TieredCompilation<String> tiered = new TieredCompilation<>(() -> {
+            recompilations.incrementAndGet();
+            return "optimised";
+        }, THRESHOLD);
+
+        for (int i = 0; i < THRESHOLD - 1; i++) {
+            assertNull(tiered.onLaunch());
+        }
+        Thread.sleep(100);
+        assertEquals(0, recompilations.get());
+
+        final String optimised = pollOptimised(tiered);
+        assertNotNull(optimised);
+        assertEquals("optimised", optimised);
+
+        // The optimised code is handed out once, and never recompiled
+        for (int i = 0; i < THRESHOLD * 4; i++) {
+            assertNull(tiered.onLaunch());
+        }
+        Thread.sleep(100);
+        assertEquals(1, recompilations.get());
+    }
+
+    @Test
+    public void testFailedRecompilationKeepsQuickVersion() throws InterruptedException {
+        final AtomicInteger recompilations = new AtomicInteger();
+        final TieredCompilation<String> tiered = new TieredCompilation<>(() -> {
+            recompilations.incrementAndGet();
+            throw new IllegalStateException("recompilation failed");
+        }, THRESHOLD);
+
+        for (int i = 0; i < THRESHOLD; i++) {
+            assertNull(tiered.onLaunch());
+        }
+        final long deadline = System.currentTimeMillis() + TIMEOUT_MILLIS;
+        while (recompilations.get() == 0 && System.currentTimeMillis() < deadline) {
+            Thread.sleep(1);
+        }
+        assertEquals(1, recompilations.get());
+        for (int i = 0; i < THRESHOLD * 4; i++) {
+            assertNull(tiered.onLaunch());
+        }
+        assertEquals(1, recompilations.get());
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2013-2020, APT Group, Department of Computer Science,
+ * The University of Manchester.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+package uk.ac.manchester.tornado.unittests.runtime;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+import org.junit.Test;
+
+import uk.ac.manchester.tornado.runtime.common.WorkGroupSizes;
+
+/**
+ * Tests the work-group sizes that the GPU scheduler of the OpenCL driver
+ * chooses, for a device with 1024 work-items per dimension and a warp of 32.
+ */
+public class TestWorkGroupSizes {
+
+    private static final long[] MAX_WORK_ITEM_SIZES = new long[] { 1024, 1024, 64 };
+    private static final long WARP = 32;
+
+    @Test
+    public void testPreferredMultiple() {
+        assertEquals(256, WorkGroupSizes.groupSize(256, 4096, WARP));
+        // 96 is the largest multiple of the warp that divides 480
+        assertEquals(96, WorkGroupSizes.groupSize(100, 480, WARP));
+        // No multiple of the warp divides 100
+        assertEquals(100, WorkGroupSizes.groupSize(256, 100, WARP));
+    }
+
+    @Test
+    public void testKernelLimit1D() {
+        assertArrayEquals(new long[] { 1024, 1, 1 }, WorkGroupSizes.maxWorkItemSizes(1, MAX_WORK_ITEM_SIZES, 0, WARP));
+        assertArrayEquals(new long[] { 128, 1, 1 }, WorkGroupSizes.maxWorkItemSizes(1, MAX_WORK_ITEM_SIZES, 128, WARP));
+    }
+
+    @Test
+    public void testKernelLimit2D() {
+        assertArrayEquals(new long[] { 32, 32, 1 }, WorkGroupSizes.maxWorkItemSizes(2, MAX_WORK_ITEM_SIZES, 1024, WARP));
+        // sqrt(256) = 16 would leave half of each warp empty
+        assertArrayEquals(new long[] { 32, 8, 1 }, WorkGroupSizes.maxWorkItemSizes(2, MAX_WORK_ITEM_SIZES, 256, WARP));
+        // A limit below the warp goes to the first dimension
+        assertArrayEquals(new long[] { 16, 1, 1 }, WorkGroupSizes.maxWorkItemSizes(2, MAX_WORK_ITEM_SIZES, 16, WARP));
+    }
+
+    @Test
+    public void testKernelLimit3D() {
+        final long[] sizes = WorkGroupSizes.maxWorkItemSizes(3, MAX_WORK_ITEM_SIZES, 128, WARP);
+        assertEquals(32, sizes[0]);
+        assertEquals(4, sizes[1]);
+        assertEquals(8, sizes[2]);
+    }
+
+    @Test
+    public void testGroupsWithinKernelLimit() {
+        for (long limit = 1; limit <= 1024; limit++) {
+            final long[] sizes = WorkGroupSizes.maxWorkItemSizes(2, MAX_WORK_ITEM_SIZES, limit, WARP);
+            final long x = WorkGroupSizes.groupSize(sizes[0], 4096, WARP);
+            final long y = WorkGroupSizes.groupSize(sizes[1], 4096, 1);
+            assertTrue("limit " + limit, x * y <= limit);
+            if (limit >= WARP) {
+                assertEquals("limit " + limit, 0, x % WARP);
+            }
+        }
+    }
+}
@@ -57,6 +57,22 @@ public class TestMultipleTasksSingleDevice extends TornadoTestBase {
         }
     }
 
+    public static int scale(int value, int alpha) {
+        return (value < 0) ? -value * alpha : value * alpha;
+    }
+
+    public static void task4Scale(int[] a, int[] b, int alpha) {
+        for (@Parallel int i = 0; i < a.length; i++) {
+            b[i] = scale(a[i], alpha);
+        }
+    }
+
+    public static void task5ScaleAdd(int[] a, int[] b, int[] c, int alpha) {
+        for (@Parallel int i = 0; i < a.length; i++) {
+            c[i] = scale(a[i], alpha) + b[i];
+        }
+    }
+
     @Test
     public void testTwoTasks() {
         final int numElements = 1024;
@@ -149,4 +165,137 @@ public class TestMultipleTasksSingleDevice extends TornadoTestBase {
         }
     }
 
+    /**
+     * Two task-schedules running the same method with the same specialisation
+     * share a single kernel; each one must still read its own arguments.
+     */
+    @Test
+    public void testSharedKernelAcrossSchedules() {
+        final int numElements = 1024;
+        int[] a = new int[numElements];
+        int[] b = new int[numElements];
+        int[] c = new int[numElements];
+        int[] d = new int[numElements];
+
+        for (int i = 0; i < numElements; i++) {
+            a[i] = i;
+            b[i] = 2 * i;
+        }
+
+        //@formatter:off
+        new TaskSchedule("s0")
+            .streamIn(a, b)
+            .task("t0", TestMultipleTasksSingleDevice::task2Saxpy, a, b, c, 12)
+            .streamOut(c)
+            .execute();
+
+        new TaskSchedule("s1")
+            .streamIn(b, a)
+            .task("t0", TestMultipleTasksSingleDevice::task2Saxpy, b, a, d, 12)
+            .streamOut(d)
+            .execute();
+        //@formatter:on
+
+        for (int i = 0; i < numElements; i++) {
+            assertEquals(12 * i + 2 * i, c[i]);
+            assertEquals(24 * i + i, d[i]);
+        }
+    }
+
+    /**
+     * Repeated executions of a task-schedule with an output-only array. After the
+     * first execution, the allocations are skipped and each execution streams in
+     * the new input.
+     */
+    @Test
+    public void testRepeatedExecutions() {
+        final int numElements = 1024;
+        int[] a = new int[numElements];
+        int[] b = new int[numElements];
+        int[] c = new int[numElements];
+
+        //@formatter:off
+        TaskSchedule s0 = new TaskSchedule("s0")
+            .streamIn(a)
+            .task("t0", TestMultipleTasksSingleDevice::task3Copy, a, b, 1)
+            .task("t1", TestMultipleTasksSingleDevice::task2Saxpy, a, b, c, 2)
+            .streamOut(c);
+        //@formatter:on
+
+        for (int iteration = 0; iteration < 4; iteration++) {
+            for (int i = 0; i < numElements; i++) {
+                a[i] = i + iteration;
+            }
+            s0.execute();
+            for (int i = 0; i < numElements; i++) {
+                assertEquals(3 * (i + iteration), c[i]);
+            }
+        }
+    }
+
+    /**
+     * Two independent tasks read an array that a third task overwrites. With
+     * -Dtornado.dag.scheduler=True the first two may run concurrently, but the
+     * third one must wait for both.
+     */
+    @Test
+    public void testIndependentTasks() {
+        final int numElements = 1024;
+        int[] a = new int[numElements];
+        int[] b = new int[numElements];
+        int[] c = new int[numElements];
+
+        for (int i = 0; i < numElements; i++) {
+            a[i] = i;
+        }
+
+        //@formatter:off
+        new TaskSchedule("s0")
+            .streamIn(a)
+            .task("t0", TestMultipleTasksSingleDevice::task3Copy, a, b, 1)
+            .task("t1", TestMultipleTasksSingleDevice::task2Saxpy, a, a, c, 2)
+            .task("t2", TestMultipleTasksSingleDevice::task0Initialization, a)
+            .streamOut(a, b, c)
+            .execute();
+        //@formatter:on
+
+        for (int i = 0; i < numElements; i++) {
+            assertEquals(10, a[i]);
+            assertEquals(i, b[i]);
+            assertEquals(3 * i, c[i]);
+        }
+    }
+
+    /**
+     * Two tasks call the same method. Without inlining (e.g.
+     * -Dgraal.MaximumInliningSize=0), the method is generated in the source of
+     * both tasks, and with -Dtornado.opencl.schedule.program=True it must be
+     * defined only once in the program of the task-schedule.
+     */
+    @Test
+    public void testTasksSharingCallee() {
+        final int numElements = 1024;
+        int[] a = new int[numElements];
+        int[] b = new int[numElements];
+        int[] c = new int[numElements];
+
+        for (int i = 0; i < numElements; i++) {
+            a[i] = i - 512;
+        }
+
+        //@formatter:off
+        new TaskSchedule("s0")
+            .streamIn(a)
+            .task("t0", TestMultipleTasksSingleDevice::task4Scale, a, b, 2)
+            .task("t1", TestMultipleTasksSingleDevice::task5ScaleAdd, a, b, c, 3)
+            .streamOut(b, c)
+            .execute();
+        //@formatter:on
+
+        for (int i = 0; i < numElements; i++) {
+            assertEquals(2 * Math.abs(i - 512), b[i]);
+            assertEquals(5 * Math.abs(i - 512), c[i]);
+        }
+    }
+
 }
@@ -134,4 +134,99 @@ public class TestSingleTaskSingleDevice extends TornadoTestBase {
         }
     }
 
+    /**
+     * Launches the same kernel from several threads at once, each thread with its
+     * own arguments. The task-schedules share the installed code, so the launches
+     * interleave on the same device context.
+     */
+    @Test
+    public void testSimpleTaskFromThreads() throws InterruptedException {
+        final int numElements = 4096;
+        final int numThreads = 4;
+        final int iterations = 20;
+        final float[][] results = new float[numThreads][];
+        final Throwable[] failures = new Throwable[numThreads];
+        Thread[] threads = new Thread[numThreads];
+
+        for (int t = 0; t < numThreads; t++) {
+            final int threadIndex = t;
+            threads[t] = new Thread(() -> {
+                float[] a = new float[numElements];
+                float[] b = new float[numElements];
+                float[] c = new float[numElements];
+                IntStream.range(0, numElements).sequential().forEach(i -> {
+                    a[i] = i;
+                    b[i] = threadIndex * numElements;
+                });
+
+                try {
+                    //@formatter:off
+                    TaskSchedule s0 = new TaskSchedule("s0")
+                        .streamIn(a, b)
+                        .task("t0", TestSingleTaskSingleDevice::simpleTask, a, b, c)
+                        .streamOut(c);
+                    //@formatter:on
+                    for (int iteration = 0; iteration < iterations; iteration++) {
+                        s0.execute();
+                    }
+                    results[threadIndex] = c;
+                } catch (Throwable e) {
+                    failures[threadIndex] = e;
+                }
+            });
+        }
+
+        for (Thread thread : threads) {
+            thread.start();
+        }
+        for (Thread thread : threads) {
+            thread.join();
+        }
+
+        for (int t = 0; t < numThreads; t++) {
+            if (failures[t] != null) {
+                throw new AssertionError("thread " + t + " failed", failures[t]);
+            }
+            for (int i = 0; i < numElements; i++) {
+                assertEquals(i + t * numElements, results[t][i], 0.001);
+            }
+        }
+    }
+
+    /**
+     * Runs a task past the threshold of the tiered compilation, so that the
+     * optimised kernel replaces the quick one while the schedule keeps
+     * executing. Run with {@code -Dtornado.tiered=True}.
+     */
+    @Test
+    public void testTieredCompilation() throws InterruptedException {
+        final int numElements = 4096;
+        final int iterations = 50;
+        float[] a = new float[numElements];
+        float[] b = new float[numElements];
+        float[] c = new float[numElements];
+
+        //@formatter:off
+        TaskSchedule s0 = new TaskSchedule("s0")
+            .streamIn(a, b)
+            .task("t0", TestSingleTaskSingleDevice::simpleTask, a, b, c)
+            .streamOut(c);
+        //@formatter:on
+
+        for (int iteration = 0; iteration < iterations; iteration++) {
+            final int offset = iteration;
+            IntStream.range(0, numElements).sequential().forEach(i -> {
+                a[i] = i + offset;
+                b[i] = (float) Math.random();
+            });
+
+            s0.execute();
+
+            for (int i = 0; i < c.length; i++) {
+                assertEquals(a[i] + b[i], c[i], 0.001);
+            }
+            // Leaves time for the background recompilation to finish
+            Thread.sleep(10);
+        }
+    }
 }
@@ -140,6 +140,35 @@ public class TestsVirtualLayer extends TornadoTestBase {
         }
     }
 
+    /**
+     * Migrates a task-schedule whose result is still only on the first device. The
+     * second device receives the array from the first one instead of the stale
+     * copy on the host.
+     */
+    @Test
+    public void testArrayMigrationWithoutStreamOut() {
+
+        final int numElements = 256;
+
+        int[] data = new int[numElements];
+
+        TaskSchedule s0 = new TaskSchedule("s0");
+        s0.task("t0", TestsVirtualLayer::accumulator, data, 1);
+
+        TornadoDriver driver = getTornadoRuntime().getDriver(0);
+
+        s0.mapAllTo(driver.getDevice(0));
+        s0.execute();
+
+        s0.streamOut(data);
+        s0.mapAllTo(driver.getDevice(1));
+        s0.execute();
+
+        for (int i = 0; i < numElements; i++) {
+            assertEquals(2, data[i]);
+        }
+    }
+
     @Test
     public void testTaskMigration() {
 
@@ -173,6 +202,37 @@ public class TestsVirtualLayer extends TornadoTestBase {
         }
     }
 
+    /**
+     * It compiles the task for the first two devices ahead of time, and then
+     * switches between them. The device switch reuses the precompiled code.
+     */
+    @Test
+    public void testPrecompiledDeviceSwitch() {
+        TornadoDriver driver = getTornadoRuntime().getDriver(0);
+
+        final int numElements = 512;
+        final float alpha = 2f;
+
+        final float[] x = new float[numElements];
+        final float[] y = new float[numElements];
+
+        IntStream.range(0, numElements).parallel().forEach(i -> x[i] = 450);
+
+        TaskSchedule s0 = new TaskSchedule("s0");
+        s0.task("t0", TestsVirtualLayer::saxpy, alpha, x, y).streamOut(y);
+        s0.precompileFor(driver.getDevice(0), driver.getDevice(1));
+
+        for (int deviceIndex : new int[] { 0, 1, 0 }) {
+            Arrays.fill(y, 0);
+            s0.setDevice(driver.getDevice(deviceIndex));
+            s0.execute();
+
+            for (int i = 0; i < numElements; i++) {
+                assertEquals((alpha * 450), y[i], 0.001f);
+            }
+        }
+    }
+
     @Ignore
     public void testVirtualLayer01() {
 